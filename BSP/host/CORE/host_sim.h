@@ -0,0 +1,177 @@
+/**
+ * @file host_sim.h
+ * @brief 主机仿真内核头文件（替代 stm32f10x.h / core_cm3.h）
+ * @details 在 x86-64 Linux 上模拟 Cortex-M 内核中框架依赖的最小子集：
+ *          - SysTick 寄存器（CTRL/LOAD/VAL/CALIB），按虚拟周期递减
+ *          - NVIC 优先级/使能接口（仅记录，不产生真实中断）
+ *          - PRIMASK 开关中断（屏蔽期间触发的中断挂起，开中断时补发）
+ *          - 外设定时事件（DMA 传输完成等）按虚拟时间顺序触发
+ *          虚拟时间只在 sim_core_advance() 中推进，运行结果完全可复现
+ */
+
+#ifndef __HOST_SIM_H
+#define __HOST_SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* ============== 仿真芯片标识 ============== */
+#define HOST_SIM_SERIES 1
+
+    /*===========================================================================*/
+    /*                              CMSIS 兼容定义                                */
+    /*===========================================================================*/
+
+    typedef enum
+    {
+        DISABLE = 0,
+        ENABLE = !DISABLE
+    } FunctionalState;
+
+    /**
+     * @brief 仿真中断号（与 STM32F1 保持一致）
+     */
+    typedef enum
+    {
+        SysTick_IRQn = -1,
+        EXTI0_IRQn = 6,
+        DMA1_Channel4_IRQn = 14,
+        TIM2_IRQn = 28,
+        TIM3_IRQn = 29,
+        I2C1_EV_IRQn = 31,
+        SPI1_IRQn = 35,
+        USART1_IRQn = 37,
+        SIM_IRQn_MAX = 64
+    } IRQn_Type;
+
+    /**
+     * @brief SysTick 寄存器模型
+     */
+    typedef struct
+    {
+        volatile uint32_t CTRL;  /**< 控制与状态 */
+        volatile uint32_t LOAD;  /**< 重装载值 */
+        volatile uint32_t VAL;   /**< 当前值（向下计数） */
+        volatile uint32_t CALIB; /**< 校准值 */
+    } SysTick_Type;
+
+#define SysTick_CTRL_ENABLE_Msk (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk (1UL << 16)
+#define SysTick_LOAD_RELOAD_Msk (0xFFFFFFUL)
+
+    extern SysTick_Type sim_systick;
+#define SysTick (&sim_systick)
+
+    extern uint32_t SystemCoreClock;
+
+    void SystemInit(void);
+
+    /*===========================================================================*/
+    /*                              仿真内核接口                                  */
+    /*===========================================================================*/
+
+    /**
+     * @brief 推进虚拟 CPU 时间
+     * @param cycles 推进的内核周期数
+     * @note SysTick 在此过程中递减，到期且使能中断时同步调用 SysTick_Handler()
+     */
+    void sim_core_advance(uint64_t cycles);
+
+    /**
+     * @brief 外设定时事件回调
+     */
+    typedef void (*sim_event_fn_t)(void *arg);
+
+    /**
+     * @brief 中断服务函数类型
+     */
+    typedef void (*sim_irq_handler_t)(void);
+
+#define SIM_EVENT_MAX 8       /**< 同时存在的外设事件上限 */
+#define SIM_IRQ_PENDING_MAX 8 /**< 屏蔽期间可挂起的中断数 */
+
+    /**
+     * @brief 安排一个外设事件（DMA 完成等），在 sim_core_advance() 推进到该时刻时执行
+     * @param delay 距当前的虚拟周期数
+     * @return 0 成功，-1 事件槽已满
+     */
+    int sim_core_schedule(uint64_t delay, sim_event_fn_t fn, void *arg);
+
+    /**
+     * @brief 触发中断
+     * @note NVIC 未使能时忽略；PRIMASK 屏蔽期间或另一个中断执行期间挂起，
+     *       __enable_irq() 或该中断返回时按触发顺序执行
+     */
+    void sim_core_irq(IRQn_Type irqn, sim_irq_handler_t handler);
+
+    /**
+     * @brief 中断是否已触发、尚未执行（对应 NVIC/SCB 挂起位）
+     */
+    bool sim_core_irq_is_pending(sim_irq_handler_t handler);
+
+    /**
+     * @brief 获取上电以来的虚拟内核周期数
+     */
+    uint64_t sim_core_cycles(void);
+
+    /**
+     * @brief 复位虚拟时间与 SysTick 寄存器
+     */
+    void sim_core_reset(void);
+
+    /* PRIMASK 模拟 */
+    void sim_core_irq_disable(void);
+    void sim_core_irq_enable(void);
+    bool sim_core_irq_masked(void);
+
+    /**
+     * @brief WFI 模拟：推进虚拟时间直到有中断执行，PRIMASK 屏蔽时直到有中断挂起
+     * @note 没有使能的 SysTick 中断也没有外设事件时直接返回
+     */
+    void sim_core_wfi(void);
+
+    /**
+     * @brief 获取 WFI 休眠累计的虚拟周期数
+     */
+    uint64_t sim_core_idle_cycles(void);
+
+    /**
+     * @brief 获取已执行的中断次数（含 SysTick）
+     */
+    uint32_t sim_core_irq_count(void);
+
+    /* NVIC 模拟：仅记录配置，供测试查询 */
+    void NVIC_SetPriorityGrouping(uint32_t group);
+    void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority);
+    uint32_t NVIC_GetPriority(IRQn_Type irqn);
+    void NVIC_EnableIRQ(IRQn_Type irqn);
+    void NVIC_DisableIRQ(IRQn_Type irqn);
+    uint32_t NVIC_GetEnableIRQ(IRQn_Type irqn);
+
+#define __NOP() __asm__ volatile("nop")
+#define __disable_irq() sim_core_irq_disable()
+#define __enable_irq() sim_core_irq_enable()
+#define __WFI() sim_core_wfi()
+#define __get_PRIMASK() ((uint32_t)sim_core_irq_masked())
+#define __set_PRIMASK(v) ((v) ? sim_core_irq_disable() : sim_core_irq_enable())
+#define __DSB() __sync_synchronize()
+#define __ISB() __sync_synchronize()
+#define __DMB() __sync_synchronize()
+
+    /* 中断服务函数（弱定义于 startup_host.c） */
+    void SysTick_Handler(void);
+    void USART1_IRQHandler(void);
+    void DMA1_Channel4_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_SIM_H */
@@ -0,0 +1,40 @@
+/**
+ * @file startup_host.c
+ * @brief 主机仿真启动文件
+ * @details 对应目标板 Reset_Handler 的启动顺序：
+ *          SystemInit -> df_log_init -> df_framework_init -> main
+ *          主机上由 constructor 在 main 之前完成前三步
+ */
+
+#include "host_sim.h"
+
+int df_log_init(void);
+int df_framework_init(void); /* 驱动框架自动初始化 */
+
+/*============================ 弱定义中断服务函数 ============================*/
+
+__attribute__((weak)) void SysTick_Handler(void)
+{
+}
+
+__attribute__((weak)) void USART1_IRQHandler(void)
+{
+}
+
+__attribute__((weak)) void DMA1_Channel4_IRQHandler(void)
+{
+}
+
+/*============================ 启动流程 ============================*/
+
+/**
+ * @brief 仿真复位入口（在 main 之前执行）
+ */
+__attribute__((constructor(101))) static void sim_reset_handler(void)
+{
+    SystemInit();
+    /* 初始化日志系统  */
+    df_log_init();
+    /* 调用驱动框架自动初始化 */
+    df_framework_init();
+}
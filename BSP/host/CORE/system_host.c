@@ -0,0 +1,331 @@
+/**
+ * @file system_host.c
+ * @brief 主机仿真内核实现
+ * @note 虚拟时间只由 sim_core_advance() 推进，不依赖主机时钟
+ */
+
+#include "host_sim.h"
+#include <stddef.h>
+#include <string.h>
+
+/*============================ 内核状态 ============================*/
+
+uint32_t SystemCoreClock = 72000000; /* 与 F103 默认主频一致 */
+
+SysTick_Type sim_systick = {0};
+
+static uint64_t sim_cycles = 0;         /* 虚拟内核周期 */
+static bool sim_primask = false;        /* 中断屏蔽标志 */
+
+/* 屏蔽期间挂起的中断服务函数 */
+static sim_irq_handler_t sim_irq_pending[SIM_IRQ_PENDING_MAX];
+static uint8_t sim_irq_pending_num = 0;
+static uint8_t sim_irq_active = 0; /* 正在执行的中断数（仿真单一优先级，不嵌套） */
+static uint32_t sim_irq_taken = 0; /* 已执行的中断数，WFI 据此判断唤醒 */
+static uint64_t sim_idle_cycles = 0; /* WFI 休眠的周期数 */
+
+/* 外设定时事件 */
+typedef struct
+{
+    uint64_t at;           /* 触发时刻（虚拟周期） */
+    sim_event_fn_t fn;     /* 回调 */
+    void *arg;             /* 回调参数 */
+    bool used;             /* 槽位占用 */
+} sim_event_t;
+
+static sim_event_t sim_events[SIM_EVENT_MAX];
+
+static uint8_t sim_nvic_priority[SIM_IRQn_MAX];
+static uint8_t sim_nvic_enable[SIM_IRQn_MAX];
+static uint32_t sim_nvic_group = 0;
+
+/*============================ 系统初始化 ============================*/
+
+void SystemInit(void)
+{
+    sim_core_reset();
+}
+
+void sim_core_reset(void)
+{
+    memset(&sim_systick, 0, sizeof(sim_systick));
+    memset(sim_events, 0, sizeof(sim_events));
+    sim_cycles = 0;
+    sim_primask = false;
+    sim_irq_pending_num = 0;
+    sim_irq_active = 0;
+    sim_irq_taken = 0;
+    sim_idle_cycles = 0;
+}
+
+/*============================ 虚拟时间 ============================*/
+
+uint64_t sim_core_cycles(void)
+{
+    return sim_cycles;
+}
+
+/**
+ * @brief SysTick 到期处理
+ */
+static void sim_systick_expire(void)
+{
+    sim_systick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+    if (!(sim_systick.CTRL & SysTick_CTRL_TICKINT_Msk))
+    {
+        return;
+    }
+    sim_core_irq(SysTick_IRQn, SysTick_Handler);
+}
+
+/**
+ * @brief SysTick 递减 cycles 个周期
+ */
+static void sim_systick_advance(uint64_t cycles)
+{
+    while (cycles > 0)
+    {
+        if (!(sim_systick.CTRL & SysTick_CTRL_ENABLE_Msk))
+        {
+            sim_cycles += cycles;
+            return;
+        }
+
+        /* VAL 从 LOAD 递减到 0，下一个周期重装载并置位 COUNTFLAG */
+        uint64_t to_expire = (uint64_t)sim_systick.VAL + 1;
+        if (cycles < to_expire)
+        {
+            sim_systick.VAL -= (uint32_t)cycles;
+            sim_cycles += cycles;
+            return;
+        }
+
+        cycles -= to_expire;
+        sim_cycles += to_expire;
+        sim_systick.VAL = sim_systick.LOAD & SysTick_LOAD_RELOAD_Msk;
+        sim_systick_expire();
+    }
+}
+
+/**
+ * @brief 最早到期的事件
+ * @return 事件下标，无事件返回 -1
+ */
+static int sim_event_next(void)
+{
+    int next = -1;
+
+    for (int i = 0; i < SIM_EVENT_MAX; i++)
+    {
+        if (sim_events[i].used && (next < 0 || sim_events[i].at < sim_events[next].at))
+        {
+            next = i;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief 按时间顺序执行所有已到期事件
+ */
+static void sim_event_fire_due(void)
+{
+    int i;
+
+    while ((i = sim_event_next()) >= 0 && sim_events[i].at <= sim_cycles)
+    {
+        sim_event_t ev = sim_events[i];
+        sim_events[i].used = false;
+        ev.fn(ev.arg);
+    }
+}
+
+void sim_core_advance(uint64_t cycles)
+{
+    uint64_t target = sim_cycles + cycles;
+
+    while (sim_cycles < target)
+    {
+        /* 推进到下一个外设事件或目标时刻，取较早者 */
+        uint64_t step = target - sim_cycles;
+        int ev = sim_event_next();
+        if (ev >= 0 && sim_events[ev].at > sim_cycles && sim_events[ev].at - sim_cycles < step)
+        {
+            step = sim_events[ev].at - sim_cycles;
+        }
+
+        sim_systick_advance(step);
+        sim_event_fire_due();
+    }
+}
+
+int sim_core_schedule(uint64_t delay, sim_event_fn_t fn, void *arg)
+{
+    for (int i = 0; i < SIM_EVENT_MAX; i++)
+    {
+        if (!sim_events[i].used)
+        {
+            sim_events[i].at = sim_cycles + delay;
+            sim_events[i].fn = fn;
+            sim_events[i].arg = arg;
+            sim_events[i].used = true;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 依次执行挂起的中断
+ */
+static void sim_irq_replay(void)
+{
+    while (sim_irq_pending_num > 0 && !sim_primask && sim_irq_active == 0)
+    {
+        sim_irq_handler_t handler = sim_irq_pending[0];
+        sim_irq_pending_num--;
+        memmove(&sim_irq_pending[0], &sim_irq_pending[1], sim_irq_pending_num * sizeof(handler));
+        sim_irq_active++;
+        sim_irq_taken++;
+        handler();
+        sim_irq_active--;
+    }
+}
+
+void sim_core_irq(IRQn_Type irqn, sim_irq_handler_t handler)
+{
+    if (handler == NULL || (irqn >= 0 && !NVIC_GetEnableIRQ(irqn)))
+    {
+        return;
+    }
+
+    /* 屏蔽期间或其他中断执行期间（如中断里阻塞发送推进了虚拟时间）挂起，
+       同一中断只挂起一次（与 NVIC 挂起位一致） */
+    for (uint8_t i = 0; i < sim_irq_pending_num; i++)
+    {
+        if (sim_irq_pending[i] == handler)
+        {
+            return;
+        }
+    }
+    if (sim_irq_pending_num < SIM_IRQ_PENDING_MAX)
+    {
+        sim_irq_pending[sim_irq_pending_num++] = handler;
+    }
+    sim_irq_replay();
+}
+
+bool sim_core_irq_is_pending(sim_irq_handler_t handler)
+{
+    for (uint8_t i = 0; i < sim_irq_pending_num; i++)
+    {
+        if (sim_irq_pending[i] == handler)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void sim_core_irq_disable(void)
+{
+    sim_primask = true;
+}
+
+void sim_core_irq_enable(void)
+{
+    sim_primask = false;
+    sim_irq_replay();
+}
+
+bool sim_core_irq_masked(void)
+{
+    return sim_primask;
+}
+
+void sim_core_wfi(void)
+{
+    uint32_t taken = sim_irq_taken;
+    uint64_t start = sim_cycles;
+
+    /* 推进到下一个 SysTick 到期或外设事件，直到有中断执行或挂起（PRIMASK 屏蔽时） */
+    while (sim_irq_pending_num == 0 && sim_irq_taken == taken)
+    {
+        uint64_t step = UINT64_MAX;
+        const uint32_t tick_on = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+        if ((sim_systick.CTRL & tick_on) == tick_on)
+        {
+            step = (uint64_t)sim_systick.VAL + 1;
+        }
+        int ev = sim_event_next();
+        if (ev >= 0 && sim_events[ev].at - sim_cycles < step)
+        {
+            step = (sim_events[ev].at > sim_cycles) ? sim_events[ev].at - sim_cycles : 1;
+        }
+        if (step == UINT64_MAX)
+        {
+            break; /* 没有唤醒源，目标板上会一直休眠 */
+        }
+        sim_core_advance(step);
+    }
+    sim_idle_cycles += sim_cycles - start;
+}
+
+uint64_t sim_core_idle_cycles(void)
+{
+    return sim_idle_cycles;
+}
+
+uint32_t sim_core_irq_count(void)
+{
+    return sim_irq_taken;
+}
+
+/*============================ NVIC 模拟 ============================*/
+
+void NVIC_SetPriorityGrouping(uint32_t group)
+{
+    sim_nvic_group = group;
+}
+
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+{
+    if (irqn >= 0 && irqn < SIM_IRQn_MAX)
+    {
+        sim_nvic_priority[irqn] = (uint8_t)priority;
+    }
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type irqn)
+{
+    if (irqn >= 0 && irqn < SIM_IRQn_MAX)
+    {
+        return sim_nvic_priority[irqn];
+    }
+    return 0;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    if (irqn >= 0 && irqn < SIM_IRQn_MAX)
+    {
+        sim_nvic_enable[irqn] = 1;
+    }
+}
+
+void NVIC_DisableIRQ(IRQn_Type irqn)
+{
+    if (irqn >= 0 && irqn < SIM_IRQn_MAX)
+    {
+        sim_nvic_enable[irqn] = 0;
+    }
+}
+
+uint32_t NVIC_GetEnableIRQ(IRQn_Type irqn)
+{
+    if (irqn >= 0 && irqn < SIM_IRQn_MAX)
+    {
+        return sim_nvic_enable[irqn];
+    }
+    return 0;
+}
@@ -0,0 +1,274 @@
+#include "driver.h"
+#include "df_log.h"
+#include "df_timer.h"
+#include <time.h>
+
+/**
+ * 主机仿真 SysTick 驱动
+ * 与 STM32F1 版本接口一致，寄存器由 host_sim 按虚拟周期递减：
+ *   1. 中断模式 - 到期时同步调用 SysTick_Handler
+ *   2. 计数模式 - 仅计数，用于延时
+ * 延时函数直接推进虚拟时间，不会真正阻塞主机线程
+ */
+
+static systick_mode_t g_systick_mode = SYSTICK_MODE_INTERRUPT;
+
+/**
+ * @brief 初始化SysTick定时器（中断模式，微秒级）
+ * @param interval_us 中断间隔时间（微秒）
+ */
+void Systick_Init_us(uint32_t interval_us)
+{
+    uint32_t ticks = (SystemCoreClock / 1000000) * interval_us;
+
+    // 检查是否超过24位计数器最大值
+    if (ticks > 0xFFFFFF)
+    {
+        ticks = 0xFFFFFF;
+    }
+
+    g_systick_mode = SYSTICK_MODE_INTERRUPT;
+    SysTick->LOAD = ticks - 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk |
+                    SysTick_CTRL_TICKINT_Msk |
+                    SysTick_CTRL_ENABLE_Msk;
+}
+
+/**
+ * @brief 初始化SysTick定时器（中断模式，毫秒级）
+ * @param interval_ms 中断间隔时间（毫秒）
+ */
+void Systick_Init_ms(uint32_t interval_ms)
+{
+    Systick_Init_us(interval_ms * 1000);
+}
+
+/**
+ * @brief 初始化SysTick为计数模式（不产生中断）
+ */
+void Systick_Init_Polling(void)
+{
+    g_systick_mode = SYSTICK_MODE_POLLING;
+    SysTick->LOAD = 0xFFFFFF; // 最大值
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk |
+                    SysTick_CTRL_ENABLE_Msk; // 不使能中断
+}
+
+/**
+ * @brief 按当前模式初始化SysTick
+ * @param ms 中断模式下的节拍间隔（毫秒）
+ */
+void Systick_Init(uint32_t ms)
+{
+    if (g_systick_mode == SYSTICK_MODE_POLLING)
+    {
+        Systick_Init_Polling();
+    }
+    else
+    {
+        Systick_Init_ms(ms); // 默认1ms
+    }
+}
+
+/**
+ * @brief 微秒级延时
+ * @param us 延时微秒数
+ * @note 推进虚拟时间，期间到期的 SysTick 中断会被同步执行
+ */
+void Systick_Delay_us(uint32_t us)
+{
+    sim_core_advance((uint64_t)(SystemCoreClock / 1000000) * us);
+}
+
+/**
+ * @brief 毫秒级延时
+ * @param ms 延时毫秒数
+ */
+void Systick_Delay_ms(uint32_t ms)
+{
+    while (ms--)
+    {
+        Systick_Delay_us(1000);
+    }
+}
+
+/**
+ * @brief 获取当前 SysTick 模式
+ * @return SYSTICK_MODE_INTERRUPT 或 SYSTICK_MODE_POLLING
+ */
+systick_mode_t Systick_GetMode(void)
+{
+    return g_systick_mode;
+}
+
+/**
+ * @brief SysTick初始化（Driver_Framework接口）
+ * @param arg 传参 arg_u32(ms)
+ */
+int systick_init(df_arg_t arg)
+{
+    Systick_Init(arg.us32 ? arg.us32 : 1);
+    return 0;
+}
+
+/*============================ 周期计数 ============================*/
+
+static uint64_t host_time_base_ns = 0;
+
+static uint64_t host_monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief 对应目标板 DWT 初始化：记录微秒时间戳零点
+ */
+void dwt_cycle_init(void)
+{
+    host_time_base_ns = host_monotonic_ns();
+}
+
+/**
+ * @brief 虚拟内核周期（对应 DWT CYCCNT 的64位扩展）
+ */
+uint64_t get_cycles64(void)
+{
+    return sim_core_cycles();
+}
+
+/**
+ * @brief 微秒时间戳（主机没有 DWT，取 CLOCK_MONOTONIC）
+ */
+uint64_t get_time_us(void)
+{
+    return (host_monotonic_ns() - host_time_base_ns) / 1000ULL;
+}
+
+/*============================ 系统节拍 ============================*/
+
+static uint64_t Systick_time;
+
+uint32_t get_tick(void)
+{
+    if (g_systick_mode == SYSTICK_MODE_POLLING)
+    {
+        return SysTick->VAL;
+    }
+    else
+    {
+        return (uint32_t)(Systick_time);
+    }
+}
+
+/**
+ * @brief 读取节拍计数与当前节拍内已经过的周期（中断安全）
+ * @param cycles 输出：当前节拍内已经过的内核周期数，小于 Systick_GetPeriod()
+ * @return 64位节拍计数，中断模式下与 get_tick() 同源
+ * @note 节拍已到期、中断尚未执行（PRIMASK 屏蔽或其他中断执行期间挂起）时计入该节拍
+ */
+uint64_t Systick_GetTime(uint32_t *cycles)
+{
+    if (g_systick_mode == SYSTICK_MODE_POLLING)
+    {
+        uint64_t now = get_cycles64();
+        *cycles = (uint32_t)now & 0xFFFFFF;
+        return now >> 24;
+    }
+
+    uint64_t ticks = Systick_time;
+    if (sim_core_irq_is_pending(SysTick_Handler))
+    {
+        ticks++;
+    }
+    *cycles = SysTick->LOAD - SysTick->VAL;
+    return ticks;
+}
+
+/**
+ * @brief 每个节拍的内核周期数（Systick_GetTime() 的节拍单位）
+ */
+uint32_t Systick_GetPeriod(void)
+{
+    return (g_systick_mode == SYSTICK_MODE_POLLING) ? 0x1000000 : SysTick->LOAD + 1;
+}
+
+void SysTick_Handler(void)
+{
+    // 在此处调用需要在SysTick中断中执行的函数
+    Systick_time++;
+    df_timer_tick();
+    if (Systick_time % 100 == 0)
+    {
+        log_flush();
+    }
+}
+
+/*============================ 无节拍休眠 ============================*/
+
+/**
+ * @brief 无节拍休眠：关闭中间的节拍中断，在第 ticks 个节拍边界（或更早的中断）唤醒
+ * @param ticks 期望休眠的节拍数，小于2时只执行 WFI
+ * @return 休眠期间跳过（没有产生中断）的节拍数，已补偿到 get_tick() 与 df_timer
+ * @note 必须在关中断时调用，正常到期时最后一个节拍的中断挂起，开中断后进入 SysTick_Handler
+ * @note 仿真寄存器可直接写 VAL（剩余 VAL+1 个周期到期），COUNTFLAG 不会读清，需要手动清除
+ */
+uint32_t Systick_Sleep(uint32_t ticks)
+{
+    uint32_t cpt = SysTick->LOAD + 1; // 每节拍周期数
+    uint32_t skipped;
+
+    if (g_systick_mode != SYSTICK_MODE_INTERRUPT || ticks < 2)
+    {
+        __WFI();
+        return 0;
+    }
+    if (ticks > 0xFFFFFF / cpt)
+    {
+        ticks = 0xFFFFFF / cpt;
+    }
+
+    SysTick->CTRL &= ~(SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_COUNTFLAG_Msk);
+    uint32_t val = SysTick->VAL + 1; // 到下一个节拍边界的周期
+    uint32_t total = val + (ticks - 1) * cpt;
+    SysTick->VAL = total - 1;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    __WFI();
+
+    uint32_t ctrl = SysTick->CTRL;
+    SysTick->CTRL = ctrl & ~(SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_COUNTFLAG_Msk);
+    if (ctrl & SysTick_CTRL_COUNTFLAG_Msk)
+    {
+        // 正常到期：最后一个节拍的中断已挂起，计数器已按1个节拍重装载
+        skipped = ticks - 1;
+    }
+    else
+    {
+        // 被其他中断提前唤醒：按已经过的周期补偿，VAL 对齐到下一个节拍边界
+        uint32_t elapsed = total - (SysTick->VAL + 1);
+        uint32_t remain;
+        if (elapsed < val)
+        {
+            skipped = 0;
+            remain = val - elapsed;
+        }
+        else
+        {
+            skipped = 1 + (elapsed - val) / cpt;
+            remain = cpt - (elapsed - val) % cpt;
+        }
+        SysTick->VAL = remain - 1;
+    }
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    Systick_time += skipped;
+    for (uint32_t i = 0; i < skipped; i++)
+    {
+        df_timer_tick(); // 跳过的节拍内没有定时器到期，只推进时间轮
+    }
+    return skipped;
+}
@@ -0,0 +1,43 @@
+#include "driver.h"
+#include "df_delay.h"
+
+extern df_delay_t delay;
+
+/* 主机仿真：延时通过推进虚拟时间实现，不占用主机CPU */
+
+// 毫秒延时函数 - 统一接口封装
+static int delay_ms_unified(df_arg_t arg)
+{
+    Systick_Delay_ms(arg.us32);
+    return 0;
+}
+
+// 原始接口（保持兼容性）
+void delay_ms(uint32_t ms)
+{
+    delay_ms_unified(arg_u32(ms));
+}
+
+void __delay_ms(uint32_t ms)
+{
+    delay_ms_unified(arg_u32(ms));
+}
+
+// 微秒延时函数 - 统一接口封装
+static int delay_us_unified(df_arg_t arg)
+{
+    Systick_Delay_us(arg.us32);
+    return 0;
+}
+
+// 原始接口（保持兼容性）
+void delay_us(uint32_t us)
+{
+    delay_us_unified(arg_u32(us));
+}
+
+df_delay_t delay = {
+    .init_flag = true,
+    .init = NULL,
+    .ms = delay_ms_unified,
+    .us = delay_us_unified};
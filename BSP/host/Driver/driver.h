@@ -0,0 +1,105 @@
+/**
+ * @file driver.h
+ * @brief 主机仿真驱动层头文件
+ * @note 对接 Driver_Framework 接口，使用 sim 内存外设模型
+ *       接口名称与 stm32f1/Driver/driver.h 保持一致，上层代码无需修改
+ */
+
+#ifndef __DRIVER_H
+#define __DRIVER_H
+
+#include <host_sim.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <dev_frame.h>
+
+/* 包含仿真外设模型 */
+#include "sim_gpio.h"
+#include "sim_usart.h"
+#include "sim_i2c.h"
+#include "sim_spi.h"
+#include "sim_dma.h"
+
+#include <i2c/df_iic.h>
+
+extern df_iic_t i2c1_bus;      /* 外部软件I2C总线 */
+extern sim_i2c_bus_t sim_i2c1; /* I2C1 上的仿真从机总线 */
+
+/*============================ 设备名称定义 ============================*/
+#define DEBUG_UART_NAME "usart_debug"
+#define ONBOARD_LED_NAME "led_onboard"
+#define OLED_NAME "oled_dp"
+#define LCD_NAME "lcd_dp"
+#define MPU6050_NAME "mpu6050_sensor"
+#define ADC1_NAME "adc1"
+
+/*============================ 设备编号定义 ============================*/
+/* Dev_info_poor 中的下标，编译期确定：&Dev_info_poor[DEV_ID_xxx] 即设备句柄 */
+enum
+{
+    DEV_ID_OLED = 0,
+    DEV_ID_NUM
+};
+
+/*============================ NVIC 接口 ============================*/
+void NVIC_Init(void);
+int nvic_init(df_arg_t arg);
+
+/*============================ SysTick 接口 ============================*/
+typedef enum
+{
+    SYSTICK_MODE_INTERRUPT = 0, /* 中断模式 */
+    SYSTICK_MODE_POLLING = 1    /* 计数模式（轮询）*/
+} systick_mode_t;
+
+void Systick_Init_us(uint32_t interval_us);
+void Systick_Init_ms(uint32_t interval_ms);
+void Systick_Init(uint32_t ms);
+void Systick_Init_Polling(void);
+void Systick_Delay_us(uint32_t us);
+void Systick_Delay_ms(uint32_t ms);
+systick_mode_t Systick_GetMode(void);
+uint32_t Systick_Sleep(uint32_t ticks);
+uint64_t Systick_GetTime(uint32_t *cycles);
+uint32_t Systick_GetPeriod(void);
+int systick_init(df_arg_t arg);
+uint32_t get_tick(void);
+
+/* 周期计数与微秒时间戳：周期为虚拟内核周期，微秒取主机 CLOCK_MONOTONIC */
+void dwt_cycle_init(void);
+uint64_t get_cycles64(void);
+uint64_t get_time_us(void);
+
+/*============================ 延时接口 ============================*/
+void delay_ms(uint32_t ms);
+void delay_us(uint32_t us);
+
+/*============================ LED/GPIO 接口 ============================*/
+int led_init(df_arg_t arg);
+int led_on(df_arg_t arg);
+int led_off(df_arg_t arg);
+int led_toggle(df_arg_t arg);
+
+/*============================ USART 接口 ============================*/
+int usart1_init(df_arg_t arg);
+int usart1_deinit(df_arg_t arg);
+int usart1_send(df_arg_t arg);
+int usart1_receive(df_arg_t arg);
+int usart1_log_dma_init(void);                      /* 日志改为 DMA 双缓冲输出 */
+void usart1_dma_tx_irq_handler(void);               /* DMA1_Channel4 中断处理 */
+const sim_dma_channel_t *usart1_tx_dma_channel(void); /* 发送 DMA 通道（统计用） */
+
+/*============================ 显示设备接口 ============================*/
+int sh1106_dev_init(df_arg_t arg);
+
+/*============================ SPI 接口 ============================*/
+#include <spi/df_spi.h>
+
+extern df_spi_t spi1_bus;     /* 外部软件SPI总线 */
+extern sim_spi_dev_t sim_spi1; /* SPI1 上的仿真从机 */
+
+int spi1_init(df_arg_t arg);
+int spi1_deinit(df_arg_t arg);
+
+#endif /* __DRIVER_H */
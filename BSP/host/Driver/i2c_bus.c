@@ -0,0 +1,105 @@
+/**
+ * @file i2c_bus.c
+ * @brief 主机仿真软件I2C总线驱动
+ * @note 使用 sim_gpio 开漏引脚实现软件I2C，总线上挂接 sim_i2c 从机模型
+ */
+
+#include "driver.h"
+#include "i2c/df_iic.h"
+
+/* ========== I2C1 配置: PB8=SCL, PB9=SDA ========== */
+#define I2C1_SCL_PORT SIM_GPIOB
+#define I2C1_SCL_PIN 8
+#define I2C1_SDA_PORT SIM_GPIOB
+#define I2C1_SDA_PIN 9
+
+/**
+ * @brief I2C1 仿真从机总线
+ */
+sim_i2c_bus_t sim_i2c1 = {
+    .scl_port = I2C1_SCL_PORT,
+    .scl_pin = I2C1_SCL_PIN,
+    .sda_port = I2C1_SDA_PORT,
+    .sda_pin = I2C1_SDA_PIN,
+};
+
+/**
+ * @brief I2C1引脚初始化
+ */
+void iic1_pins_config(void)
+{
+    /* 软件I2C必须使用开漏模式 */
+    sim_gpio_init(I2C1_SCL_PORT, I2C1_SCL_PIN, SIM_GPIO_MODE_OUT_OD);
+    sim_gpio_init(I2C1_SDA_PORT, I2C1_SDA_PIN, SIM_GPIO_MODE_OUT_OD);
+
+    /* 默认拉高 */
+    sim_gpio_write(I2C1_SCL_PORT, I2C1_SCL_PIN, 1);
+    sim_gpio_write(I2C1_SDA_PORT, I2C1_SDA_PIN, 1);
+
+    sim_i2c_bus_attach(&sim_i2c1);
+}
+
+/**
+ * @brief I2C1 SCL线控制
+ */
+void iic1_scl(uint8_t state)
+{
+    sim_gpio_write(I2C1_SCL_PORT, I2C1_SCL_PIN, state);
+}
+
+/**
+ * @brief I2C1 SDA线控制
+ */
+void iic1_sda(uint8_t state)
+{
+    sim_gpio_write(I2C1_SDA_PORT, I2C1_SDA_PIN, state);
+}
+
+/**
+ * @brief I2C1 SDA线设置为输入模式
+ */
+void iic1_sda_in(void)
+{
+    sim_gpio_init(I2C1_SDA_PORT, I2C1_SDA_PIN, SIM_GPIO_MODE_IN);
+}
+
+/**
+ * @brief I2C1 SDA线设置为输出模式
+ */
+void iic1_sda_out(void)
+{
+    sim_gpio_init(I2C1_SDA_PORT, I2C1_SDA_PIN, SIM_GPIO_MODE_OUT_OD);
+}
+
+/**
+ * @brief I2C1 读取SDA线状态
+ */
+uint8_t iic1_read_sda(void)
+{
+    return sim_gpio_read(I2C1_SDA_PORT, I2C1_SDA_PIN);
+}
+
+/**
+ * @brief I2C1软件IIC底层接口实例
+ */
+df_soft_iic_t i2c1_soft = {
+    .init_flag = false,
+    .gpio_init = iic1_pins_config,
+    .delay_us = delay_us,
+    .delay_ms = delay_ms,
+    .scl = iic1_scl,
+    .sda = iic1_sda,
+    .sda_in = iic1_sda_in,
+    .sda_out = iic1_sda_out,
+    .read_sda = iic1_read_sda,
+};
+
+/**
+ * @brief I2C1总线实例（统一接口）
+ */
+df_iic_t i2c1_bus = {
+    .init_flag = false,
+    .num = 1,
+    .name = "I2C1",
+    .soft_iic = &i2c1_soft,
+};
@@ -0,0 +1,30 @@
+/**
+ * @file irq.c
+ * @brief 主机仿真中断服务函数
+ * @note USART1 由 sim_usart_inject() 逐字节触发，DMA 由 sim_dma 传输完成事件触发
+ */
+
+#include "driver.h"
+#include <shell/df_shell.h>
+#include "main.h"
+#include <stddef.h>
+
+/**
+ * @brief USART1 接收中断处理函数
+ */
+void USART1_IRQHandler(void)
+{
+    if (sim_usart_available())
+    {
+        // 放入Shell接收队列，由主循环 shell_task 处理
+        shell_rx_push(&Shell, sim_usart_recv_char());
+    }
+}
+
+/**
+ * @brief DMA1 通道4（USART1_TX）中断处理函数
+ */
+void DMA1_Channel4_IRQHandler(void)
+{
+    usart1_dma_tx_irq_handler();
+}
@@ -0,0 +1,111 @@
+/**
+ * @file led.c
+ * @brief 主机仿真 LED/GPIO 驱动
+ * @note 使用 sim_gpio 实现 df_led.h 和 df_gpio.h 接口，引脚与 F103 最小系统板一致
+ * @note 片上外设通过 DF_PREV_INIT 分散加载初始化
+ */
+
+#include "driver.h"
+#include "df_led.h"
+#include "df_gpio.h"
+#include "df_init.h"
+
+/*============================ 板载 LED 配置 ============================*/
+/* 默认使用 PC13 (蓝色药丸板/最小系统板) */
+#ifndef ONBOARD_LED_PORT
+#define ONBOARD_LED_PORT SIM_GPIOC
+#endif
+
+#ifndef ONBOARD_LED_PIN
+#define ONBOARD_LED_PIN 13
+#endif
+
+/* LED 低电平点亮 */
+#ifndef LED_ACTIVE_LOW
+#define LED_ACTIVE_LOW 1
+#endif
+
+/*============================ 前向声明 ============================*/
+int led_init(df_arg_t arg);
+int led_on(df_arg_t arg);
+int led_off(df_arg_t arg);
+int led_toggle(df_arg_t arg);
+
+/*============================ LED 设备实例 ============================*/
+df_led_t led = {
+    .init_flag = false,
+    .num = 1,
+    .state = false,
+    .name = ONBOARD_LED_NAME,
+    .init = led_init,
+    .on = led_on,
+    .off = led_off,
+    .toggle = led_toggle};
+
+/*============================ LED 接口实现 ============================*/
+
+/**
+ * @brief 初始化板载 LED
+ */
+int led_init(df_arg_t arg)
+{
+    (void)arg;
+
+    sim_gpio_init(ONBOARD_LED_PORT, ONBOARD_LED_PIN, SIM_GPIO_MODE_OUT_PP);
+    sim_gpio_write(ONBOARD_LED_PORT, ONBOARD_LED_PIN, LED_ACTIVE_LOW);
+
+    led.init_flag = true;
+    led.state = false;
+
+    return 0;
+}
+
+/**
+ * @brief 点亮 LED
+ */
+int led_on(df_arg_t arg)
+{
+    (void)arg;
+
+    sim_gpio_write(ONBOARD_LED_PORT, ONBOARD_LED_PIN, !LED_ACTIVE_LOW);
+    led.state = true;
+    return 0;
+}
+
+/**
+ * @brief 熄灭 LED
+ */
+int led_off(df_arg_t arg)
+{
+    (void)arg;
+
+    sim_gpio_write(ONBOARD_LED_PORT, ONBOARD_LED_PIN, LED_ACTIVE_LOW);
+    led.state = false;
+    return 0;
+}
+
+/**
+ * @brief 翻转 LED 状态
+ */
+int led_toggle(df_arg_t arg)
+{
+    (void)arg;
+
+    sim_gpio_toggle(ONBOARD_LED_PORT, ONBOARD_LED_PIN);
+    led.state = !led.state;
+
+    return 0;
+}
+
+/*============================ 片上外设自动初始化 ============================*/
+
+/**
+ * @brief LED 自动初始化函数
+ * @note 通过 DF_PREV_INIT 宏在系统启动时自动调用
+ */
+static int led_auto_init(void)
+{
+    LOG_I("LED", "Initializing onboard LED...");
+    return led_init(arg_null);
+}
+DF_PREV_INIT(led_auto_init);
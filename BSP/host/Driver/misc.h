@@ -0,0 +1,19 @@
+/**
+ * @file misc.h
+ * @brief 主机仿真 NVIC 辅助定义（对应 STM32 标准库 misc.h）
+ */
+
+#ifndef __MISC_H
+#define __MISC_H
+
+#include "host_sim.h"
+
+#define NVIC_PriorityGroup_0 ((uint32_t)0x700) /*!< 0 bits for pre-emption priority */
+#define NVIC_PriorityGroup_1 ((uint32_t)0x600) /*!< 1 bits for pre-emption priority */
+#define NVIC_PriorityGroup_2 ((uint32_t)0x500) /*!< 2 bits for pre-emption priority */
+#define NVIC_PriorityGroup_3 ((uint32_t)0x400) /*!< 3 bits for pre-emption priority */
+#define NVIC_PriorityGroup_4 ((uint32_t)0x300) /*!< 4 bits for pre-emption priority */
+
+#define NVIC_PriorityGroupConfig(group) NVIC_SetPriorityGrouping(group)
+
+#endif /* __MISC_H */
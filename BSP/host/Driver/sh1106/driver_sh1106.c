@@ -0,0 +1,84 @@
+#include "driver_sh1106.h"
+#ifdef USE_DEVICE_SH1106
+
+/* 与 stm32f1 板级引脚一致，I2C 模式下仅作占位 */
+#define SH1106_DC_PORT SIM_GPIOB
+#define SH1106_DC_PIN 2
+#define SH1106_RES_PORT SIM_GPIOA
+#define SH1106_RES_PIN 7
+
+/**
+ * @brief 仿真屏幕，挂在 I2C1 总线上
+ */
+sim_sh1106_t sim_oled;
+
+/**
+ * @brief SH1106 GPIO初始化
+ */
+void sh1106_pin_init(void)
+{
+    sim_gpio_init(SH1106_DC_PORT, SH1106_DC_PIN, SIM_GPIO_MODE_OUT_PP);
+    sim_gpio_init(SH1106_RES_PORT, SH1106_RES_PIN, SIM_GPIO_MODE_OUT_PP);
+}
+
+/**
+ * @brief SH1106 复位控制
+ */
+void sh1106_res_set(bool level)
+{
+    sim_gpio_write(SH1106_RES_PORT, SH1106_RES_PIN, level);
+}
+
+/**
+ * @brief SH1106 数据/命令线控制
+ */
+void sh1106_dc_set(bool level)
+{
+    sim_gpio_write(SH1106_DC_PORT, SH1106_DC_PIN, level);
+}
+
+private_sh1106_t sh1106_private_hal = {
+    .pin_init = sh1106_pin_init,
+    .dc_control = sh1106_dc_set,
+    .res_control = sh1106_res_set
+};
+
+int sh1106_dev_init(df_arg_t arg)
+{
+    LCD_Handler_t *lcd = (LCD_Handler_t *)arg.ptr;
+    if (lcd == NULL)
+    {
+        LOG_E("SH1106", "sh1106_dev_init: lcd handler is NULL!");
+        return -1;
+    }
+    if (lcd->SetPixel == NULL)
+    {
+        LOG_E("SH1106", "sh1106_dev_init: lcd SetPixel function is NULL!");
+        return -1;
+    }
+    if (lcd->Width != 128 || lcd->Height != 64)
+    {
+        LOG_E("SH1106", "sh1106_dev_init: lcd size mismatch! Expected 128x64.");
+        return -1;
+    }
+    if (lcd->Update == NULL)
+    {
+        LOG_E("SH1106", "sh1106_dev_init: lcd Update function is NULL!");
+        return -1;
+    }
+    sim_sh1106_attach(&sim_oled, &sim_i2c1, SH1106_ADDRESS);
+    delay.ms(arg_u32(100)); // 等待电源稳定
+    int8_t ret = Device_SH1106_Init(&sh1106_private_hal);
+    if (ret != 0)
+    {
+        LOG_E("SH1106", "sh1106_dev_init: Device_SH1106_Init failed!");
+        LOG_E("SH1106", "Device_SH1106_Init: return code %d", ret);
+        return -1;
+    }
+    LCD_Clear(lcd, 0); // 清屏，黑色背景
+    LCD_Printf(lcd, "System Start\n");
+    LCD_Printf(lcd, "SH1106 OLED Initialized.\n");
+    return 0;
+}
+
+#endif
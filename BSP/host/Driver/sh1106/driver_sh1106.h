@@ -0,0 +1,17 @@
+#ifndef __DRIVER_SH1106_H__
+#define __DRIVER_SH1106_H__
+
+#include <config.h>
+#include "sh1106/sh1106.h"
+#include "driver.h"
+#include "i2c/df_iic.h"
+#include "lcd/df_lcd.h"
+#include "df_delay.h"
+#include "df_log.h"
+#include "device_init.h"
+#include "sim_sh1106.h"
+
+extern sim_sh1106_t sim_oled; /* I2C1 上的仿真 SH1106 屏 */
+extern df_delay_t delay;
+
+#endif
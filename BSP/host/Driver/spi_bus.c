@@ -0,0 +1,128 @@
+/**
+ * @file spi_bus.c
+ * @brief 主机仿真软件SPI总线驱动
+ * @note 使用 sim_gpio 实现软件SPI，总线上挂接 sim_spi 从机捕获 MOSI 数据
+ */
+
+#include <spi/df_spi.h>
+#include "config.h"
+#include "driver.h"
+
+/*===========================================================================*/
+/*                         SPI1 引脚配置                                      */
+/*===========================================================================*/
+
+#define SPI1_SCK_PORT SIM_GPIOA
+#define SPI1_SCK_PIN 5
+#define SPI1_MOSI_PORT SIM_GPIOA
+#define SPI1_MOSI_PIN 7
+#define SPI1_NSS_PORT SIM_GPIOA
+#define SPI1_NSS_PIN 4
+
+/**
+ * @brief SPI1 仿真从机
+ */
+sim_spi_dev_t sim_spi1 = {
+    .sck_port = SPI1_SCK_PORT,
+    .sck_pin = SPI1_SCK_PIN,
+    .mosi_port = SPI1_MOSI_PORT,
+    .mosi_pin = SPI1_MOSI_PIN,
+    .cs_port = SPI1_NSS_PORT,
+    .cs_pin = SPI1_NSS_PIN,
+};
+
+/*===========================================================================*/
+/*                         SPI1 GPIO 操作函数                                 */
+/*===========================================================================*/
+
+/**
+ * @brief SPI1引脚初始化
+ */
+void spi1_gpio_init(void)
+{
+    sim_gpio_init(SPI1_SCK_PORT, SPI1_SCK_PIN, SIM_GPIO_MODE_OUT_PP);
+    sim_gpio_init(SPI1_MOSI_PORT, SPI1_MOSI_PIN, SIM_GPIO_MODE_OUT_PP);
+    sim_gpio_init(SPI1_NSS_PORT, SPI1_NSS_PIN, SIM_GPIO_MODE_OUT_PP);
+
+    /* 默认状态：SCK低电平，NSS高电平（未选中）*/
+    sim_gpio_write(SPI1_SCK_PORT, SPI1_SCK_PIN, 0);
+    sim_gpio_write(SPI1_NSS_PORT, SPI1_NSS_PIN, 1);
+
+    sim_spi_attach(&sim_spi1);
+}
+
+/**
+ * @brief SPI1 SCK线控制
+ */
+void spi1_sck(uint8_t state)
+{
+    sim_gpio_write(SPI1_SCK_PORT, SPI1_SCK_PIN, state);
+}
+
+/**
+ * @brief SPI1 MOSI线控制
+ */
+void spi1_mosi(uint8_t state)
+{
+    sim_gpio_write(SPI1_MOSI_PORT, SPI1_MOSI_PIN, state);
+}
+
+/**
+ * @brief SPI1 CS线控制
+ */
+void spi1_cs(uint8_t state)
+{
+    sim_gpio_write(SPI1_NSS_PORT, SPI1_NSS_PIN, state);
+}
+
+/**
+ * @brief SPI1软件SPI底层接口实例
+ */
+df_soft_spi_t spi1_soft = {
+    .gpio_init = spi1_gpio_init,
+    .sck = spi1_sck,
+    .mosi = spi1_mosi,
+    .miso = NULL, /* 未使用MISO */
+    .cs = spi1_cs,
+    .cs2 = NULL,
+    .cs3 = NULL};
+
+/*===========================================================================*/
+/*                         SPI1 统一接口实现                                  */
+/*===========================================================================*/
+
+/**
+ * @brief SPI1 初始化
+ * @param arg 传参 arg_null
+ * @return 0成功，其他失败
+ */
+int spi1_init(df_arg_t arg)
+{
+    (void)arg;
+    Soft_SPI_Init(&spi1_soft);
+    spi1_bus.init_flag = true;
+    return 0;
+}
+
+/**
+ * @brief SPI1 去初始化
+ * @param arg 传参 arg_null
+ * @return 0成功
+ */
+int spi1_deinit(df_arg_t arg)
+{
+    (void)arg;
+    spi1_bus.init_flag = false;
+    return 0;
+}
+
+/**
+ * @brief SPI1总线实例（统一接口）
+ */
+df_spi_t spi1_bus = {
+    .init_flag = false,
+    .num = 1,
+    .name = "SPI1_SOFT",
+    .init = spi1_init,
+    .deinit = spi1_deinit,
+    .soft_spi = &spi1_soft};
@@ -0,0 +1,198 @@
+/**
+ * @file usart.c
+ * @brief 主机仿真 USART 片上外设驱动
+ * @note 使用 sim_usart 实现 df_uart.h 接口，输出到 stdout 或 sim_usart_set_sink() 指定的管道
+ * @note 片上外设通过 DF_BOARD_INIT 分散加载初始化
+ */
+
+#include "driver.h"
+#include "df_uart.h"
+#include "df_init.h"
+#include "df_log_dma.h"
+#include <stdarg.h>
+
+/*============================ 前向声明 ============================*/
+int usart1_init(df_arg_t arg);
+int usart1_deinit(df_arg_t arg);
+int usart1_send(df_arg_t arg);
+int usart1_write(const void *data, size_t len);
+int usart1_receive(df_arg_t arg);
+static int usart1_printf(const char *format, ...);
+
+/*============================ 设备实例 ============================*/
+df_uart_t Debug = {
+    .init_flag = false,
+    .num = 1,
+    .name = DEBUG_UART_NAME,
+    .baudrate = 250000,
+    .init = usart1_init,
+    .deinit = usart1_deinit,
+    .send = usart1_send,
+    .write = usart1_write,
+    .printf = usart1_printf,
+    .receive = usart1_receive,
+    .send_dma = NULL,
+    .receive_dma = NULL};
+
+/*============================ 接口实现 ============================*/
+
+/**
+ * @brief 初始化 USART1
+ */
+int usart1_init(df_arg_t arg)
+{
+    (void)arg;
+
+    /* 使能接收中断 */
+    NVIC_EnableIRQ(USART1_IRQn);
+    Debug.init_flag = true;
+
+    return 0;
+}
+
+/**
+ * @brief 关闭 USART1
+ */
+int usart1_deinit(df_arg_t arg)
+{
+    (void)arg;
+
+    NVIC_DisableIRQ(USART1_IRQn);
+    Debug.init_flag = false;
+
+    return 0;
+}
+
+/**
+ * @brief 发送字符串
+ */
+int usart1_send(df_arg_t arg)
+{
+    if (arg.ptr == NULL)
+        return -1;
+
+    sim_usart_send_string((const char *)arg.ptr);
+    return 0;
+}
+
+/**
+ * @brief 按长度发送数据
+ */
+int usart1_write(const void *data, size_t len)
+{
+    if (data == NULL)
+        return -1;
+
+    sim_usart_send_blocking((const uint8_t *)data, len);
+    return 0;
+}
+
+/**
+ * @brief 接收数据
+ */
+int usart1_receive(df_arg_t arg)
+{
+    uint8_t *data = (uint8_t *)arg.ptr;
+    if (data == NULL)
+        return -1;
+
+    *data = sim_usart_recv_char();
+    return 0;
+}
+
+/**
+ * @brief 格式化输出
+ */
+static int usart1_printf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    char buffer[128];
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+
+    va_end(args);
+
+    sim_usart_send_string(buffer);
+    return len;
+}
+
+/*============================ 日志 DMA 输出 ============================*/
+
+/**
+ * @brief USART1_TX 发送 DMA 通道（对应 F1 的 DMA1 Channel4）
+ */
+static void usart1_dma_sink(const uint8_t *data, size_t len)
+{
+    sim_usart_send_data(data, len);
+}
+
+static sim_dma_channel_t usart1_tx_dma = {
+    .irqn = DMA1_Channel4_IRQn,
+    .handler = DMA1_Channel4_IRQHandler,
+    .sink = usart1_dma_sink};
+
+static int usart1_log_dma_start(const void *data, size_t len)
+{
+    /* 每字节耗时与阻塞发送一致，由 sim_usart_set_baud() 决定 */
+    usart1_tx_dma.cycles_per_byte = sim_usart_byte_cycles();
+    return sim_dma_start(&usart1_tx_dma, data, len);
+}
+
+static const log_dma_port_t usart1_log_dma_port = {
+    .start = usart1_log_dma_start};
+
+int usart1_log_dma_init(void)
+{
+    NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+    return log_dma_init(&usart1_log_dma_port);
+}
+
+void usart1_dma_tx_irq_handler(void)
+{
+    if (usart1_tx_dma.tc)
+    {
+        sim_dma_clear_tc(&usart1_tx_dma);
+        log_dma_tx_complete();
+    }
+}
+
+const sim_dma_channel_t *usart1_tx_dma_channel(void)
+{
+    return &usart1_tx_dma;
+}
+
+/*============================ 片上外设自动初始化 ============================*/
+
+/**
+ * @brief USART1 日志输出包装函数
+ * @param str 要输出的字符串
+ */
+static void usart1_log_output(const char *str)
+{
+    sim_usart_send_string(str);
+}
+
+/**
+ * @brief USART1 日志二进制输出函数（延迟日志记录）
+ */
+static void usart1_log_write(const void *data, size_t len)
+{
+    usart1_write(data, len);
+}
+
+/**
+ * @brief USART1 自动初始化函数
+ * @note 通过 DF_BOARD_INIT 宏在系统启动时自动调用
+ */
+static int usart1_auto_init(void)
+{
+    g_log_config.output_func = usart1_log_output;
+    g_log_config.write_func = usart1_log_write;
+#ifdef LOG_USE_DMA
+    usart1_log_dma_init();
+#endif
+    LOG_I("USART1", "USART1 initialized with baud rate %d", Debug.baudrate);
+    return usart1_init(arg_null);
+}
+DF_BOARD_INIT(usart1_auto_init);
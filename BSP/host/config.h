@@ -0,0 +1,44 @@
+/**
+ * @file    config.h
+ * @brief   设备驱动配置文件 (主机仿真构建)
+ * @details 与 tool/config_generator.py 生成的 Device/config.h 结构一致，
+ *          主机构建固定使用软件I2C/SPI，SH1106 挂在仿真I2C总线上
+ */
+
+#ifndef __CONFIG_H_
+#define __CONFIG_H_
+
+#include <stdint.h>
+#include <driver.h>
+
+/*============================ 通信总线配置 ============================*/
+
+/* I2C通信总线选择 */
+#define __SOFTI2C_
+// #define __HARDI2C_
+
+#ifdef __SOFTI2C_
+#include <i2c/df_iic.h>
+extern df_iic_t i2c1_bus;   /* 声明外部I2C总线 */
+#define i2c_Dev (*i2c1_bus.soft_iic)
+#endif
+
+/* SPI通信总线选择 */
+#define __SOFTSPI_
+// #define __HARDSPI_
+
+#ifdef __SOFTSPI_
+#include <spi/df_spi.h>
+extern df_spi_t spi1_bus;   /* 声明外部SPI总线 */
+#define spi_Dev (*spi1_bus.soft_spi)
+#endif
+
+/*============================ 设备驱动配置 ============================*/
+
+/* SH1106 OLED 驱动 (I2C) */
+#ifdef USE_DEVICE_SH1106
+#include <sh1106/sh1106.h>
+#define SH1106_DEVICE_I2C_USED
+#endif /* USE_DEVICE_SH1106 */
+
+#endif /* __CONFIG_H_ */
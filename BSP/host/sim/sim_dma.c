@@ -0,0 +1,48 @@
+/**
+ * @file sim_dma.c
+ * @brief 主机仿真DMA通道实现
+ */
+
+#include "sim_dma.h"
+
+/**
+ * @brief 传输完成事件
+ */
+static void sim_dma_complete(void *arg)
+{
+    sim_dma_channel_t *ch = (sim_dma_channel_t *)arg;
+
+    if (ch->sink != NULL)
+    {
+        ch->sink(ch->src, ch->len);
+    }
+    ch->transfers++;
+    ch->bytes += ch->len;
+    ch->busy = false;
+    ch->tc = true;
+    sim_core_irq(ch->irqn, ch->handler);
+}
+
+int sim_dma_start(sim_dma_channel_t *ch, const void *src, size_t len)
+{
+    if (ch == NULL || src == NULL || len == 0 || ch->busy)
+    {
+        return -1;
+    }
+
+    ch->src = (const uint8_t *)src;
+    ch->len = len;
+    ch->tc = false;
+    ch->busy = true;
+    if (sim_core_schedule((uint64_t)ch->cycles_per_byte * len, sim_dma_complete, ch) != 0)
+    {
+        ch->busy = false;
+        return -1;
+    }
+    return 0;
+}
+
+void sim_dma_clear_tc(sim_dma_channel_t *ch)
+{
+    ch->tc = false;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file sim_dma.h
+ * @brief 主机仿真DMA通道
+ * @details 存储器到外设方向的DMA通道模型：
+ *          - 启动后按 len * cycles_per_byte 个虚拟周期安排完成事件
+ *          - 完成时才从源地址读取数据写入外设（传输期间改写源缓冲区会表现为输出错乱）
+ *          - 完成后置位 TC 并触发通道中断（受 PRIMASK/NVIC 控制）
+ */
+
+#ifndef __SIM_DMA_H
+#define __SIM_DMA_H
+
+#include "host_sim.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief 仿真DMA通道
+     */
+    typedef struct
+    {
+        uint32_t cycles_per_byte;  /**< 每字节耗时（内核周期），一般等于外设字节时间 */
+        IRQn_Type irqn;            /**< 通道中断号 */
+        sim_irq_handler_t handler; /**< 通道中断服务函数 */
+
+        /**
+         * @brief 外设数据寄存器
+         * @note 传输完成时一次性写入全部数据
+         */
+        void (*sink)(const uint8_t *data, size_t len);
+
+        /* 通道状态（内部使用） */
+        const uint8_t *src;
+        size_t len;
+        volatile bool busy; /**< 传输进行中（EN） */
+        volatile bool tc;   /**< 传输完成标志（TCIF） */
+
+        /* 统计信息 */
+        uint32_t transfers;
+        uint64_t bytes;
+    } sim_dma_channel_t;
+
+    /**
+     * @brief 启动一次传输
+     * @return 0 成功，-1 通道忙或参数错误
+     */
+    int sim_dma_start(sim_dma_channel_t *ch, const void *src, size_t len);
+
+    /**
+     * @brief 清除传输完成标志
+     */
+    void sim_dma_clear_tc(sim_dma_channel_t *ch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_DMA_H */
@@ -0,0 +1,137 @@
+/**
+ * @file sim_gpio.c
+ * @brief 主机仿真GPIO驱动实现
+ */
+
+#include "sim_gpio.h"
+
+/*============================ 端口模型 ============================*/
+
+typedef struct
+{
+    uint16_t odr;     /* 输出锁存 */
+    uint16_t out_en;  /* 1: 输出模式 */
+    uint16_t od;      /* 1: 开漏 */
+    uint16_t ext_low; /* 外部器件拉低 */
+    uint16_t level;   /* 上次钩子通知的电平 */
+    sim_gpio_hook_t hook[SIM_GPIO_PIN_MAX];
+    void *hook_arg[SIM_GPIO_PIN_MAX];
+    uint32_t edges[SIM_GPIO_PIN_MAX];
+} sim_gpio_bank_t;
+
+static sim_gpio_bank_t sim_gpio_bank[SIM_GPIO_PORT_MAX] = {
+    [0 ... SIM_GPIO_PORT_MAX - 1] = {.odr = 0xFFFF, .level = 0xFFFF}};
+
+#define SIM_GPIO_VALID(port, pin) ((unsigned)(port) < SIM_GPIO_PORT_MAX && (pin) < SIM_GPIO_PIN_MAX)
+
+/**
+ * @brief 计算引脚实际电平
+ * @note 推挽输出由ODR决定；开漏输出与输入模式为上拉线与
+ */
+static uint8_t sim_gpio_line(const sim_gpio_bank_t *bank, uint8_t pin)
+{
+    uint16_t mask = (uint16_t)(1u << pin);
+
+    if ((bank->out_en & mask) && !(bank->od & mask))
+    {
+        return (bank->odr & mask) ? 1 : 0;
+    }
+    if (bank->ext_low & mask)
+    {
+        return 0;
+    }
+    if ((bank->out_en & mask) && !(bank->odr & mask))
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief 电平变化时通知钩子
+ */
+static void sim_gpio_update(sim_gpio_bank_t *bank, uint8_t pin)
+{
+    uint16_t mask = (uint16_t)(1u << pin);
+    uint8_t level = sim_gpio_line(bank, pin);
+
+    if (((bank->level & mask) ? 1 : 0) == level)
+    {
+        return;
+    }
+    bank->level = level ? (bank->level | mask) : (bank->level & ~mask);
+    bank->edges[pin]++;
+    if (bank->hook[pin] != NULL)
+    {
+        bank->hook[pin](bank->hook_arg[pin], level);
+    }
+}
+
+/*============================ 接口实现 ============================*/
+
+void sim_gpio_init(sim_gpio_port_t port, uint8_t pin, sim_gpio_mode_t mode)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return;
+
+    sim_gpio_bank_t *bank = &sim_gpio_bank[port];
+    uint16_t mask = (uint16_t)(1u << pin);
+
+    bank->out_en = (mode == SIM_GPIO_MODE_IN) ? (bank->out_en & ~mask) : (bank->out_en | mask);
+    bank->od = (mode == SIM_GPIO_MODE_OUT_OD) ? (bank->od | mask) : (bank->od & ~mask);
+    sim_gpio_update(bank, pin);
+}
+
+void sim_gpio_write(sim_gpio_port_t port, uint8_t pin, uint8_t level)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return;
+
+    sim_gpio_bank_t *bank = &sim_gpio_bank[port];
+    uint16_t mask = (uint16_t)(1u << pin);
+
+    bank->odr = level ? (bank->odr | mask) : (bank->odr & ~mask);
+    sim_gpio_update(bank, pin);
+}
+
+uint8_t sim_gpio_read(sim_gpio_port_t port, uint8_t pin)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return 0;
+    return sim_gpio_line(&sim_gpio_bank[port], pin);
+}
+
+void sim_gpio_toggle(sim_gpio_port_t port, uint8_t pin)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return;
+    sim_gpio_write(port, pin, !(sim_gpio_bank[port].odr & (1u << pin)));
+}
+
+void sim_gpio_drive_external(sim_gpio_port_t port, uint8_t pin, bool pull_low)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return;
+
+    sim_gpio_bank_t *bank = &sim_gpio_bank[port];
+    uint16_t mask = (uint16_t)(1u << pin);
+
+    bank->ext_low = pull_low ? (bank->ext_low | mask) : (bank->ext_low & ~mask);
+    /* 从机驱动的变化不回调钩子，只同步记录电平 */
+    bank->level = sim_gpio_line(bank, pin) ? (bank->level | mask) : (bank->level & ~mask);
+}
+
+void sim_gpio_set_hook(sim_gpio_port_t port, uint8_t pin, sim_gpio_hook_t hook, void *arg)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return;
+    sim_gpio_bank[port].hook[pin] = hook;
+    sim_gpio_bank[port].hook_arg[pin] = arg;
+}
+
+uint32_t sim_gpio_edge_count(sim_gpio_port_t port, uint8_t pin)
+{
+    if (!SIM_GPIO_VALID(port, pin))
+        return 0;
+    return sim_gpio_bank[port].edges[pin];
+}
@@ -0,0 +1,78 @@
+/**
+ * @file sim_gpio.h
+ * @brief 主机仿真GPIO驱动头文件
+ * @details 内存中的 GPIOA-GPIOE 端口模型，每组16个引脚
+ *          - 输出锁存(ODR)与外部下拉共同决定引脚电平（线与，模拟开漏总线）
+ *          - 每个引脚可挂接一个电平变化钩子，用于构建 I2C/SPI 从机模型
+ */
+
+#ifndef __SIM_GPIO_H
+#define __SIM_GPIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief GPIO端口枚举
+     */
+    typedef enum
+    {
+        SIM_GPIOA = 0,
+        SIM_GPIOB,
+        SIM_GPIOC,
+        SIM_GPIOD,
+        SIM_GPIOE,
+        SIM_GPIO_PORT_MAX
+    } sim_gpio_port_t;
+
+#define SIM_GPIO_PIN_MAX 16
+
+    /**
+     * @brief GPIO模式
+     */
+    typedef enum
+    {
+        SIM_GPIO_MODE_IN = 0, /**< 输入（上拉） */
+        SIM_GPIO_MODE_OUT_PP, /**< 推挽输出 */
+        SIM_GPIO_MODE_OUT_OD  /**< 开漏输出 */
+    } sim_gpio_mode_t;
+
+    /**
+     * @brief 引脚电平变化钩子
+     * @param arg 注册时传入的用户参数
+     * @param level 变化后的引脚电平
+     */
+    typedef void (*sim_gpio_hook_t)(void *arg, uint8_t level);
+
+    void sim_gpio_init(sim_gpio_port_t port, uint8_t pin, sim_gpio_mode_t mode);
+    void sim_gpio_write(sim_gpio_port_t port, uint8_t pin, uint8_t level);
+    uint8_t sim_gpio_read(sim_gpio_port_t port, uint8_t pin);
+    void sim_gpio_toggle(sim_gpio_port_t port, uint8_t pin);
+
+    /**
+     * @brief 外部器件拉低/释放引脚（模拟从机驱动开漏总线）
+     * @note 不触发钩子，钩子只响应主机侧的电平变化
+     */
+    void sim_gpio_drive_external(sim_gpio_port_t port, uint8_t pin, bool pull_low);
+
+    /**
+     * @brief 注册引脚电平变化钩子
+     */
+    void sim_gpio_set_hook(sim_gpio_port_t port, uint8_t pin, sim_gpio_hook_t hook, void *arg);
+
+    /**
+     * @brief 引脚累计翻转次数（用于统计总线开销）
+     */
+    uint32_t sim_gpio_edge_count(sim_gpio_port_t port, uint8_t pin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_GPIO_H */
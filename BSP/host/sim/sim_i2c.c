@@ -0,0 +1,255 @@
+/**
+ * @file sim_i2c.c
+ * @brief 主机仿真I2C从机总线实现
+ */
+
+#include "sim_i2c.h"
+
+/*============================ 解码器状态 ============================*/
+
+enum
+{
+    SIM_I2C_IDLE = 0, /* 总线空闲 */
+    SIM_I2C_ADDR,     /* 接收地址字节 */
+    SIM_I2C_RX,       /* 从机接收（主机写） */
+    SIM_I2C_TX,       /* 从机发送（主机读） */
+    SIM_I2C_IGNORE    /* 未被寻址，等待 START/STOP */
+};
+
+/*============================ 从机访问 ============================*/
+
+static void sim_i2c_slave_write(sim_i2c_slave_t *slave, uint8_t reg, uint16_t index, uint8_t val)
+{
+    slave->write_bytes++;
+    if (slave->on_write != NULL)
+    {
+        slave->on_write(slave, reg, index, val);
+    }
+    else if (slave->regs != NULL && slave->size > 0)
+    {
+        slave->regs[(reg + index) % slave->size] = val;
+    }
+}
+
+static uint8_t sim_i2c_slave_read(sim_i2c_slave_t *slave, uint8_t reg, uint16_t index)
+{
+    slave->read_bytes++;
+    if (slave->on_read != NULL)
+    {
+        return slave->on_read(slave, reg, index);
+    }
+    if (slave->regs != NULL && slave->size > 0)
+    {
+        return slave->regs[(reg + index) % slave->size];
+    }
+    return 0xFF;
+}
+
+static sim_i2c_slave_t *sim_i2c_match(sim_i2c_bus_t *bus, uint8_t addr)
+{
+    for (sim_i2c_slave_t *s = bus->slaves; s != NULL; s = s->next)
+    {
+        if ((s->addr & 0xFE) == (addr & 0xFE))
+        {
+            return s;
+        }
+    }
+    return NULL;
+}
+
+/*============================ 总线驱动 ============================*/
+
+static void sim_i2c_sda_drive(sim_i2c_bus_t *bus, uint8_t level)
+{
+    sim_gpio_drive_external(bus->sda_port, bus->sda_pin, level == 0);
+}
+
+/**
+ * @brief 装载发送字节并驱动最高位
+ */
+static void sim_i2c_tx_load(sim_i2c_bus_t *bus)
+{
+    bus->shift = sim_i2c_slave_read(bus->active, bus->reg, bus->index);
+    bus->bit = 0;
+    sim_i2c_sda_drive(bus, bus->shift & 0x80);
+}
+
+/**
+ * @brief 一个字节接收完毕（第8个下降沿）
+ */
+static void sim_i2c_byte_done(sim_i2c_bus_t *bus)
+{
+    if (bus->state == SIM_I2C_ADDR)
+    {
+        bus->active = sim_i2c_match(bus, bus->shift);
+        if (bus->active == NULL)
+        {
+            bus->nacks++;
+            bus->next_state = SIM_I2C_IGNORE;
+            return;
+        }
+        bus->active->transactions++;
+        if (bus->shift & 0x01)
+        {
+            bus->next_state = SIM_I2C_TX;
+            bus->index = 0;
+        }
+        else
+        {
+            bus->next_state = SIM_I2C_RX;
+            bus->reg_valid = false;
+        }
+    }
+    else
+    {
+        if (!bus->reg_valid)
+        {
+            bus->reg = bus->shift;
+            bus->reg_valid = true;
+            bus->index = 0;
+        }
+        else
+        {
+            sim_i2c_slave_write(bus->active, bus->reg, bus->index++, bus->shift);
+        }
+        bus->next_state = SIM_I2C_RX;
+    }
+    sim_i2c_sda_drive(bus, 0); /* ACK */
+}
+
+static void sim_i2c_scl_rise(sim_i2c_bus_t *bus)
+{
+    uint8_t sda = sim_gpio_read(bus->sda_port, bus->sda_pin);
+
+    switch (bus->state)
+    {
+    case SIM_I2C_ADDR:
+    case SIM_I2C_RX:
+        if (bus->bit < 8)
+        {
+            bus->shift = (uint8_t)((bus->shift << 1) | sda);
+            bus->bit++;
+        }
+        else if (bus->bit == 8)
+        {
+            bus->bit = 9; /* ACK 时钟 */
+        }
+        break;
+    case SIM_I2C_TX:
+        if (bus->bit < 8)
+        {
+            bus->bit++;
+        }
+        else if (bus->bit == 8)
+        {
+            /* 主机 ACK=0 继续读，NACK=1 结束 */
+            bus->next_state = sda ? SIM_I2C_IGNORE : SIM_I2C_TX;
+            bus->bit = 9;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void sim_i2c_scl_fall(sim_i2c_bus_t *bus)
+{
+    switch (bus->state)
+    {
+    case SIM_I2C_ADDR:
+    case SIM_I2C_RX:
+        if (bus->bit == 8)
+        {
+            sim_i2c_byte_done(bus);
+        }
+        else if (bus->bit == 9)
+        {
+            sim_i2c_sda_drive(bus, 1);
+            bus->state = bus->next_state;
+            bus->bit = 0;
+            bus->shift = 0;
+            if (bus->state == SIM_I2C_TX)
+            {
+                sim_i2c_tx_load(bus);
+            }
+        }
+        break;
+    case SIM_I2C_TX:
+        if (bus->bit >= 1 && bus->bit <= 7)
+        {
+            sim_i2c_sda_drive(bus, (uint8_t)(bus->shift << bus->bit) & 0x80);
+        }
+        else if (bus->bit == 8)
+        {
+            sim_i2c_sda_drive(bus, 1); /* 释放SDA，等待主机应答 */
+        }
+        else if (bus->bit == 9)
+        {
+            bus->state = bus->next_state;
+            if (bus->state == SIM_I2C_TX)
+            {
+                bus->index++;
+                sim_i2c_tx_load(bus);
+            }
+            else
+            {
+                sim_i2c_sda_drive(bus, 1);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/*============================ 引脚钩子 ============================*/
+
+static void sim_i2c_scl_hook(void *arg, uint8_t level)
+{
+    sim_i2c_bus_t *bus = (sim_i2c_bus_t *)arg;
+
+    if (level)
+        sim_i2c_scl_rise(bus);
+    else
+        sim_i2c_scl_fall(bus);
+}
+
+static void sim_i2c_sda_hook(void *arg, uint8_t level)
+{
+    sim_i2c_bus_t *bus = (sim_i2c_bus_t *)arg;
+
+    /* SCL 为低时 SDA 变化属于正常数据位 */
+    if (!sim_gpio_read(bus->scl_port, bus->scl_pin))
+        return;
+
+    sim_i2c_sda_drive(bus, 1);
+    if (level == 0)
+    {
+        /* START / 重复 START */
+        bus->state = SIM_I2C_ADDR;
+        bus->bit = 0;
+        bus->shift = 0;
+        bus->starts++;
+    }
+    else
+    {
+        /* STOP */
+        bus->state = SIM_I2C_IDLE;
+        bus->active = NULL;
+    }
+}
+
+/*============================ 接口实现 ============================*/
+
+void sim_i2c_bus_attach(sim_i2c_bus_t *bus)
+{
+    bus->state = SIM_I2C_IDLE;
+    sim_gpio_set_hook(bus->scl_port, bus->scl_pin, sim_i2c_scl_hook, bus);
+    sim_gpio_set_hook(bus->sda_port, bus->sda_pin, sim_i2c_sda_hook, bus);
+}
+
+void sim_i2c_add_slave(sim_i2c_bus_t *bus, sim_i2c_slave_t *slave)
+{
+    slave->next = bus->slaves;
+    bus->slaves = slave;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file sim_i2c.h
+ * @brief 主机仿真I2C从机总线
+ * @details 挂在两个仿真GPIO引脚(SCL/SDA)上的开漏I2C从机解码器：
+ *          - 通过引脚电平变化钩子识别 START/STOP 与时钟沿
+ *          - 在SCL上升沿采样数据，第8个下降沿后驱动ACK
+ *          - 从机为“寄存器文件”模型：写事务首字节为寄存器地址，后续字节自动递增
+ *          因此 Driver_Framework 的软件I2C可以原样运行，不需要修改任何上层代码
+ */
+
+#ifndef __SIM_I2C_H
+#define __SIM_I2C_H
+
+#include "sim_gpio.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct sim_i2c_slave sim_i2c_slave_t;
+
+    /**
+     * @brief 仿真I2C从机
+     * @note on_write/on_read 为空时读写 regs 寄存器文件
+     */
+    struct sim_i2c_slave
+    {
+        uint8_t addr;  /**< 8位地址（与 Soft_IIC_* 的 addr 参数一致，最低位忽略） */
+        uint8_t *regs; /**< 寄存器文件 */
+        uint16_t size; /**< 寄存器文件大小 */
+
+        /**
+         * @brief 写入钩子
+         * @param reg 事务中的首字节（寄存器地址/控制字节）
+         * @param index 该事务中寄存器地址之后的第几个字节
+         * @param val 写入的数据
+         */
+        void (*on_write)(sim_i2c_slave_t *slave, uint8_t reg, uint16_t index, uint8_t val);
+
+        /**
+         * @brief 读取钩子
+         * @return 发送给主机的数据
+         */
+        uint8_t (*on_read)(sim_i2c_slave_t *slave, uint8_t reg, uint16_t index);
+
+        void *user; /**< 用户数据 */
+
+        /* 统计信息 */
+        uint32_t write_bytes;
+        uint32_t read_bytes;
+        uint32_t transactions;
+
+        sim_i2c_slave_t *next;
+    };
+
+    /**
+     * @brief 仿真I2C总线
+     */
+    typedef struct
+    {
+        sim_gpio_port_t scl_port;
+        uint8_t scl_pin;
+        sim_gpio_port_t sda_port;
+        uint8_t sda_pin;
+
+        /* 解码器状态（内部使用） */
+        uint8_t state;
+        uint8_t next_state;
+        uint8_t bit;
+        uint8_t shift;
+        uint8_t reg;
+        bool reg_valid;
+        uint16_t index;
+        sim_i2c_slave_t *active;
+        sim_i2c_slave_t *slaves;
+
+        /* 统计信息 */
+        uint32_t starts;
+        uint32_t nacks;
+    } sim_i2c_bus_t;
+
+    /**
+     * @brief 将总线解码器挂接到仿真GPIO
+     */
+    void sim_i2c_bus_attach(sim_i2c_bus_t *bus);
+
+    /**
+     * @brief 在总线上添加从机
+     */
+    void sim_i2c_add_slave(sim_i2c_bus_t *bus, sim_i2c_slave_t *slave);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_I2C_H */
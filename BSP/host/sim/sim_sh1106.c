@@ -0,0 +1,122 @@
+/**
+ * @file sim_sh1106.c
+ * @brief 主机仿真SH1106 OLED屏实现
+ */
+
+#include "sim_sh1106.h"
+#include <string.h>
+
+#define SIM_SH1106_CTRL_DATA 0x40 /* 控制字节：D/C#=1 */
+
+/**
+ * @brief 是否为带一个参数字节的双字节命令
+ */
+static bool sim_sh1106_has_param(uint8_t cmd)
+{
+    switch (cmd)
+    {
+    case 0x81: /* 对比度 */
+    case 0x8D: /* 电荷泵 */
+    case 0xA8: /* 复用率 */
+    case 0xAD: /* DC-DC */
+    case 0xD3: /* 显示偏移 */
+    case 0xD5: /* 时钟分频 */
+    case 0xD9: /* 预充电周期 */
+    case 0xDA: /* COM引脚配置 */
+    case 0xDB: /* VCOMH */
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void sim_sh1106_command(sim_sh1106_t *oled, uint8_t cmd)
+{
+    if (oled->param_skip)
+    {
+        oled->param_skip = 0;
+        return;
+    }
+
+    if (cmd <= 0x0F)
+    {
+        oled->col = (uint8_t)((oled->col & 0xF0) | cmd);
+    }
+    else if (cmd <= 0x1F)
+    {
+        oled->col = (uint8_t)((oled->col & 0x0F) | ((cmd & 0x0F) << 4));
+    }
+    else if ((cmd & 0xF8) == 0xB0)
+    {
+        oled->page = cmd & 0x07;
+    }
+    else if (cmd == 0xAE || cmd == 0xAF)
+    {
+        oled->display_on = (cmd == 0xAF);
+    }
+    else if (sim_sh1106_has_param(cmd))
+    {
+        oled->param_skip = 1;
+    }
+}
+
+static void sim_sh1106_on_write(sim_i2c_slave_t *slave, uint8_t reg, uint16_t index, uint8_t val)
+{
+    sim_sh1106_t *oled = (sim_sh1106_t *)slave->user;
+    (void)index;
+
+    if (reg & SIM_SH1106_CTRL_DATA)
+    {
+        if (oled->col < SIM_SH1106_COLS)
+        {
+            oled->gram[oled->page][oled->col++] = val;
+        }
+        oled->data_bytes++;
+    }
+    else
+    {
+        sim_sh1106_command(oled, val);
+    }
+}
+
+static uint8_t sim_sh1106_on_read(sim_i2c_slave_t *slave, uint8_t reg, uint16_t index)
+{
+    sim_sh1106_t *oled = (sim_sh1106_t *)slave->user;
+    (void)reg;
+    (void)index;
+
+    /* 状态字节：bit6 = 显示关闭 */
+    return oled->display_on ? 0x00 : 0x40;
+}
+
+void sim_sh1106_attach(sim_sh1106_t *oled, sim_i2c_bus_t *bus, uint8_t addr)
+{
+    memset(oled, 0, sizeof(*oled));
+    oled->slave.addr = addr;
+    oled->slave.on_write = sim_sh1106_on_write;
+    oled->slave.on_read = sim_sh1106_on_read;
+    oled->slave.user = oled;
+    sim_i2c_add_slave(bus, &oled->slave);
+}
+
+uint8_t sim_sh1106_pixel(const sim_sh1106_t *oled, uint16_t x, uint16_t y)
+{
+    if (x >= SIM_SH1106_COLS - SIM_SH1106_COL_OFFSET || y >= SIM_SH1106_PAGES * 8)
+        return 0;
+    return (oled->gram[y / 8][x + SIM_SH1106_COL_OFFSET] >> (y % 8)) & 0x01;
+}
+
+void sim_sh1106_dump(const sim_sh1106_t *oled, FILE *fp)
+{
+    static const char *const glyph[4] = {" ", "\xE2\x96\x80", "\xE2\x96\x84", "\xE2\x96\x88"};
+
+    for (uint16_t y = 0; y < SIM_SH1106_PAGES * 8; y += 2)
+    {
+        for (uint16_t x = 0; x < SIM_SH1106_COLS - SIM_SH1106_COL_OFFSET - 2; x++)
+        {
+            uint8_t v = sim_sh1106_pixel(oled, x, y) | (uint8_t)(sim_sh1106_pixel(oled, x, y + 1) << 1);
+            fputs(glyph[v], fp);
+        }
+        fputc('\n', fp);
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ * @file sim_sh1106.h
+ * @brief 主机仿真SH1106 OLED屏
+ * @details 作为 sim_i2c 从机解析命令/数据流，维护 8页 x 132列 的GRAM，
+ *          可用于验证显示驱动输出并把屏幕内容以字符画形式打印出来
+ */
+
+#ifndef __SIM_SH1106_H
+#define __SIM_SH1106_H
+
+#include "sim_i2c.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define SIM_SH1106_PAGES 8
+#define SIM_SH1106_COLS 132
+#define SIM_SH1106_COL_OFFSET 2 /* 1.3寸屏可见区域从第2列开始 */
+
+    typedef struct
+    {
+        sim_i2c_slave_t slave;
+        uint8_t gram[SIM_SH1106_PAGES][SIM_SH1106_COLS];
+        uint8_t page;
+        uint8_t col;
+        uint8_t param_skip; /* 双字节命令的参数字节 */
+        bool display_on;
+        uint32_t data_bytes;
+    } sim_sh1106_t;
+
+    /**
+     * @brief 初始化屏幕模型并挂到I2C总线
+     * @param addr 8位I2C地址（SH1106_ADDRESS）
+     */
+    void sim_sh1106_attach(sim_sh1106_t *oled, sim_i2c_bus_t *bus, uint8_t addr);
+
+    /**
+     * @brief 读取可见区域像素 (x:0~127, y:0~63)
+     */
+    uint8_t sim_sh1106_pixel(const sim_sh1106_t *oled, uint16_t x, uint16_t y);
+
+    /**
+     * @brief 以字符画形式输出屏幕内容（每字符表示 1x2 像素）
+     */
+    void sim_sh1106_dump(const sim_sh1106_t *oled, FILE *fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_SH1106_H */
@@ -0,0 +1,51 @@
+/**
+ * @file sim_spi.c
+ * @brief 主机仿真SPI从机实现
+ */
+
+#include "sim_spi.h"
+
+static void sim_spi_sck_hook(void *arg, uint8_t level)
+{
+    sim_spi_dev_t *dev = (sim_spi_dev_t *)arg;
+
+    if (!level || sim_gpio_read(dev->cs_port, dev->cs_pin))
+        return;
+
+    dev->shift = (uint8_t)((dev->shift << 1) | sim_gpio_read(dev->mosi_port, dev->mosi_pin));
+    if (++dev->bit < 8)
+        return;
+
+    if (dev->capture != NULL && dev->rx_count < dev->capture_len)
+    {
+        dev->capture[dev->rx_count] = dev->shift;
+    }
+    dev->rx_count++;
+    if (dev->on_byte != NULL)
+    {
+        dev->on_byte(dev, dev->shift);
+    }
+    dev->bit = 0;
+    dev->shift = 0;
+}
+
+static void sim_spi_cs_hook(void *arg, uint8_t level)
+{
+    sim_spi_dev_t *dev = (sim_spi_dev_t *)arg;
+
+    /* 片选下降沿开始新的一帧 */
+    if (!level)
+    {
+        dev->frames++;
+    }
+    dev->bit = 0;
+    dev->shift = 0;
+}
+
+void sim_spi_attach(sim_spi_dev_t *dev)
+{
+    dev->bit = 0;
+    dev->shift = 0;
+    sim_gpio_set_hook(dev->sck_port, dev->sck_pin, sim_spi_sck_hook, dev);
+    sim_gpio_set_hook(dev->cs_port, dev->cs_pin, sim_spi_cs_hook, dev);
+}
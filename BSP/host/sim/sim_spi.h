@@ -0,0 +1,57 @@
+/**
+ * @file sim_spi.h
+ * @brief 主机仿真SPI从机
+ * @details 挂在仿真GPIO(SCK/MOSI/CS)上的模式0从机：
+ *          CS为低时在SCK上升沿采样MOSI，满8位后回调并写入捕获缓冲区
+ */
+
+#ifndef __SIM_SPI_H
+#define __SIM_SPI_H
+
+#include "sim_gpio.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct sim_spi_dev sim_spi_dev_t;
+
+    /**
+     * @brief 仿真SPI从机
+     */
+    struct sim_spi_dev
+    {
+        sim_gpio_port_t sck_port;
+        uint8_t sck_pin;
+        sim_gpio_port_t mosi_port;
+        uint8_t mosi_pin;
+        sim_gpio_port_t cs_port;
+        uint8_t cs_pin;
+
+        /**
+         * @brief 收到一个完整字节时回调（可为空）
+         */
+        void (*on_byte)(sim_spi_dev_t *dev, uint8_t byte);
+
+        uint8_t *capture;     /**< 捕获缓冲区（可为空） */
+        uint32_t capture_len; /**< 捕获缓冲区大小 */
+        uint32_t rx_count;    /**< 累计接收字节数 */
+        uint32_t frames;      /**< 累计片选次数 */
+        void *user;
+
+        /* 内部状态 */
+        uint8_t bit;
+        uint8_t shift;
+    };
+
+    /**
+     * @brief 将从机挂接到仿真GPIO
+     */
+    void sim_spi_attach(sim_spi_dev_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_SPI_H */
@@ -0,0 +1,115 @@
+/**
+ * @file sim_usart.c
+ * @brief 主机仿真USART驱动实现
+ */
+
+#include "sim_usart.h"
+#include "host_sim.h"
+#include <string.h>
+#include <unistd.h>
+
+/*============================ 收发状态 ============================*/
+
+static int sim_usart_fd = STDOUT_FILENO;
+static uint64_t sim_usart_tx_count = 0;
+static uint32_t sim_usart_baud = 0; /* 0: 发送不占用虚拟时间 */
+
+static uint8_t sim_usart_rx_buf[SIM_USART_RX_SIZE];
+static uint16_t sim_usart_rx_head = 0;
+static uint16_t sim_usart_rx_tail = 0;
+
+/*============================ 发送 ============================*/
+
+void sim_usart_set_sink(int fd)
+{
+    sim_usart_fd = fd;
+}
+
+void sim_usart_set_baud(uint32_t baud)
+{
+    sim_usart_baud = baud;
+}
+
+uint32_t sim_usart_byte_cycles(void)
+{
+    if (sim_usart_baud == 0)
+        return 0;
+    /* 8N1: 每字节10位 */
+    return (uint32_t)((uint64_t)SystemCoreClock * 10 / sim_usart_baud);
+}
+
+void sim_usart_send_blocking(const uint8_t *data, size_t len)
+{
+    /* CPU 逐字节等待 TXE，占用整段发送时间 */
+    sim_core_advance((uint64_t)sim_usart_byte_cycles() * len);
+    sim_usart_send_data(data, len);
+}
+
+void sim_usart_send_data(const uint8_t *data, size_t len)
+{
+    sim_usart_tx_count += len;
+    if (sim_usart_fd < 0)
+        return;
+
+    while (len > 0)
+    {
+        ssize_t n = write(sim_usart_fd, data, len);
+        if (n <= 0)
+            return;
+        data += n;
+        len -= (size_t)n;
+    }
+}
+
+void sim_usart_send_char(uint8_t ch)
+{
+    sim_usart_send_data(&ch, 1);
+}
+
+void sim_usart_send_string(const char *str)
+{
+    if (str == NULL)
+        return;
+    sim_usart_send_data((const uint8_t *)str, strlen(str));
+}
+
+uint64_t sim_usart_tx_bytes(void)
+{
+    return sim_usart_tx_count;
+}
+
+/*============================ 接收 ============================*/
+
+bool sim_usart_available(void)
+{
+    return sim_usart_rx_head != sim_usart_rx_tail;
+}
+
+uint8_t sim_usart_recv_char(void)
+{
+    if (!sim_usart_available())
+        return 0;
+
+    uint8_t ch = sim_usart_rx_buf[sim_usart_rx_tail];
+    sim_usart_rx_tail = (sim_usart_rx_tail + 1) % SIM_USART_RX_SIZE;
+    return ch;
+}
+
+size_t sim_usart_inject(const char *data, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        uint16_t next = (sim_usart_rx_head + 1) % SIM_USART_RX_SIZE;
+        if (next == sim_usart_rx_tail)
+            break; /* 溢出，丢弃剩余数据 */
+
+        sim_usart_rx_buf[sim_usart_rx_head] = (uint8_t)data[i];
+        sim_usart_rx_head = next;
+
+        /* RXNE 中断：与硬件一样每收到一个字节进入一次中断 */
+        sim_core_irq(USART1_IRQn, USART1_IRQHandler);
+    }
+    return i;
+}
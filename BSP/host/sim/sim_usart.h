@@ -0,0 +1,70 @@
+/**
+ * @file sim_usart.h
+ * @brief 主机仿真USART驱动
+ * @details 发送端写入可配置的文件描述符（默认 stdout，可重定向到管道或 /dev/null），
+ *          接收端通过 sim_usart_inject() 注入数据并逐字节触发 USART1_IRQHandler
+ */
+
+#ifndef __SIM_USART_H
+#define __SIM_USART_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define SIM_USART_RX_SIZE 256
+
+    /**
+     * @brief 设置发送输出的文件描述符
+     * @param fd 文件描述符，-1 表示丢弃输出（仅计数）
+     */
+    void sim_usart_set_sink(int fd);
+
+    /**
+     * @brief 设置波特率（用于计算发送耗时）
+     * @param baud 波特率，0 表示发送不占用虚拟时间（默认）
+     */
+    void sim_usart_set_baud(uint32_t baud);
+
+    /**
+     * @brief 发送一个字节所需的内核周期数（8N1）
+     */
+    uint32_t sim_usart_byte_cycles(void);
+
+    /**
+     * @brief 阻塞发送：推进虚拟时间后输出，模拟 CPU 轮询 TXE
+     */
+    void sim_usart_send_blocking(const uint8_t *data, size_t len);
+
+    /**
+     * @brief 写入数据寄存器（立即输出，不占用虚拟时间）
+     */
+    void sim_usart_send_data(const uint8_t *data, size_t len);
+
+    void sim_usart_send_char(uint8_t ch);
+    void sim_usart_send_string(const char *str);
+
+    /**
+     * @brief 累计发送字节数
+     */
+    uint64_t sim_usart_tx_bytes(void);
+
+    /**
+     * @brief 注入接收数据，每个字节触发一次 USART1_IRQHandler
+     * @return 实际注入的字节数
+     */
+    size_t sim_usart_inject(const char *data, size_t len);
+
+    bool sim_usart_available(void);
+    uint8_t sim_usart_recv_char(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_USART_H */
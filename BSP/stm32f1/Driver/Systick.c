@@ -1,5 +1,6 @@
 #include "driver.h"
 #include "df_log.h"
+#include "df_timer.h"
 
 /**
  * STM32F1 SysTick驱动
@@ -77,11 +78,25 @@ void Systick_Init(uint32_t ms)
 /**
  * @brief 微秒级延时（阻塞）
  * @param us 延时微秒数
- * @note 需要先调用 Systick_Init_Polling() 或在中断模式下也可使用
+ * @note 中断模式下按 Systick_GetTime() 的节拍+周期计数，可跨越任意多个节拍；
+ *       计数模式下读取 VAL，单次最长 2^24 个周期
  */
 void Systick_Delay_us(uint32_t us)
 {
     uint32_t ticks = (SystemCoreClock / 1000000) * us;
+
+    if (g_systick_mode == SYSTICK_MODE_INTERRUPT)
+    {
+        uint32_t period = SysTick->LOAD + 1;
+        uint32_t cycles;
+        uint64_t start = Systick_GetTime(&cycles) * period + cycles;
+
+        while (Systick_GetTime(&cycles) * period + cycles - start < ticks)
+        {
+        }
+        return;
+    }
+
     uint32_t start = SysTick->VAL;
     uint32_t elapsed;
 
@@ -123,6 +138,55 @@ systick_mode_t Systick_GetMode(void)
     return g_systick_mode;
 }
 
+
+/*============================ DWT 周期计数 ============================*/
+
+static uint32_t dwt_last = 0; /* 上次读取的 CYCCNT */
+static uint32_t dwt_high = 0; /* 高32位（回绕次数） */
+
+/**
+ * @brief 使能 DWT 周期计数器
+ */
+void dwt_cycle_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    dwt_last = 0;
+    dwt_high = 0;
+}
+
+/**
+ * @brief 读取64位周期计数
+ * @note CYCCNT 为32位（72MHz 下约59秒回绕一次），SysTick 中断每秒读取一次，保证回绕不会被漏掉
+ */
+uint64_t get_cycles64(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = DWT->CYCCNT;
+    if (now < dwt_last)
+    {
+        dwt_high++;
+    }
+    dwt_last = now;
+    uint64_t cycles = ((uint64_t)dwt_high << 32) | now;
+
+    __set_PRIMASK(primask);
+    return cycles;
+}
+
+/**
+ * @brief 上电以来的微秒数（基于 DWT）
+ */
+uint64_t get_time_us(void)
+{
+    return get_cycles64() / (SystemCoreClock / 1000000UL);
+}
+
+/*============================ 系统节拍 ============================*/
+
 static uint64_t Systick_time;
 
 uint32_t get_tick(void)
@@ -137,13 +201,161 @@ uint32_t get_tick(void)
     }
 }
 
+/**
+ * @brief 读取节拍计数与当前节拍内已经过的周期（中断安全）
+ * @param cycles 输出：当前节拍内已经过的内核周期数，小于 Systick_GetPeriod()
+ * @return 64位节拍计数，中断模式下与 get_tick() 同源
+ * @note 节拍已到期、中断尚未执行（关中断期间或更高优先级中断中）时计入该节拍，
+ *       保证两次读取单调递增；计数模式下由 DWT 周期按 2^24 折算，需先调用 dwt_cycle_init()
+ */
+uint64_t Systick_GetTime(uint32_t *cycles)
+{
+    if (g_systick_mode == SYSTICK_MODE_POLLING)
+    {
+        uint64_t now = get_cycles64();
+        *cycles = (uint32_t)now & 0xFFFFFF;
+        return now >> 24;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t load = SysTick->LOAD;
+    uint64_t ticks = Systick_time;
+    uint32_t val = SysTick->VAL;
+    uint32_t pend = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+    uint32_t val2 = SysTick->VAL;
+    __set_PRIMASK(primask);
+
+    // 挂起位已置位，或两次读取之间发生重装载：节拍中断尚未计入 Systick_time
+    if (pend || val2 > val)
+    {
+        ticks++;
+    }
+    *cycles = load - val2;
+    return ticks;
+}
+
+/**
+ * @brief 每个节拍的内核周期数（Systick_GetTime() 的节拍单位）
+ */
+uint32_t Systick_GetPeriod(void)
+{
+    return (g_systick_mode == SYSTICK_MODE_POLLING) ? 0x1000000 : SysTick->LOAD + 1;
+}
+
 void SysTick_Handler(void)
 {
     // 在此处调用需要在SysTick中断中执行的函数
     Systick_time++;
+    df_timer_tick();
     if(Systick_time % 100 == 0){
         log_flush();
     }
+    if (Systick_time % 1000 == 0)
+    {
+        (void)get_cycles64(); /* 跟踪 CYCCNT 回绕 */
+    }
+}
+
+/*============================ 无节拍休眠 ============================*/
+
+/**
+ * @brief 无节拍休眠：关闭中间的节拍中断，在第 ticks 个节拍边界（或更早的中断）唤醒
+ * @param ticks 期望休眠的节拍数，小于2时只执行 WFI
+ * @return 休眠期间跳过（没有产生中断）的节拍数，已补偿到 get_tick() 与 df_timer
+ * @note 必须在关中断（PRIMASK=1）时调用，唤醒后由调用者开中断；
+ *       正常到期时最后一个节拍的中断处于挂起状态，开中断后照常进入 SysTick_Handler
+ * @note 受24位计数器限制，最长休眠 0xFFFFFF / (LOAD + 1) 个节拍
+ * @note 进入和唤醒时各停止计数一次，停止期间的周期由 DWT CYCCNT 测得并从重装载值中扣除
+ *       （需先调用 dwt_cycle_init()，未使能时不补偿）；读取 CYCCNT 之后到重新使能之间的
+ *       十几条指令无法计入，每次休眠 get_tick() 相对实际时间约慢十几个周期，不随休眠时长增加
+ */
+uint32_t Systick_Sleep(uint32_t ticks)
+{
+    uint32_t cpt = SysTick->LOAD + 1; // 每节拍周期数
+    uint32_t skipped;
+
+    if (g_systick_mode != SYSTICK_MODE_INTERRUPT || ticks < 2)
+    {
+        __WFI();
+        return 0;
+    }
+    if (ticks > 0xFFFFFF / cpt)
+    {
+        ticks = 0xFFFFFF / cpt;
+    }
+
+    // 停止计数，读取到下一个节拍边界的剩余周期
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uint32_t stop = DWT->CYCCNT; // SysTick 与 DWT 同为内核时钟，停止期间的周期按 CYCCNT 扣除
+    uint32_t val = SysTick->VAL;
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) || val == 0)
+    {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk; // 节拍已到期，直接返回处理
+        return 0;
+    }
+
+    // 一次计数到第 ticks 个节拍边界，重装载值随即恢复为1个节拍（下次重装载生效）
+    uint32_t total = val + (ticks - 1) * cpt; // 从停止时刻起算
+    SysTick->LOAD = total - (DWT->CYCCNT - stop) - 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = cpt - 1;
+
+    __DSB();
+    __WFI();
+    __ISB();
+
+    uint32_t ctrl = SysTick->CTRL; // 读取清除 COUNTFLAG
+    SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+    stop = DWT->CYCCNT;
+    ctrl |= SysTick->CTRL; // 停止前一刻到期的情况
+    uint32_t remain;       // 到下一个节拍边界的周期
+    if (ctrl & SysTick_CTRL_COUNTFLAG_Msk)
+    {
+        // 正常到期：最后一个节拍的中断已挂起，计数器已按1个节拍重装载，保持当前相位
+        skipped = ticks - 1;
+        remain = SysTick->VAL + 1;
+    }
+    else
+    {
+        // 被其他中断提前唤醒：按已经过的周期补偿（进入时扣除的周期已含在 total - VAL 中）
+        uint32_t elapsed = total - SysTick->VAL;
+        if (elapsed < val)
+        {
+            skipped = 0;
+            remain = val - elapsed;
+        }
+        else
+        {
+            skipped = 1 + (elapsed - val) / cpt;
+            remain = cpt - (elapsed - val) % cpt;
+        }
+    }
+    // 扣除本次停止的周期，停止期间跨过节拍边界时计入跳过的节拍
+    uint32_t lost = DWT->CYCCNT - stop;
+    if (remain > lost)
+    {
+        remain -= lost;
+    }
+    else
+    {
+        uint32_t over = lost - remain;
+        skipped += 1 + over / cpt;
+        remain = cpt - over % cpt;
+    }
+    SysTick->LOAD = (remain > 1) ? remain - 1 : 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = cpt - 1;
+
+    Systick_time += skipped;
+    for (uint32_t i = 0; i < skipped; i++)
+    {
+        df_timer_tick(); // 跳过的节拍内没有定时器到期，只推进时间轮
+    }
+    (void)get_cycles64(); /* 跟踪 CYCCNT 回绕 */
+    return skipped;
 }
 
 // DF_INIT_EXPORT(systick_init, DF_INIT_EXPORT_PREV);
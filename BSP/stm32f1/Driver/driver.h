@@ -30,6 +30,15 @@ extern df_iic_t i2c1_bus; /* 外部软件I2C总线 */
 #define MPU6050_NAME "mpu6050_sensor"
 #define ADC1_NAME "adc1"
 
+/*============================ 设备编号定义 ============================*/
+/* Dev_info_poor 中的下标，编译期确定：&Dev_info_poor[DEV_ID_xxx] 即设备句柄 */
+enum
+{
+    DEV_ID_OLED = 0,
+    DEV_ID_MPU6050,
+    DEV_ID_NUM
+};
+
 /*============================ NVIC 接口 ============================*/
 void NVIC_Init(void);
 int nvic_init(df_arg_t arg);
@@ -48,7 +57,16 @@ void Systick_Init_Polling(void);
 void Systick_Delay_us(uint32_t us);
 void Systick_Delay_ms(uint32_t ms);
 systick_mode_t Systick_GetMode(void);
+uint32_t Systick_Sleep(uint32_t ticks);
+uint64_t Systick_GetTime(uint32_t *cycles);
+uint32_t Systick_GetPeriod(void);
 int systick_init(df_arg_t arg);
+uint32_t get_tick(void);
+
+/* DWT 周期计数（64位扩展）与微秒时间戳 */
+void dwt_cycle_init(void);
+uint64_t get_cycles64(void);
+uint64_t get_time_us(void);
 
 /*============================ 延时接口 ============================*/
 void delay_ms(uint32_t ms);
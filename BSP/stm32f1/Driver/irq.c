@@ -29,8 +29,8 @@ void USART1_IRQHandler(void)
     // 使用 f103_usart 接口检查数据是否可读
     if (f103_usart_available(F103_USART1))
     {
-        // 处理Shell命令
-        BIE_UART(0, &Shell_Sysfpoint, &Shell, env_vars, &STM32F103C8T6_Device);
+        // 放入Shell接收队列，由主循环 shell_task 处理
+        shell_rx_push(&Shell, f103_usart_recv_char(F103_USART1));
 
         // 清除接收中断标志（直接访问寄存器以保证中断处理速度）
         USART1->SR &= ~USART_SR_RXNE;
@@ -14,6 +14,7 @@
 int usart1_init(df_arg_t arg);
 int usart1_deinit(df_arg_t arg);
 int usart1_send(df_arg_t arg);
+int usart1_write(const void *data, size_t len);
 int usart1_receive(df_arg_t arg);
 static int usart1_printf(const char *format, ...);
 
@@ -26,6 +27,7 @@ df_uart_t Debug = {
     .init = usart1_init,
     .deinit = usart1_deinit,
     .send = usart1_send,
+    .write = usart1_write,
     .printf = usart1_printf,
     .receive = usart1_receive,
     .send_dma = NULL,
@@ -77,6 +79,18 @@ int usart1_send(df_arg_t arg)
     return 0;
 }
 
+/**
+ * @brief 按长度发送数据
+ */
+int usart1_write(const void *data, size_t len)
+{
+    if (data == NULL)
+        return -1;
+
+    f103_usart_send_data(F103_USART1, (const uint8_t *)data, (uint32_t)len);
+    return 0;
+}
+
 /**
  * @brief 接收数据
  */
@@ -148,6 +162,14 @@ static void usart1_log_output(const char *str)
     f103_usart_send_string(F103_USART1, str);
 }
 
+/**
+ * @brief USART1 日志二进制输出函数（延迟日志记录）
+ */
+static void usart1_log_write(const void *data, size_t len)
+{
+    usart1_write(data, len);
+}
+
 /**
  * @brief USART1 自动初始化函数
  * @note 通过 DF_BOARD_INIT 宏在系统启动时自动调用
@@ -155,6 +177,7 @@ static void usart1_log_output(const char *str)
 static int usart1_auto_init(void)
 {
     g_log_config.output_func = usart1_log_output;
+    g_log_config.write_func = usart1_log_write;
     LOG_I("USART1", "USART1 initialized with baud rate %d", Debug.baudrate);
     return usart1_init(arg_null);
 }
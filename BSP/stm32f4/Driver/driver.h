@@ -41,6 +41,15 @@ void Systick_Init_Polling(void);
 void Systick_Delay_us(uint32_t us);
 void Systick_Delay_ms(uint32_t ms);
 systick_mode_t Systick_GetMode(void);
+uint32_t Systick_Sleep(uint32_t ticks);
+uint64_t Systick_GetTime(uint32_t *cycles);
+uint32_t Systick_GetPeriod(void);
+uint32_t get_tick(void);
+
+/* DWT 周期计数（64位扩展）与微秒时间戳 */
+void dwt_cycle_init(void);
+uint64_t get_cycles64(void);
+uint64_t get_time_us(void);
 
 /*============================ LED 接口 ============================*/
 int led_init(df_arg_t arg);
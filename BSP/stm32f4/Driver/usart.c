@@ -12,13 +12,49 @@
 #include "f407_usart.h"
 #include <stdarg.h>
 
+#ifdef LOG_USE_DMA
+#include "df_log_dma.h"
+#endif
+
 /*============================ 内部变量 ============================*/
 static f407_usart_handle_t usart1_handle;
 
+#ifdef LOG_USE_DMA
+/* 阻塞发送占用串口期间禁止启动日志 DMA（DMA 与 CPU 同时写 DR 会交错） */
+static volatile uint32_t usart1_tx_hold = 0;
+
+/**
+ * @brief 阻塞发送前等待日志 DMA 传输结束并占住串口
+ * @note 轮询数据流 EN 位而不是等待完成中断，在更高优先级的中断中调用也不会死锁
+ */
+static void usart1_tx_acquire(void)
+{
+    __atomic_add_fetch(&usart1_tx_hold, 1, __ATOMIC_ACQ_REL);
+    while (usart1_handle.tx_dma != NULL && (usart1_handle.tx_dma->CR & DMA_SxCR_EN))
+        ;
+    (void)f407_usart_wait_tx_complete(&usart1_handle, F407_USART_TIMEOUT);
+}
+
+/**
+ * @brief 释放串口，继续发送积压的日志
+ */
+static void usart1_tx_release(void)
+{
+    if (__atomic_sub_fetch(&usart1_tx_hold, 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        log_dma_kick();
+    }
+}
+#else
+#define usart1_tx_acquire() ((void)0)
+#define usart1_tx_release() ((void)0)
+#endif
+
 /*============================ 前向声明 ============================*/
 int usart1_init(df_arg_t arg);
 int usart1_deinit(df_arg_t arg);
 int usart1_send(df_arg_t arg);
+int usart1_write(const void *data, size_t len);
 int usart1_receive(df_arg_t arg);
 static int usart1_printf(const char *format, ...);
 
@@ -31,6 +67,7 @@ df_uart_t Debug = {
     .init = usart1_init,
     .deinit = usart1_deinit,
     .send = usart1_send,
+    .write = usart1_write,
     .printf = usart1_printf,
     .receive = usart1_receive,
     .send_dma = NULL,
@@ -82,7 +119,31 @@ int usart1_send(df_arg_t arg)
     if (arg.ptr == NULL)
         return -1;
 
+    usart1_tx_acquire();
     f407_usart_send_string(&usart1_handle, (const char *)arg.ptr);
+    usart1_tx_release();
+    return 0;
+}
+
+/**
+ * @brief 按长度发送数据
+ * @note f407_usart_send 的长度为16位，超过 UINT16_MAX 时分段发送
+ */
+int usart1_write(const void *data, size_t len)
+{
+    if (data == NULL)
+        return -1;
+
+    const uint8_t *p = (const uint8_t *)data;
+    usart1_tx_acquire();
+    while (len > 0)
+    {
+        uint16_t n = (len > UINT16_MAX) ? UINT16_MAX : (uint16_t)len;
+        f407_usart_send(&usart1_handle, p, n);
+        p += n;
+        len -= n;
+    }
+    usart1_tx_release();
     return 0;
 }
 
@@ -111,7 +172,9 @@ static int usart1_printf(const char *format, ...)
 
     va_end(args);
 
+    usart1_tx_acquire();
     f407_usart_send_string(&usart1_handle, buffer);
+    usart1_tx_release();
     return len;
 }
 
@@ -122,7 +185,9 @@ static int usart1_printf(const char *format, ...)
  */
 int __io_putchar(int ch)
 {
+    usart1_tx_acquire();
     f407_usart_send_byte(&usart1_handle, (uint8_t)ch);
+    usart1_tx_release();
     return ch;
 }
 
@@ -140,7 +205,9 @@ int printf(const char *format, ...)
 
     va_end(args);
 
+    usart1_tx_acquire();
     f407_usart_send_string(&usart1_handle, buffer);
+    usart1_tx_release();
     return len;
 }
 #endif
@@ -152,9 +219,55 @@ int printf(const char *format, ...)
  */
 static void usart1_log_send(const char *data)
 {
+    usart1_tx_acquire();
     f407_usart_send_string(&usart1_handle, data);
+    usart1_tx_release();
 }
 
+/**
+ * @brief 用于日志系统的二进制发送函数（延迟日志记录）
+ */
+static void usart1_log_write(const void *data, size_t len)
+{
+    usart1_write(data, len);
+}
+
+#ifdef LOG_USE_DMA
+/*============================ 日志 DMA 输出 ============================*/
+
+/**
+ * @brief 启动日志 DMA 发送（USART1_TX: DMA2 Stream7 Ch4）
+ * @note DMA 传输计数为16位，超过 UINT16_MAX 的长度返回 -1
+ */
+static int usart1_log_dma_start(const void *data, size_t len)
+{
+    if (len > UINT16_MAX || __atomic_load_n(&usart1_tx_hold, __ATOMIC_ACQUIRE) != 0)
+        return -1;
+    return f407_usart_dma_send(&usart1_handle, data, (uint16_t)len);
+}
+
+static const log_dma_port_t usart1_log_dma_port = {
+    .start = usart1_log_dma_start};
+
+/**
+ * @brief 日志改为 DMA 双缓冲输出
+ */
+static int usart1_log_dma_init(void)
+{
+    if (f407_usart_dma_tx_init(&usart1_handle, 2, log_dma_tx_complete) != 0)
+        return -1;
+    return log_dma_init(&usart1_log_dma_port);
+}
+
+/**
+ * @brief USART1 发送 DMA 中断
+ */
+void DMA2_Stream7_IRQHandler(void)
+{
+    f407_usart_dma_tx_irq_handler(&usart1_handle);
+}
+#endif
+
 /*============================ 片上外设自动初始化 ============================*/
 
 /**
@@ -166,7 +279,11 @@ static int usart1_auto_init(void)
     int ret = usart1_init(arg_null);
     if (ret == 0)
     {
-        g_log_config.output_func = usart1_send;
+        g_log_config.output_func = usart1_log_send;
+        g_log_config.write_func = usart1_log_write;
+#ifdef LOG_USE_DMA
+        usart1_log_dma_init();
+#endif
         LOG_I("USART1", "USART1 initialized with baud rate %d", Debug.baudrate);
     }
     return ret;
@@ -28,6 +28,32 @@ static const uint32_t usart_clk_table[F407_USART_MAX] = {
     F407_USART1_CLK, F407_USART2_CLK, F407_USART3_CLK,
     F407_UART4_CLK, F407_UART5_CLK, F407_USART6_CLK};
 
+/* DMA发送数据流映射表 */
+typedef struct
+{
+    DMA_TypeDef *dma;           // DMA控制器
+    DMA_Stream_TypeDef *stream; // 数据流
+    uint8_t stream_num;         // 数据流编号(0-7)
+    uint8_t channel;            // 通道选择
+    IRQn_Type irqn;             // 数据流中断号
+} usart_dma_tx_map_t;
+
+static const usart_dma_tx_map_t usart_dma_tx_table[F407_USART_MAX] = {
+    {DMA2, DMA2_Stream7, 7, 4, DMA2_Stream7_IRQn},
+    {DMA1, DMA1_Stream6, 6, 4, DMA1_Stream6_IRQn},
+    {DMA1, DMA1_Stream3, 3, 4, DMA1_Stream3_IRQn},
+    {DMA1, DMA1_Stream4, 4, 4, DMA1_Stream4_IRQn},
+    {DMA1, DMA1_Stream7, 7, 4, DMA1_Stream7_IRQn},
+    {DMA2, DMA2_Stream6, 6, 5, DMA2_Stream6_IRQn}};
+
+/* 各数据流在 LISR/HISR 中的标志位偏移(数据流0/4, 1/5, 2/6, 3/7) */
+static const uint8_t dma_flag_shift[4] = {0, 6, 16, 22};
+
+/* FEIF | DMEIF | TEIF | HTIF | TCIF */
+#define DMA_FLAG_ALL 0x3DUL
+#define DMA_FLAG_TEIF 0x08UL
+#define DMA_FLAG_TCIF 0x20UL
+
 /*===========================================================================*/
 /*                              时钟控制                                      */
 /*===========================================================================*/
@@ -220,6 +246,9 @@ int f407_usart_init(f407_usart_handle_t *handle, const f407_usart_config_t *conf
     handle->rx_size = 0;
     handle->rx_head = 0;
     handle->rx_tail = 0;
+    handle->tx_dma = NULL;
+    handle->tx_busy = false;
+    handle->tx_done = NULL;
 
     USART_TypeDef *usart = handle->instance;
 
@@ -326,6 +355,16 @@ void f407_usart_deinit(f407_usart_handle_t *handle)
     /* 禁用中断 */
     NVIC_DisableIRQ(usart_irq_table[handle->config.usart]);
 
+    /* 关闭DMA发送 */
+    if (handle->tx_dma != NULL)
+    {
+        handle->tx_dma->CR &= ~DMA_SxCR_EN;
+        handle->instance->CR3 &= ~USART_CR3_DMAT;
+        NVIC_DisableIRQ(usart_dma_tx_table[handle->config.usart].irqn);
+        handle->tx_dma = NULL;
+        handle->tx_busy = false;
+    }
+
     /* 禁用时钟 */
     f407_usart_clk_disable(handle->config.usart);
 
@@ -638,6 +677,127 @@ void f407_usart_irq_handler(f407_usart_handle_t *handle)
     }
 }
 
+/*===========================================================================*/
+/*                              DMA发送                                       */
+/*===========================================================================*/
+
+/**
+ * @brief 读取数据流中断标志(已移到bit0起始)
+ */
+static uint32_t usart_dma_get_flags(const usart_dma_tx_map_t *map)
+{
+    uint32_t isr = (map->stream_num < 4) ? map->dma->LISR : map->dma->HISR;
+    return (isr >> dma_flag_shift[map->stream_num & 3]) & DMA_FLAG_ALL;
+}
+
+/**
+ * @brief 清除数据流全部中断标志
+ */
+static void usart_dma_clear_flags(const usart_dma_tx_map_t *map)
+{
+    uint32_t mask = DMA_FLAG_ALL << dma_flag_shift[map->stream_num & 3];
+
+    if (map->stream_num < 4)
+        map->dma->LIFCR = mask;
+    else
+        map->dma->HIFCR = mask;
+}
+
+/**
+ * @brief 初始化USART DMA发送
+ */
+int f407_usart_dma_tx_init(f407_usart_handle_t *handle, uint8_t priority, f407_usart_tx_done_t done)
+{
+    if (handle == NULL || !handle->initialized)
+        return -1;
+
+    const usart_dma_tx_map_t *map = &usart_dma_tx_table[handle->config.usart];
+    DMA_Stream_TypeDef *stream = map->stream;
+
+    /* 使能DMA时钟 */
+    RCC->AHB1ENR |= (map->dma == DMA1) ? RCC_AHB1ENR_DMA1EN : RCC_AHB1ENR_DMA2EN;
+    __DSB();
+
+    /* 关闭数据流并等待EN清零后才能修改配置 */
+    stream->CR &= ~DMA_SxCR_EN;
+    while (stream->CR & DMA_SxCR_EN)
+        ;
+    usart_dma_clear_flags(map);
+
+    /* 存储器到外设, 字节宽度, 存储器地址递增, 直接模式 */
+    stream->PAR = (uint32_t)&handle->instance->DR;
+    stream->CR = ((uint32_t)map->channel * DMA_SxCR_CHSEL_0) | DMA_SxCR_MINC | DMA_SxCR_DIR_0 |
+                 DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+    stream->FCR = 0;
+
+    handle->tx_dma = stream;
+    handle->tx_busy = false;
+    handle->tx_done = done;
+
+    /* USART发送DMA请求 */
+    handle->instance->CR3 |= USART_CR3_DMAT;
+
+    NVIC_SetPriority(map->irqn, priority);
+    NVIC_EnableIRQ(map->irqn);
+
+    return 0;
+}
+
+/**
+ * @brief 启动DMA发送
+ */
+int f407_usart_dma_send(f407_usart_handle_t *handle, const void *data, uint16_t len)
+{
+    if (handle == NULL || handle->tx_dma == NULL || data == NULL || len == 0)
+        return -1;
+    if (handle->tx_busy)
+        return -1;
+
+    const usart_dma_tx_map_t *map = &usart_dma_tx_table[handle->config.usart];
+    DMA_Stream_TypeDef *stream = handle->tx_dma;
+
+    handle->tx_busy = true;
+    usart_dma_clear_flags(map);
+    stream->M0AR = (uint32_t)data;
+    stream->NDTR = len;
+    stream->CR |= DMA_SxCR_EN;
+
+    return 0;
+}
+
+/**
+ * @brief 查询DMA发送是否进行中
+ */
+bool f407_usart_dma_tx_busy(f407_usart_handle_t *handle)
+{
+    if (handle == NULL)
+        return false;
+    return handle->tx_busy;
+}
+
+/**
+ * @brief DMA发送中断处理
+ * @note 传输错误同样结束本次发送并回调，保证上层发送流水线不会卡死
+ */
+void f407_usart_dma_tx_irq_handler(f407_usart_handle_t *handle)
+{
+    if (handle == NULL || handle->tx_dma == NULL)
+        return;
+
+    const usart_dma_tx_map_t *map = &usart_dma_tx_table[handle->config.usart];
+    uint32_t flags = usart_dma_get_flags(map);
+
+    usart_dma_clear_flags(map);
+    if (!(flags & (DMA_FLAG_TCIF | DMA_FLAG_TEIF)))
+        return;
+
+    handle->tx_busy = false;
+    if (handle->tx_done != NULL)
+    {
+        handle->tx_done();
+    }
+}
+
 /*===========================================================================*/
 /*                              辅助功能                                      */
 /*===========================================================================*/
@@ -137,6 +137,11 @@ extern "C"
      */
     typedef void (*f407_usart_rx_callback_t)(uint8_t data);
 
+    /**
+     * @brief DMA发送完成回调函数类型（在DMA中断中调用）
+     */
+    typedef void (*f407_usart_tx_done_t)(void);
+
     /**
      * @brief USART句柄结构体
      */
@@ -152,6 +157,11 @@ extern "C"
         uint16_t rx_size;          // 缓冲区大小
         volatile uint16_t rx_head; // 环形缓冲区头指针
         volatile uint16_t rx_tail; // 环形缓冲区尾指针
+
+        /* DMA发送 */
+        DMA_Stream_TypeDef *tx_dma;   // 发送DMA数据流(未初始化为NULL)
+        volatile bool tx_busy;        // DMA发送进行中
+        f407_usart_tx_done_t tx_done; // 发送完成回调
     } f407_usart_handle_t;
 
     /*===========================================================================*/
@@ -362,6 +372,49 @@ extern "C"
      */
     void f407_usart_irq_handler(f407_usart_handle_t *handle);
 
+    /*===========================================================================*/
+    /*                              DMA发送API                                    */
+    /*===========================================================================*/
+
+    /*
+     * 发送数据流映射(DMA1/DMA2 请求映射表):
+     *   USART1: DMA2 Stream7 Ch4    USART2: DMA1 Stream6 Ch4
+     *   USART3: DMA1 Stream3 Ch4    UART4:  DMA1 Stream4 Ch4
+     *   UART5:  DMA1 Stream7 Ch4    USART6: DMA2 Stream6 Ch5
+     * 发送缓冲区须位于 SRAM1/SRAM2，DMA 无法访问 CCM RAM
+     */
+
+    /**
+     * @brief 初始化USART DMA发送
+     * @param handle USART句柄指针(需已初始化)
+     * @param priority DMA中断优先级
+     * @param done 发送完成回调，可为NULL
+     * @return 0:成功, -1:失败
+     */
+    int f407_usart_dma_tx_init(f407_usart_handle_t *handle, uint8_t priority, f407_usart_tx_done_t done);
+
+    /**
+     * @brief 启动DMA发送(非阻塞)
+     * @param handle USART句柄指针
+     * @param data 发送数据指针，传输完成前不可修改
+     * @param len 数据长度(1-65535)
+     * @return 0:成功, -1:忙或参数错误
+     */
+    int f407_usart_dma_send(f407_usart_handle_t *handle, const void *data, uint16_t len);
+
+    /**
+     * @brief 查询DMA发送是否进行中
+     * @param handle USART句柄指针
+     * @return true:进行中, false:空闲
+     */
+    bool f407_usart_dma_tx_busy(f407_usart_handle_t *handle);
+
+    /**
+     * @brief DMA发送中断处理(需在对应 DMAx_Streamy_IRQHandler 中调用)
+     * @param handle USART句柄指针
+     */
+    void f407_usart_dma_tx_irq_handler(f407_usart_handle_t *handle);
+
     /*===========================================================================*/
     /*                              辅助功能API                                   */
     /*===========================================================================*/
@@ -0,0 +1,112 @@
+/**
+ * @file bench_port.h
+ * @brief 基准测试计时移植层
+ * @details 目标板：Cortex-M DWT 周期计数器 (CYCCNT)，软件扩展为64位，ns 由 SystemCoreClock 换算
+ *          主机：  x86 TSC 计数 + CLOCK_MONOTONIC 纳秒时间
+ * @note DWT 寄存器按地址直接访问，不依赖具体芯片头文件，M3/M4 通用
+ */
+
+#ifndef __BENCH_PORT_H
+#define __BENCH_PORT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(__arm__) || defined(__ARM_ARCH)
+
+/*============================ Cortex-M DWT ============================*/
+
+#define BENCH_DEMCR (*(volatile uint32_t *)0xE000EDFCUL)      // 调试异常与监控控制寄存器
+#define BENCH_DWT_CTRL (*(volatile uint32_t *)0xE0001000UL)   // DWT 控制寄存器
+#define BENCH_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004UL) // DWT 周期计数器
+#define BENCH_DEMCR_TRCENA (1UL << 24)
+#define BENCH_DWT_CTRL_CYCCNTENA (1UL << 0)
+
+    extern uint32_t SystemCoreClock;
+
+    static inline void bench_port_init(void)
+    {
+        BENCH_DEMCR |= BENCH_DEMCR_TRCENA;
+        BENCH_DWT_CYCCNT = 0;
+        BENCH_DWT_CTRL |= BENCH_DWT_CTRL_CYCCNTENA;
+    }
+
+    /**
+     * @brief 读取64位周期计数
+     * @note CYCCNT 为32位，72MHz 下约59秒回绕一次，两次调用间隔须小于回绕周期
+     */
+    static inline uint64_t bench_port_cycles(void)
+    {
+        static uint32_t last = 0;
+        static uint32_t high = 0;
+        uint32_t now = BENCH_DWT_CYCCNT;
+
+        if (now < last)
+            high++;
+        last = now;
+        return ((uint64_t)high << 32) | now;
+    }
+
+    static inline uint64_t bench_port_ns(void)
+    {
+        return bench_port_cycles() * 1000ULL / (SystemCoreClock / 1000000UL);
+    }
+
+    static inline uint32_t bench_port_cpu_hz(void)
+    {
+        return SystemCoreClock;
+    }
+
+#define BENCH_PORT_NAME "cortex-m-dwt"
+
+#else
+
+/*============================ 主机 ============================*/
+
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+    static inline void bench_port_init(void)
+    {
+    }
+
+    static inline uint64_t bench_port_ns(void)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    }
+
+    /**
+     * @brief 读取周期计数
+     * @note x86 上为 TSC 参考周期（恒定频率），不是实际内核周期
+     */
+    static inline uint64_t bench_port_cycles(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return bench_port_ns();
+#endif
+    }
+
+    static inline uint32_t bench_port_cpu_hz(void)
+    {
+        return 0; /* 主机频率不固定，不作换算 */
+    }
+
+#define BENCH_PORT_NAME "host-tsc"
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BENCH_PORT_H */
@@ -0,0 +1,334 @@
+/**
+ * @file ctrl_bench.c
+ * @brief 滤波器与PID基准测试实现
+ */
+
+#include "ctrl_bench.h"
+#include "bench_port.h"
+#include "filter.h"
+#include "filter_fixed.h"
+#include "pid.h"
+#include "pid_bank.h"
+#include "pid_cascade.h"
+#include "pid_fixed.h"
+#include <math.h>
+#include <string.h>
+
+/*============================================================================
+ *                              测试输入
+ *============================================================================*/
+
+#define BENCH_INPUT_SIZE 256 // 输入表长度（2的幂）
+#define BENCH_INPUT_MASK (BENCH_INPUT_SIZE - 1)
+#define BENCH_PID_CHANNELS 16 // 多通道用例的通道数，每个通道更新计为一个样本
+
+static float bench_input[BENCH_INPUT_SIZE];
+static q15_t bench_input_q15[BENCH_INPUT_SIZE]; // 定点用例的输入，bench_input 缩小到 1/4 后转换
+static q31_t bench_input_q31[BENCH_INPUT_SIZE];
+static volatile float bench_sink; // 防止结果被优化掉
+
+/**
+ * @brief 生成输入信号：正弦 + 伪随机噪声 + 偶发尖峰
+ * @note 使用固定种子，保证每次运行输入一致
+ */
+static void bench_input_init(void)
+{
+    uint32_t seed = 0x12345678u;
+
+    for (int i = 0; i < BENCH_INPUT_SIZE; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        float noise = ((float)(seed >> 8) / 16777216.0f - 0.5f) * 0.2f;
+        float spike = (i % 37 == 0) ? 2.0f : 0.0f;
+        bench_input[i] = sinf(6.2831853f * (float)i / BENCH_INPUT_SIZE) + noise + spike;
+        bench_input_q15[i] = Q15_FromFloat(bench_input[i] * 0.25f);
+        bench_input_q31[i] = Q31_FromFloat(bench_input[i] * 0.25f);
+    }
+}
+
+/*============================================================================
+ *                              测试用例
+ *============================================================================*/
+
+static union
+{
+    LowPassFilter_t lowpass;
+    MovingAvgFilter_t moving_avg;
+    MedianFilter_t median;
+    KalmanFilter_t kalman;
+    Butterworth2Filter_t butterworth;
+    LimitAvgFilter_t limit_avg;
+    PID_Controller_t pid;
+    PID_Incremental_t pid_inc;
+    PID_Controller_t pid_multi[BENCH_PID_CHANNELS];
+    PID_Bank_t pid_bank;
+    PID_Cascade_t pid_cascade;
+    Butterworth2_Fixed_t butterworth_fixed;
+    Kalman_Fixed_t kalman_fixed;
+    PID_Fixed_t pid_fixed;
+    PID_Inc_Fixed_t pid_inc_fixed;
+} bench_state;
+
+static PID_Config_t bench_pid_config = {
+    .Kp = 1.2f,
+    .Ki = 0.5f,
+    .Kd = 0.05f,
+    .dt = 0.001f,
+    .output_max = 100.0f,
+    .output_min = -100.0f,
+    .integral_max = 50.0f,
+    .integral_min = -50.0f,
+    .deadband = 0.0f,
+    .anti_windup = 1,
+    .derivative_on_measurement = 1};
+
+/* 各用例的循环体保持一致：取输入 -> 调用被测函数 -> 写入 sink */
+#define BENCH_LOOP(n, call)                                \
+    do                                                     \
+    {                                                      \
+        for (uint32_t i = 0; i < (n); i++)                 \
+        {                                                  \
+            float in = bench_input[i & BENCH_INPUT_MASK];  \
+            bench_sink = call;                             \
+        }                                                  \
+    } while (0)
+
+/* 定点用例：输入取自对应的定点输入表 */
+#define BENCH_LOOP_Q(n, table, call)                    \
+    do                                                  \
+    {                                                   \
+        for (uint32_t i = 0; i < (n); i++)              \
+        {                                               \
+            int32_t in = (table)[i & BENCH_INPUT_MASK]; \
+            bench_sink = (float)(call);                 \
+        }                                               \
+    } while (0)
+
+static void bench_lowpass_init(void) { LowPass_Init(&bench_state.lowpass, 0.2f); }
+static void bench_lowpass_run(uint32_t n) { BENCH_LOOP(n, LowPass_Update(&bench_state.lowpass, in)); }
+
+static void bench_moving_avg_init(void) { MovingAvg_Init(&bench_state.moving_avg); }
+static void bench_moving_avg_run(uint32_t n) { BENCH_LOOP(n, MovingAvg_Update(&bench_state.moving_avg, in)); }
+
+static void bench_median_init(void) { Median_Init(&bench_state.median); }
+static void bench_median_run(uint32_t n) { BENCH_LOOP(n, Median_Update(&bench_state.median, in)); }
+
+static void bench_kalman_init(void) { Kalman_Init(&bench_state.kalman, 0.01f, 0.1f, 0.0f); }
+static void bench_kalman_run(uint32_t n) { BENCH_LOOP(n, Kalman_Update(&bench_state.kalman, in)); }
+
+static void bench_butterworth_init(void) { Butterworth2_Init(&bench_state.butterworth, 50.0f, 1000.0f); }
+static void bench_butterworth_run(uint32_t n) { BENCH_LOOP(n, Butterworth2_Update(&bench_state.butterworth, in)); }
+
+static void bench_limit_avg_init(void) { LimitAvg_Init(&bench_state.limit_avg, 0.5f); }
+static void bench_limit_avg_run(uint32_t n) { BENCH_LOOP(n, LimitAvg_Update(&bench_state.limit_avg, in)); }
+
+static void bench_pid_init(void)
+{
+    PID_Init(&bench_state.pid, &bench_pid_config);
+    PID_SetSetpoint(&bench_state.pid, 0.5f);
+}
+static void bench_pid_run(uint32_t n) { BENCH_LOOP(n, PID_Update(&bench_state.pid, in)); }
+
+static void bench_pid_inc_init(void)
+{
+    PID_Inc_Init(&bench_state.pid_inc, &bench_pid_config);
+    PID_Inc_SetSetpoint(&bench_state.pid_inc, 0.5f);
+}
+static void bench_pid_inc_run(uint32_t n) { BENCH_LOOP(n, PID_Inc_Update(&bench_state.pid_inc, in)); }
+
+/* 多通道：逐个调用 PID_Update 与 PID_Bank_Update 一次更新全部通道，配置相同 */
+static void bench_pid_multi_init(void)
+{
+    for (int ch = 0; ch < BENCH_PID_CHANNELS; ch++)
+    {
+        PID_Init(&bench_state.pid_multi[ch], &bench_pid_config);
+        PID_SetSetpoint(&bench_state.pid_multi[ch], 0.5f);
+    }
+}
+static void bench_pid_multi_run(uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i += BENCH_PID_CHANNELS)
+    {
+        for (int ch = 0; ch < BENCH_PID_CHANNELS; ch++)
+        {
+            bench_sink = PID_Update(&bench_state.pid_multi[ch], bench_input[(i + ch) & BENCH_INPUT_MASK]);
+        }
+    }
+}
+
+static void bench_pid_bank_init(void)
+{
+    PID_Bank_Init(&bench_state.pid_bank, BENCH_PID_CHANNELS);
+    for (uint32_t ch = 0; ch < BENCH_PID_CHANNELS; ch++)
+    {
+        PID_Bank_Config(&bench_state.pid_bank, ch, &bench_pid_config);
+        PID_Bank_SetSetpoint(&bench_state.pid_bank, ch, 0.5f);
+    }
+}
+static void bench_pid_bank_run(uint32_t n)
+{
+    float out[BENCH_PID_CHANNELS];
+
+    for (uint32_t i = 0; i < n; i += BENCH_PID_CHANNELS)
+    {
+        PID_Bank_Update(&bench_state.pid_bank, &bench_input[i & BENCH_INPUT_MASK], out);
+        bench_sink = out[BENCH_PID_CHANNELS - 1];
+    }
+}
+
+/* 串级：内外环均为 bench_pid_config，外环 4 分频 */
+static void bench_pid_cascade_init(void)
+{
+    PID_Cascade_Config_t cfg = {.outer = bench_pid_config, .inner = bench_pid_config, .ratio = 4, .windup_link = 1};
+    PID_Cascade_Init(&bench_state.pid_cascade, &cfg);
+    PID_Cascade_SetSetpoint(&bench_state.pid_cascade, 0.5f);
+}
+static void bench_pid_cascade_run(uint32_t n)
+{
+    BENCH_LOOP(n, PID_Cascade_Update(&bench_state.pid_cascade, in, in * 0.5f));
+}
+
+/* 定点版本，配置与对应的浮点用例相同 (PID 输出限幅超出 [-1, 1)，按满量程饱和) */
+static void bench_butterworth_q15_init(void) { Butterworth2_Fixed_Init(&bench_state.butterworth_fixed, 50.0f, 1000.0f); }
+static void bench_butterworth_q15_run(uint32_t n)
+{
+    BENCH_LOOP_Q(n, bench_input_q15, Butterworth2_Q15_Update(&bench_state.butterworth_fixed, (q15_t)in));
+}
+
+static void bench_kalman_q31_init(void) { Kalman_Fixed_Init(&bench_state.kalman_fixed, 0.01f, 0.1f, 0.0f); }
+static void bench_kalman_q31_run(uint32_t n)
+{
+    BENCH_LOOP_Q(n, bench_input_q31, Kalman_Q31_Update(&bench_state.kalman_fixed, in));
+}
+
+static void bench_pid_q31_init(void)
+{
+    PID_Fixed_Init(&bench_state.pid_fixed, &bench_pid_config);
+    PID_Q31_SetSetpoint(&bench_state.pid_fixed, Q31_FromFloat(0.125f));
+}
+static void bench_pid_q31_run(uint32_t n) { BENCH_LOOP_Q(n, bench_input_q31, PID_Q31_Update(&bench_state.pid_fixed, in)); }
+
+static void bench_pid_inc_q31_init(void)
+{
+    PID_Inc_Fixed_Init(&bench_state.pid_inc_fixed, &bench_pid_config);
+    PID_Inc_Q31_SetSetpoint(&bench_state.pid_inc_fixed, Q31_FromFloat(0.125f));
+}
+static void bench_pid_inc_q31_run(uint32_t n)
+{
+    BENCH_LOOP_Q(n, bench_input_q31, PID_Inc_Q31_Update(&bench_state.pid_inc_fixed, in));
+}
+
+typedef struct
+{
+    const char *name;
+    void (*init)(void);
+    void (*run)(uint32_t n);
+} bench_case_t;
+
+static const bench_case_t bench_cases[CTRL_BENCH_CASE_NUM] = {
+    {"LowPass_Update", bench_lowpass_init, bench_lowpass_run},
+    {"MovingAvg_Update", bench_moving_avg_init, bench_moving_avg_run},
+    {"Median_Update", bench_median_init, bench_median_run},
+    {"Kalman_Update", bench_kalman_init, bench_kalman_run},
+    {"Butterworth2_Update", bench_butterworth_init, bench_butterworth_run},
+    {"LimitAvg_Update", bench_limit_avg_init, bench_limit_avg_run},
+    {"PID_Update", bench_pid_init, bench_pid_run},
+    {"PID_Inc_Update", bench_pid_inc_init, bench_pid_inc_run},
+    {"PID_Update_x16", bench_pid_multi_init, bench_pid_multi_run},
+    {"PID_Bank_Update_x16", bench_pid_bank_init, bench_pid_bank_run},
+    {"PID_Cascade_Update", bench_pid_cascade_init, bench_pid_cascade_run},
+    {"Butterworth2_Q15_Update", bench_butterworth_q15_init, bench_butterworth_q15_run},
+    {"Kalman_Q31_Update", bench_kalman_q31_init, bench_kalman_q31_run},
+    {"PID_Q31_Update", bench_pid_q31_init, bench_pid_q31_run},
+    {"PID_Inc_Q31_Update", bench_pid_inc_q31_init, bench_pid_inc_q31_run},
+};
+
+/*============================================================================
+ *                              测试框架
+ *============================================================================*/
+
+const char *ctrl_bench_opt_level(void)
+{
+#if !defined(__OPTIMIZE__)
+    return "O0";
+#elif defined(__OPTIMIZE_SIZE__)
+    return "Os";
+#else
+    return "O2";
+#endif
+}
+
+int ctrl_bench_run(ctrl_bench_result_t *results, uint32_t samples, uint32_t repeats)
+{
+    if (results == NULL || samples == 0 || repeats == 0)
+        return 0;
+
+    bench_port_init();
+    bench_input_init();
+
+    for (int c = 0; c < CTRL_BENCH_CASE_NUM; c++)
+    {
+        const bench_case_t *bc = &bench_cases[c];
+        ctrl_bench_result_t *res = &results[c];
+        uint64_t cyc_min = UINT64_MAX, ns_min = UINT64_MAX;
+        uint64_t cyc_sum = 0, ns_sum = 0;
+
+        /* 预热：填满滤波窗口、加载缓存 */
+        bc->init();
+        bc->run(BENCH_INPUT_SIZE);
+
+        for (uint32_t r = 0; r < repeats; r++)
+        {
+            bc->init();
+            uint64_t ns0 = bench_port_ns();
+            uint64_t cyc0 = bench_port_cycles();
+            bc->run(samples);
+            uint64_t cyc = bench_port_cycles() - cyc0;
+            uint64_t ns = bench_port_ns() - ns0;
+
+            cyc_sum += cyc;
+            ns_sum += ns;
+            if (cyc < cyc_min)
+                cyc_min = cyc;
+            if (ns < ns_min)
+                ns_min = ns;
+        }
+
+        res->name = bc->name;
+        res->samples = samples;
+        res->repeats = repeats;
+        res->cycles_min = (float)cyc_min / samples;
+        res->cycles_avg = (float)cyc_sum / ((float)samples * repeats);
+        res->ns_min = (float)ns_min / samples;
+        res->ns_avg = (float)ns_sum / ((float)samples * repeats);
+    }
+
+    return CTRL_BENCH_CASE_NUM;
+}
+
+void ctrl_bench_print_json(const ctrl_bench_result_t *results, int count, ctrl_bench_print_t print)
+{
+    if (results == NULL || print == NULL)
+        return;
+
+    print("{\n");
+    print("  \"suite\": \"ctrl_bench\",\n");
+    print("  \"platform\": \"%s\",\n", BENCH_PORT_NAME);
+    print("  \"opt\": \"%s\",\n", ctrl_bench_opt_level());
+    print("  \"compiler\": \"%s\",\n", __VERSION__);
+    print("  \"cpu_hz\": %lu,\n", (unsigned long)bench_port_cpu_hz());
+    print("  \"results\": [\n");
+    for (int i = 0; i < count; i++)
+    {
+        const ctrl_bench_result_t *r = &results[i];
+        print("    {\"name\": \"%s\", \"samples\": %lu, \"repeats\": %lu, "
+              "\"cycles_per_sample\": %.2f, \"cycles_per_sample_avg\": %.2f, "
+              "\"ns_per_sample\": %.2f, \"ns_per_sample_avg\": %.2f}%s\n",
+              r->name, (unsigned long)r->samples, (unsigned long)r->repeats,
+              (double)r->cycles_min, (double)r->cycles_avg,
+              (double)r->ns_min, (double)r->ns_avg,
+              (i + 1 < count) ? "," : "");
+    }
+    print("  ]\n");
+    print("}\n");
+}
@@ -0,0 +1,69 @@
+/**
+ * @file ctrl_bench.h
+ * @brief 滤波器与PID基准测试
+ * @details 测量 filter.c / pid.c / pid_bank.c / pid_cascade.c 及定点版本中各更新函数的单样本开销（周期数与纳秒），
+ *          结果以 JSON 输出，便于不同版本/优化等级之间对比
+ *
+ *          使用示例（目标板）：
+ *          @code
+ *          ctrl_bench_result_t res[CTRL_BENCH_CASE_NUM];
+ *          int n = ctrl_bench_run(res, 2000, 5);
+ *          ctrl_bench_print_json(res, n, printf);
+ *          @endcode
+ */
+
+#ifndef __CTRL_BENCH_H
+#define __CTRL_BENCH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CTRL_BENCH_CASE_NUM 15 // 测试用例数量
+
+    /**
+     * @brief 单个用例的测试结果
+     */
+    typedef struct
+    {
+        const char *name;   // 被测函数名
+        uint32_t samples;   // 每轮样本数
+        uint32_t repeats;   // 轮数
+        float cycles_min;   // 最快一轮的 周期/样本
+        float cycles_avg;   // 平均 周期/样本
+        float ns_min;       // 最快一轮的 纳秒/样本
+        float ns_avg;       // 平均 纳秒/样本
+    } ctrl_bench_result_t;
+
+    /**
+     * @brief 输出函数类型（与 printf / df_uart_t.printf 签名一致）
+     */
+    typedef int (*ctrl_bench_print_t)(const char *format, ...);
+
+    /**
+     * @brief 运行全部用例
+     * @param results 结果数组，至少 CTRL_BENCH_CASE_NUM 个元素
+     * @param samples 每轮样本数
+     * @param repeats 轮数（取最快一轮作为主要结果，排除中断等干扰）
+     * @return 实际完成的用例数
+     */
+    int ctrl_bench_run(ctrl_bench_result_t *results, uint32_t samples, uint32_t repeats);
+
+    /**
+     * @brief 以 JSON 格式输出结果
+     */
+    void ctrl_bench_print_json(const ctrl_bench_result_t *results, int count, ctrl_bench_print_t print);
+
+    /**
+     * @brief 当前编译优化等级 ("O0" / "O2" / "Os" ...)
+     */
+    const char *ctrl_bench_opt_level(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CTRL_BENCH_H */
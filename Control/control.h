@@ -0,0 +1,117 @@
+/**
+ * @file control.h
+ * @brief 控制库数值类型选择
+ * @details 应用代码通过 CTRL_ 前缀的类型与函数使用滤波器和PID，编译时由 CTRL_NUMERIC 选择实现：
+ *          - CTRL_NUMERIC_FLOAT  filter.h / pid.h 的浮点版本 (默认，有 FPU 时使用)
+ *          - CTRL_NUMERIC_Q15    filter_fixed.h / pid_fixed.h 的 Q15 版本
+ *          - CTRL_NUMERIC_Q31    filter_fixed.h / pid_fixed.h 的 Q31 版本
+ *          STM32F103 等软浮点平台在编译选项中加入 -DCTRL_NUMERIC=CTRL_NUMERIC_Q15 (或 _Q31) 即可切换，
+ *          定点版本的信号须归一化到 [-1, 1)，用 CTRL_FROM_FLOAT / CTRL_TO_FLOAT 与物理量互转
+ *
+ * 使用方法：
+ * @code
+ * static CTRL_PID_t pid;
+ * static CTRL_LowPass_t lpf;
+ *
+ * CTRL_PID_Init(&pid, &cfg);
+ * CTRL_LowPass_Init(&lpf, 0.2f);
+ * CTRL_PID_SetSetpoint(&pid, CTRL_FROM_FLOAT(0.5f));
+ * ctrl_t u = CTRL_PID_Update(&pid, CTRL_LowPass_Update(&lpf, measure));
+ * @endcode
+ */
+
+#ifndef __CONTROL_H
+#define __CONTROL_H
+
+#define CTRL_NUMERIC_FLOAT 0
+#define CTRL_NUMERIC_Q15 1
+#define CTRL_NUMERIC_Q31 2
+
+#ifndef CTRL_NUMERIC
+#define CTRL_NUMERIC CTRL_NUMERIC_FLOAT
+#endif
+
+#include "filter.h"
+#include "pid.h"
+
+#if CTRL_NUMERIC == CTRL_NUMERIC_FLOAT
+
+typedef float ctrl_t;
+typedef PID_Controller_t CTRL_PID_t;
+typedef PID_Incremental_t CTRL_PID_Inc_t;
+typedef LowPassFilter_t CTRL_LowPass_t;
+typedef Butterworth2Filter_t CTRL_Butterworth2_t;
+typedef KalmanFilter_t CTRL_Kalman_t;
+
+#define CTRL_FROM_FLOAT(x) (x)
+#define CTRL_TO_FLOAT(x) (x)
+
+#define CTRL_PID_Init PID_Init
+#define CTRL_PID_SetSetpoint PID_SetSetpoint
+#define CTRL_PID_Update PID_Update
+#define CTRL_PID_Reset PID_Reset
+#define CTRL_PID_Inc_Init PID_Inc_Init
+#define CTRL_PID_Inc_SetSetpoint PID_Inc_SetSetpoint
+#define CTRL_PID_Inc_Update PID_Inc_Update
+#define CTRL_PID_Inc_Reset PID_Inc_Reset
+#define CTRL_LowPass_Init LowPass_Init
+#define CTRL_LowPass_Update LowPass_Update
+#define CTRL_LowPass_Reset LowPass_Reset
+#define CTRL_Butterworth2_Init Butterworth2_Init
+#define CTRL_Butterworth2_Update Butterworth2_Update
+#define CTRL_Butterworth2_Reset Butterworth2_Reset
+#define CTRL_Kalman_Init Kalman_Init
+#define CTRL_Kalman_Update Kalman_Update
+#define CTRL_Kalman_Reset Kalman_Reset
+
+#elif CTRL_NUMERIC == CTRL_NUMERIC_Q15 || CTRL_NUMERIC == CTRL_NUMERIC_Q31
+
+#include "filter_fixed.h"
+#include "pid_fixed.h"
+
+typedef PID_Fixed_t CTRL_PID_t;
+typedef PID_Inc_Fixed_t CTRL_PID_Inc_t;
+typedef LowPass_Fixed_t CTRL_LowPass_t;
+typedef Butterworth2_Fixed_t CTRL_Butterworth2_t;
+typedef Kalman_Fixed_t CTRL_Kalman_t;
+
+#define CTRL_PID_Init PID_Fixed_Init
+#define CTRL_PID_Reset PID_Fixed_Reset
+#define CTRL_PID_Inc_Init PID_Inc_Fixed_Init
+#define CTRL_PID_Inc_Reset PID_Inc_Fixed_Reset
+#define CTRL_LowPass_Init LowPass_Fixed_Init
+#define CTRL_LowPass_Reset LowPass_Fixed_Reset
+#define CTRL_Butterworth2_Init Butterworth2_Fixed_Init
+#define CTRL_Butterworth2_Reset Butterworth2_Fixed_Reset
+#define CTRL_Kalman_Init Kalman_Fixed_Init
+#define CTRL_Kalman_Reset Kalman_Fixed_Reset
+
+#if CTRL_NUMERIC == CTRL_NUMERIC_Q15
+typedef q15_t ctrl_t;
+#define CTRL_FROM_FLOAT Q15_FromFloat
+#define CTRL_TO_FLOAT Q15_ToFloat
+#define CTRL_PID_SetSetpoint PID_Q15_SetSetpoint
+#define CTRL_PID_Update PID_Q15_Update
+#define CTRL_PID_Inc_SetSetpoint PID_Inc_Q15_SetSetpoint
+#define CTRL_PID_Inc_Update PID_Inc_Q15_Update
+#define CTRL_LowPass_Update LowPass_Q15_Update
+#define CTRL_Butterworth2_Update Butterworth2_Q15_Update
+#define CTRL_Kalman_Update Kalman_Q15_Update
+#else
+typedef q31_t ctrl_t;
+#define CTRL_FROM_FLOAT Q31_FromFloat
+#define CTRL_TO_FLOAT Q31_ToFloat
+#define CTRL_PID_SetSetpoint PID_Q31_SetSetpoint
+#define CTRL_PID_Update PID_Q31_Update
+#define CTRL_PID_Inc_SetSetpoint PID_Inc_Q31_SetSetpoint
+#define CTRL_PID_Inc_Update PID_Inc_Q31_Update
+#define CTRL_LowPass_Update LowPass_Q31_Update
+#define CTRL_Butterworth2_Update Butterworth2_Q31_Update
+#define CTRL_Kalman_Update Kalman_Q31_Update
+#endif
+
+#else
+#error "CTRL_NUMERIC must be CTRL_NUMERIC_FLOAT, CTRL_NUMERIC_Q15 or CTRL_NUMERIC_Q31"
+#endif
+
+#endif /* __CONTROL_H */
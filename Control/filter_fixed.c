@@ -0,0 +1,259 @@
+/**
+ * @file filter_fixed.c
+ * @brief 定点滤波器实现
+ * @note Q15 更新函数转换到 Q31 后调用同一份计算，结果四舍五入回 Q15
+ */
+
+#include "filter_fixed.h"
+#include "filter.h"
+#include <stddef.h>
+#include <string.h>
+
+/*============================================================================
+ *                              一阶低通滤波器
+ *============================================================================*/
+
+/**
+ * @brief 初始化定点一阶低通滤波器
+ * @param alpha 滤波系数 (0~1)
+ */
+void LowPass_Fixed_Init(LowPass_Fixed_t *filter, float alpha)
+{
+    if (filter == NULL)
+        return;
+
+    filter->alpha = Q_GainFromFloat(alpha);
+    filter->last_output = 0;
+    filter->initialized = 0;
+}
+
+/**
+ * @brief 定点一阶低通滤波更新 (Q31)
+ * @note 公式: y[n] = y[n-1] + alpha * (x[n] - y[n-1])，与浮点版本的
+ *       alpha * x[n] + (1 - alpha) * y[n-1] 相同，少一次乘法
+ */
+q31_t LowPass_Q31_Update(LowPass_Fixed_t *filter, q31_t input)
+{
+    if (filter == NULL)
+        return input;
+
+    if (!filter->initialized)
+    {
+        filter->last_output = input;
+        filter->initialized = 1;
+        return input;
+    }
+
+    int64_t diff = (int64_t)input - filter->last_output;
+    filter->last_output = Q31_Sat(filter->last_output + Q_MulGain(diff, filter->alpha, 0));
+    return filter->last_output;
+}
+
+/**
+ * @brief 定点一阶低通滤波更新 (Q15)
+ */
+q15_t LowPass_Q15_Update(LowPass_Fixed_t *filter, q15_t input)
+{
+    if (filter == NULL)
+        return input;
+    return Q31_ToQ15(LowPass_Q31_Update(filter, Q15_ToQ31(input)));
+}
+
+/**
+ * @brief 重置定点一阶低通滤波器
+ */
+void LowPass_Fixed_Reset(LowPass_Fixed_t *filter)
+{
+    if (filter == NULL)
+        return;
+    filter->last_output = 0;
+    filter->initialized = 0;
+}
+
+/*============================================================================
+ *                              二阶巴特沃斯低通滤波器
+ *============================================================================*/
+
+/**
+ * @brief 初始化定点二阶巴特沃斯低通滤波器
+ * @note 系数由 Butterworth2_Init 计算后换算为 Q2.29，与浮点版本相同
+ */
+void Butterworth2_Fixed_Init(Butterworth2_Fixed_t *filter, float cutoff_freq, float sample_freq)
+{
+    if (filter == NULL)
+        return;
+
+    Butterworth2Filter_t ref;
+    Butterworth2_Init(&ref, cutoff_freq, sample_freq);
+
+    for (int i = 0; i < 3; i++)
+    {
+        filter->a[i] = (int32_t)Q_Int64FromFloat(ref.a[i], BUTTERWORTH2_FIXED_COEF_FRAC - 31, Q31_MAX);
+        filter->b[i] = (int32_t)Q_Int64FromFloat(ref.b[i], BUTTERWORTH2_FIXED_COEF_FRAC - 31, Q31_MAX);
+    }
+
+    Butterworth2_Fixed_Reset(filter);
+}
+
+/**
+ * @brief 定点二阶巴特沃斯低通滤波更新 (Q31)
+ * @note 64 位累加后一次舍入，阶跃响应约 4% 的超调在满量程附近会饱和
+ */
+q31_t Butterworth2_Q31_Update(Butterworth2_Fixed_t *filter, q31_t input)
+{
+    if (filter == NULL)
+        return input;
+
+    if (!filter->initialized)
+    {
+        filter->x[0] = filter->x[1] = filter->x[2] = input;
+        filter->y[0] = filter->y[1] = filter->y[2] = input;
+        filter->initialized = 1;
+        return input;
+    }
+
+    // 移动历史数据
+    filter->x[2] = filter->x[1];
+    filter->x[1] = filter->x[0];
+    filter->x[0] = input;
+
+    filter->y[2] = filter->y[1];
+    filter->y[1] = filter->y[0];
+
+    // 计算输出
+    int64_t acc = (int64_t)filter->b[0] * filter->x[0] + (int64_t)filter->b[1] * filter->x[1] +
+                  (int64_t)filter->b[2] * filter->x[2] - (int64_t)filter->a[1] * filter->y[1] -
+                  (int64_t)filter->a[2] * filter->y[2];
+    filter->y[0] = Q31_Sat(Q_RoundShift(acc, BUTTERWORTH2_FIXED_COEF_FRAC));
+
+    return filter->y[0];
+}
+
+/**
+ * @brief 定点二阶巴特沃斯低通滤波更新 (Q15)
+ */
+q15_t Butterworth2_Q15_Update(Butterworth2_Fixed_t *filter, q15_t input)
+{
+    if (filter == NULL)
+        return input;
+    return Q31_ToQ15(Butterworth2_Q31_Update(filter, Q15_ToQ31(input)));
+}
+
+/**
+ * @brief 重置定点二阶巴特沃斯低通滤波器
+ */
+void Butterworth2_Fixed_Reset(Butterworth2_Fixed_t *filter)
+{
+    if (filter == NULL)
+        return;
+    memset(filter->x, 0, sizeof(filter->x));
+    memset(filter->y, 0, sizeof(filter->y));
+    filter->initialized = 0;
+}
+
+/*============================================================================
+ *                              卡尔曼滤波器
+ *============================================================================*/
+
+#define KALMAN_COV_ONE ((uint32_t)1 << KALMAN_FIXED_COV_FRAC)
+
+/**
+ * @brief 协方差转 Q2.30 (饱和到 [0, 4))
+ */
+static uint32_t Kalman_Fixed_Cov(float value)
+{
+    int64_t cov = Q_Int64FromFloat(value, KALMAN_FIXED_COV_FRAC - 31, UINT32_MAX);
+    return (cov < 0) ? 0 : (uint32_t)cov;
+}
+
+/**
+ * @brief 初始化定点卡尔曼滤波器
+ */
+void Kalman_Fixed_Init(Kalman_Fixed_t *filter, float Q, float R, float initial_value)
+{
+    if (filter == NULL)
+        return;
+
+    filter->Q = Kalman_Fixed_Cov(Q);
+    filter->R = Kalman_Fixed_Cov(R);
+    filter->P = KALMAN_COV_ONE; // 初始估计误差协方差
+    filter->K = 0;
+    filter->X = Q31_FromFloat(initial_value);
+    filter->converged = 0;
+    filter->initialized = 1;
+}
+
+/**
+ * @brief 定点卡尔曼滤波更新 (Q31)
+ */
+q31_t Kalman_Q31_Update(Kalman_Fixed_t *filter, q31_t input)
+{
+    if (filter == NULL)
+        return input;
+
+    if (!filter->initialized)
+    {
+        filter->X = input;
+        filter->initialized = 1;
+        return input;
+    }
+
+    if (!filter->converged)
+    {
+        // P_pred = P + Q
+        uint64_t P = (uint64_t)filter->P + filter->Q;
+        P = (P > UINT32_MAX) ? UINT32_MAX : P;
+
+        // K = P_pred / (P_pred + R)，R 为 0 时 K 饱和到 Q31_MAX
+        uint64_t sum = P + filter->R;
+        uint64_t K = (sum != 0) ? (P << 31) / sum : (uint64_t)Q31_MAX;
+        filter->K = (K > (uint64_t)Q31_MAX) ? Q31_MAX : (q31_t)K;
+
+        // P = (1 - K) * P_pred，P 不再变化时增益已收敛
+        uint32_t P_new = (uint32_t)(P - (((uint64_t)filter->K * P + ((uint64_t)1 << 30)) >> 31));
+        filter->converged = (P_new == filter->P);
+        filter->P = P_new;
+    }
+
+    // X = X_pred + K * (Z - X_pred)
+    int64_t innovation = (int64_t)input - filter->X;
+    filter->X = Q31_Sat(filter->X + Q_RoundShift(innovation * filter->K, 31));
+
+    return filter->X;
+}
+
+/**
+ * @brief 定点卡尔曼滤波更新 (Q15)
+ */
+q15_t Kalman_Q15_Update(Kalman_Fixed_t *filter, q15_t input)
+{
+    if (filter == NULL)
+        return input;
+    return Q31_ToQ15(Kalman_Q31_Update(filter, Q15_ToQ31(input)));
+}
+
+/**
+ * @brief 重置定点卡尔曼滤波器
+ */
+void Kalman_Fixed_Reset(Kalman_Fixed_t *filter)
+{
+    if (filter == NULL)
+        return;
+    filter->P = KALMAN_COV_ONE;
+    filter->K = 0;
+    filter->X = 0;
+    filter->converged = 0;
+    filter->initialized = 0;
+}
+
+/**
+ * @brief 动态调整定点卡尔曼滤波参数，增益重新收敛
+ */
+void Kalman_Fixed_SetParams(Kalman_Fixed_t *filter, float Q, float R)
+{
+    if (filter == NULL)
+        return;
+    filter->Q = Kalman_Fixed_Cov(Q);
+    filter->R = Kalman_Fixed_Cov(R);
+    filter->converged = 0;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file filter_fixed.h
+ * @brief 定点滤波器 (Q15 / Q31)
+ * @details 一阶低通、二阶巴特沃斯 (双二阶节) 与一阶卡尔曼滤波的定点版本，
+ *          与 filter.h 中的浮点版本公式一一对应，用于没有 FPU 的 STM32F103 (-mfloat-abi=soft)：
+ *          - 同一个滤波器结构体同时提供 Q15 与 Q31 更新函数，内部状态统一保存为 Q31，
+ *            Q15 版本只在输入输出处转换，小系数时不会因状态精度不足出现死区
+ *          - 系数在 Init 中由浮点参数换算，更新函数中只有整数运算
+ *          - 信号须按满量程归一化到 [-1, 1)，超出时饱和
+ *
+ * 使用方法：
+ * @code
+ * static Butterworth2_Fixed_t acc_lpf;
+ *
+ * Butterworth2_Fixed_Init(&acc_lpf, 50.0f, 1000.0f);
+ * q15_t acc = Butterworth2_Q15_Update(&acc_lpf, raw >> 1); // 16 位原始数据 -> Q15
+ * @endcode
+ */
+
+#ifndef __FILTER_FIXED_H
+#define __FILTER_FIXED_H
+
+#include <stdint.h>
+#include "fixed.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*============================================================================
+ *                              滤波器配置
+ *============================================================================*/
+#define BUTTERWORTH2_FIXED_COEF_FRAC 29 // 双二阶系数小数位数，系数绝对值之和须小于 8
+#define KALMAN_FIXED_COV_FRAC 30        // 卡尔曼协方差小数位数 (无符号 Q2.30，上限 4.0)
+
+    /*============================================================================
+     *                              滤波器类型定义
+     *============================================================================*/
+
+    /**
+     * @brief 定点一阶低通滤波器
+     */
+    typedef struct
+    {
+        q_gain_t alpha;      // 滤波系数 (0~1)
+        q31_t last_output;   // 上一次输出值
+        uint8_t initialized; // 初始化标志
+    } LowPass_Fixed_t;
+
+    /**
+     * @brief 定点二阶巴特沃斯低通滤波器
+     */
+    typedef struct
+    {
+        int32_t a[3];        // 分母系数 (a0, a1, a2)，Q2.29
+        int32_t b[3];        // 分子系数 (b0, b1, b2)，Q2.29
+        q31_t x[3];          // 输入历史 (x[n], x[n-1], x[n-2])
+        q31_t y[3];          // 输出历史 (y[n], y[n-1], y[n-2])
+        uint8_t initialized; // 初始化标志
+    } Butterworth2_Fixed_t;
+
+    /**
+     * @brief 定点一阶卡尔曼滤波器
+     * @note 增益序列与输入无关，P 不再变化 (收敛) 后跳过协方差更新与除法
+     */
+    typedef struct
+    {
+        uint32_t Q;          // 过程噪声协方差，Q2.30
+        uint32_t R;          // 测量噪声协方差，Q2.30
+        uint32_t P;          // 估计误差协方差，Q2.30
+        q31_t K;             // 卡尔曼增益
+        q31_t X;             // 估计值
+        uint8_t converged;   // 增益已收敛
+        uint8_t initialized; // 初始化标志
+    } Kalman_Fixed_t;
+
+    /*============================================================================
+     *                              函数声明
+     *============================================================================*/
+
+    /* 一阶低通滤波器 */
+    void LowPass_Fixed_Init(LowPass_Fixed_t *filter, float alpha);
+    q15_t LowPass_Q15_Update(LowPass_Fixed_t *filter, q15_t input);
+    q31_t LowPass_Q31_Update(LowPass_Fixed_t *filter, q31_t input);
+    void LowPass_Fixed_Reset(LowPass_Fixed_t *filter);
+
+    /* 二阶巴特沃斯低通滤波器 */
+    void Butterworth2_Fixed_Init(Butterworth2_Fixed_t *filter, float cutoff_freq, float sample_freq);
+    q15_t Butterworth2_Q15_Update(Butterworth2_Fixed_t *filter, q15_t input);
+    q31_t Butterworth2_Q31_Update(Butterworth2_Fixed_t *filter, q31_t input);
+    void Butterworth2_Fixed_Reset(Butterworth2_Fixed_t *filter);
+
+    /* 卡尔曼滤波器 (Q、R 上限 4.0，initial_value 为归一化后的值) */
+    void Kalman_Fixed_Init(Kalman_Fixed_t *filter, float Q, float R, float initial_value);
+    q15_t Kalman_Q15_Update(Kalman_Fixed_t *filter, q15_t input);
+    q31_t Kalman_Q31_Update(Kalman_Fixed_t *filter, q31_t input);
+    void Kalman_Fixed_Reset(Kalman_Fixed_t *filter);
+    void Kalman_Fixed_SetParams(Kalman_Fixed_t *filter, float Q, float R);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FILTER_FIXED_H */
@@ -0,0 +1,58 @@
+/**
+ * @file fixed.c
+ * @brief 定点数转换实现
+ * @note 只在初始化与设置参数时调用，允许使用浮点
+ */
+
+#include "fixed.h"
+#include <math.h>
+
+/**
+ * @brief 浮点增益转定点增益
+ */
+q_gain_t Q_GainFromFloat(float gain)
+{
+    q_gain_t g = {0, Q_GAIN_MIN_SHIFT};
+    int e;
+
+    if (gain == 0.0f || gain != gain)
+        return g;
+
+    // gain = f * 2^e，0.5 <= |f| < 1，尾数 m = f * 2^Q_GAIN_BITS
+    double f = frexp((double)gain, &e);
+    int32_t s = Q_GAIN_BITS - e;
+
+    if (s < Q_GAIN_MIN_SHIFT)
+    {
+        // 增益过大，饱和
+        g.m = (gain > 0.0f) ? (1 << Q_GAIN_BITS) : -(1 << Q_GAIN_BITS);
+        return g;
+    }
+    if (s > Q_GAIN_MAX_SHIFT)
+    {
+        // 增益过小，尾数缩短
+        f = ldexp(f, Q_GAIN_MAX_SHIFT - s);
+        s = Q_GAIN_MAX_SHIFT;
+    }
+
+    double m = ldexp(f, Q_GAIN_BITS);
+    g.m = (int32_t)(m >= 0.0 ? m + 0.5 : m - 0.5);
+    g.s = s;
+    return g;
+}
+
+/**
+ * @brief 浮点数转 Q31 刻度的 int64_t
+ */
+int64_t Q_Int64FromFloat(float x, int32_t frac, int64_t limit)
+{
+    double v = ldexp((double)x, 31 + frac);
+
+    if (x != x)
+        return 0;
+    if (v >= (double)limit)
+        return limit;
+    if (v <= -(double)limit)
+        return -limit;
+    return (int64_t)(v >= 0.0 ? v + 0.5 : v - 0.5);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file fixed.h
+ * @brief 定点数基础运算 (Q15 / Q31)
+ * @details 供 filter_fixed / pid_fixed 使用的类型与内联运算：
+ *          - q15_t / q31_t 表示 [-1, 1) 的小数，信号需先按满量程归一化
+ *          - 饱和：超出范围时取最大/最小值，不回绕
+ *          - 舍入：右移时四舍五入 (0.5 向正方向)，不截断
+ *          - 增益 q_gain_t 为尾数 + 移位 (块浮点)，小系数 (如 Ki·dt) 也保留 27 位有效精度
+ *
+ *          只有 Q15_FromFloat / Q31_FromFloat 等转换函数与 Q_GainFromFloat 使用浮点，
+ *          用于初始化或与浮点代码交界处；更新函数内全部为整数运算
+ *          (Cortex-M3 上为 SMULL/ADDS/ADC 等单周期或数周期指令，软浮点每次乘加需数十周期)
+ */
+
+#ifndef __FIXED_H
+#define __FIXED_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*============================================================================
+ *                              定点配置
+ *============================================================================*/
+#define Q_GAIN_BITS 27      // 增益尾数位数，|m| <= 2^27
+#define Q_GAIN_MIN_SHIFT 16 // 增益最小移位，|增益| < 2^(27-16) = 2048
+#define Q_GAIN_MAX_SHIFT 62 // 增益最大移位，更小的增益损失精度直至为 0
+
+#define Q15_MAX ((q15_t)0x7FFF)
+#define Q15_MIN ((q15_t)-0x8000)
+#define Q31_MAX ((q31_t)0x7FFFFFFF)
+#define Q31_MIN ((q31_t)(-0x7FFFFFFF - 1))
+
+/* Q31 刻度下的 1.0，中间结果以 int64_t 保存时可超出 [-1, 1) */
+#define Q31_ONE_64 ((int64_t)1 << 31)
+
+    /*============================================================================
+     *                              类型定义
+     *============================================================================*/
+
+    typedef int16_t q15_t; // Q1.15，[-1, 1 - 2^-15]
+    typedef int32_t q31_t; // Q1.31，[-1, 1 - 2^-31]
+
+    /**
+     * @brief 定点增益，值为 m * 2^-s
+     * @note 与增益相乘的数 (Q31 刻度，int64_t) 绝对值须小于 2^35 (即 16.0)，乘积不溢出
+     */
+    typedef struct
+    {
+        int32_t m; // 尾数
+        int32_t s; // 右移位数 (Q_GAIN_MIN_SHIFT ~ Q_GAIN_MAX_SHIFT)
+    } q_gain_t;
+
+    /*============================================================================
+     *                              内联运算
+     *============================================================================*/
+
+    /**
+     * @brief 饱和到 Q15
+     */
+    static inline q15_t Q15_Sat(int32_t x)
+    {
+        return (x > Q15_MAX) ? Q15_MAX : ((x < Q15_MIN) ? Q15_MIN : (q15_t)x);
+    }
+
+    /**
+     * @brief 饱和到 Q31
+     */
+    static inline q31_t Q31_Sat(int64_t x)
+    {
+        return (x > Q31_MAX) ? Q31_MAX : ((x < Q31_MIN) ? Q31_MIN : (q31_t)x);
+    }
+
+    /**
+     * @brief 限幅到 [-max, max]
+     */
+    static inline int64_t Q_Clamp(int64_t x, int64_t max)
+    {
+        return (x > max) ? max : ((x < -max) ? -max : x);
+    }
+
+    /**
+     * @brief 四舍五入右移
+     * @note 先移 s-1 位再加 1，不会因加入舍入偏置而溢出
+     */
+    static inline int64_t Q_RoundShift(int64_t x, int32_t s)
+    {
+        return (s > 0) ? (((x >> (s - 1)) + 1) >> 1) : x;
+    }
+
+    /**
+     * @brief 乘以定点增益
+     * @param x 被乘数，|x| < 2^35
+     * @param frac 结果额外保留的小数位数 (不超过 Q_GAIN_MIN_SHIFT)
+     * @return x * 增益 * 2^frac，四舍五入
+     */
+    static inline int64_t Q_MulGain(int64_t x, q_gain_t g, int32_t frac)
+    {
+        return Q_RoundShift(x * g.m, g.s - frac);
+    }
+
+    /**
+     * @brief Q15 转 Q31 (无损)
+     */
+    static inline q31_t Q15_ToQ31(q15_t x)
+    {
+        return (q31_t)x * 65536;
+    }
+
+    /**
+     * @brief Q31 转 Q15 (四舍五入，饱和)
+     */
+    static inline q15_t Q31_ToQ15(q31_t x)
+    {
+        return Q15_Sat((int32_t)Q_RoundShift(x, 16));
+    }
+
+    /**
+     * @brief 浮点转 Q15 (四舍五入，饱和)
+     */
+    static inline q15_t Q15_FromFloat(float x)
+    {
+        float v = x * 32768.0f;
+        if (v >= 32767.0f)
+            return Q15_MAX;
+        if (v <= -32768.0f)
+            return Q15_MIN;
+        return (q15_t)(v >= 0.0f ? v + 0.5f : v - 0.5f);
+    }
+
+    /**
+     * @brief 浮点转 Q31 (四舍五入，饱和)
+     */
+    static inline q31_t Q31_FromFloat(float x)
+    {
+        double v = (double)x * 2147483648.0;
+        if (v >= 2147483647.0)
+            return Q31_MAX;
+        if (v <= -2147483648.0)
+            return Q31_MIN;
+        return (q31_t)(v >= 0.0 ? v + 0.5 : v - 0.5);
+    }
+
+    /**
+     * @brief Q15 转浮点
+     */
+    static inline float Q15_ToFloat(q15_t x)
+    {
+        return (float)x * (1.0f / 32768.0f);
+    }
+
+    /**
+     * @brief Q31 转浮点
+     */
+    static inline float Q31_ToFloat(q31_t x)
+    {
+        return (float)x * (1.0f / 2147483648.0f);
+    }
+
+    /*============================================================================
+     *                              函数声明
+     *============================================================================*/
+
+    /**
+     * @brief 浮点增益转定点增益
+     * @note 尾数归一化到 [2^26, 2^27]；|gain| >= 2048 时饱和，NaN 视为 0
+     */
+    q_gain_t Q_GainFromFloat(float gain);
+
+    /**
+     * @brief 浮点数转 Q31 刻度的 int64_t (四舍五入，限幅到 ±limit)
+     * @param frac 额外的小数位数，结果为 x * 2^(31+frac)
+     */
+    int64_t Q_Int64FromFloat(float x, int32_t frac, int64_t limit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FIXED_H */
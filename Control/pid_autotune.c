@@ -0,0 +1,256 @@
+/**
+ * @file pid_autotune.c
+ * @brief 继电反馈PID自整定实现
+ */
+
+#include "pid_autotune.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+/*============================================================================
+ *                              辅助宏
+ *============================================================================*/
+#define TUNE_LIMIT(val, min, max) ((val) < (min) ? (min) : ((val) > (max) ? (max) : (val)))
+#define TUNE_PI 3.14159265f
+
+/*============================================================================
+ *                              整定规则
+ *============================================================================*/
+
+/**
+ * @brief 计算PID参数
+ * @param lag 辨识点相位超前 -π 的量，带滞环的继电为 asin(ε/a) (仅 SIMC 使用)
+ */
+static int PID_AutoTune_Gains(PID_TuneRule_t rule, float Ku, float Tu, float dead_time, float tau_c, float lag,
+                              float *Kp, float *Ki, float *Kd)
+{
+    if (Kp == NULL || Ki == NULL || Kd == NULL || !(Ku > 0.0f) || !(Tu > 0.0f))
+        return -1;
+
+    float kp, ti, td = 0.0f;
+
+    switch (rule)
+    {
+    case PID_TUNE_ZN_PI:
+        kp = 0.45f * Ku;
+        ti = Tu / 1.2f;
+        break;
+    case PID_TUNE_ZN_PID:
+        kp = 0.6f * Ku;
+        ti = Tu / 2.0f;
+        td = Tu / 8.0f;
+        break;
+    case PID_TUNE_TL_PI:
+        kp = Ku / 3.2f;
+        ti = 2.2f * Tu;
+        break;
+    case PID_TUNE_TL_PID:
+        kp = Ku / 2.2f;
+        ti = 2.2f * Tu;
+        td = Tu / 6.3f;
+        break;
+    case PID_TUNE_SIMC_PI:
+    {
+        // 一阶加纯滞后 K·e^(-θs)/(τs+1) 在辨识点相位为 -π + lag、增益为 1/(Ku·cos(lag))：
+        // ωu·θ + atan(ωu·τ) = π - lag，K = sqrt(1 + (ωu·τ)²) / (Ku·cos(lag))
+        if (!(dead_time > 0.0f))
+            return -1;
+        float wu = 2.0f * TUNE_PI / Tu;
+        float phase = TUNE_PI - lag - wu * dead_time;
+        if (phase <= 0.0f || phase >= 0.5f * TUNE_PI)
+            return -1;
+        float tau = tanf(phase) / wu;
+        float K = sqrtf(1.0f + wu * tau * wu * tau) / (Ku * cosf(lag));
+        float tc = (tau_c > 0.0f) ? tau_c : dead_time;
+
+        kp = tau / (K * (tc + dead_time));
+        ti = (tau < 4.0f * (tc + dead_time)) ? tau : 4.0f * (tc + dead_time);
+        break;
+    }
+    default:
+        return -1;
+    }
+
+    *Kp = kp;
+    *Ki = kp / ti;
+    *Kd = kp * td;
+    return 0;
+}
+
+/**
+ * @brief 由临界增益、临界周期计算PID参数
+ */
+int PID_AutoTune_ComputeGains(PID_TuneRule_t rule, float Ku, float Tu, float dead_time, float tau_c, float *Kp,
+                              float *Ki, float *Kd)
+{
+    return PID_AutoTune_Gains(rule, Ku, Tu, dead_time, tau_c, 0.0f, Kp, Ki, Kd);
+}
+
+/*============================================================================
+ *                              自整定实现
+ *============================================================================*/
+
+/**
+ * @brief 启动自整定
+ */
+void PID_AutoTune_Start(PID_AutoTune_t *tune, PID_Controller_t *pid, const PID_AutoTune_Config_t *config)
+{
+    if (tune == NULL || pid == NULL || config == NULL)
+        return;
+
+    memset(tune, 0, sizeof(PID_AutoTune_t));
+    tune->pid = pid;
+    tune->config = *config;
+    if (tune->config.cycles == 0)
+        tune->config.cycles = 1;
+
+    // 继电输出在控制器限幅内，幅值过小或采样周期无效时直接失败
+    float high = TUNE_LIMIT(config->output_bias + config->relay_amplitude, pid->output_min, pid->output_max);
+    float low = TUNE_LIMIT(config->output_bias - config->relay_amplitude, pid->output_min, pid->output_max);
+    if (!pid->initialized || !(pid->dt > 0.0f) || !(high > low))
+    {
+        tune->state = PID_TUNE_FAILED;
+        return;
+    }
+
+    tune->relay = 0; // 首次 Update 按反馈决定方向
+    tune->state = PID_TUNE_RUNNING;
+}
+
+/**
+ * @brief 记录一个完整振荡周期，足够后计算结果
+ */
+static void PID_AutoTune_Cycle(PID_AutoTune_t *tune, float feedback)
+{
+    // 第一个周期含起振过渡，不参与平均
+    if (tune->rises >= 2)
+    {
+        tune->sum_period += (float)(tune->ticks - tune->rise_tick);
+        tune->sum_amplitude += 0.5f * (tune->peak_max - tune->peak_min);
+        tune->sum_delay += (float)(tune->min_tick - tune->rise_tick);
+    }
+    tune->rises++;
+
+    tune->rise_tick = tune->ticks;
+    tune->min_tick = tune->ticks;
+    tune->peak_max = feedback;
+    tune->peak_min = feedback;
+}
+
+/**
+ * @brief 由平均周期与幅值计算参数并写入控制器
+ */
+static void PID_AutoTune_Finish(PID_AutoTune_t *tune, float feedback)
+{
+    PID_Controller_t *pid = tune->pid;
+    const PID_AutoTune_Config_t *cfg = &tune->config;
+    float n = (float)cfg->cycles;
+
+    float high = TUNE_LIMIT(cfg->output_bias + cfg->relay_amplitude, pid->output_min, pid->output_max);
+    float low = TUNE_LIMIT(cfg->output_bias - cfg->relay_amplitude, pid->output_min, pid->output_max);
+    float d = 0.5f * (high - low);
+    float a = tune->sum_amplitude / n;
+
+    tune->Tu = tune->sum_period / n * pid->dt;
+    tune->dead_time = tune->sum_delay / n * pid->dt;
+
+    // 振荡幅值不大于滞环时说明反馈被噪声淹没
+    if (a * a <= cfg->hysteresis * cfg->hysteresis)
+    {
+        tune->state = PID_TUNE_FAILED;
+        return;
+    }
+    tune->Ku = 4.0f * d / (TUNE_PI * sqrtf(a * a - cfg->hysteresis * cfg->hysteresis));
+
+    // 滞环使继电的描述函数带相位滞后，辨识点在 -π 之前 asin(ε/a) 处
+    float lag = asinf(cfg->hysteresis / a);
+    if (PID_AutoTune_Gains(cfg->rule, tune->Ku, tune->Tu, tune->dead_time, cfg->simc_tau_c, lag, &tune->Kp, &tune->Ki,
+                           &tune->Kd) != 0)
+    {
+        tune->state = PID_TUNE_FAILED;
+        return;
+    }
+
+    // 写入参数，积分预置为继电输出中心，上一次误差/反馈取当前值，切换时无比例以外的冲击
+    PID_SetParams(pid, tune->Kp, tune->Ki, tune->Kd);
+    PID_Reset(pid);
+    PID_SetSetpoint(pid, cfg->setpoint);
+    pid->integral = TUNE_LIMIT(cfg->output_bias / tune->Ki, pid->integral_min, pid->integral_max);
+    pid->last_error = pid->setpoint - feedback;
+    pid->last_feedback = feedback;
+    tune->state = PID_TUNE_DONE;
+}
+
+/**
+ * @brief 自整定计算
+ */
+float PID_AutoTune_Update(PID_AutoTune_t *tune, float feedback)
+{
+    if (tune == NULL || tune->pid == NULL)
+        return 0.0f;
+
+    const PID_AutoTune_Config_t *cfg = &tune->config;
+    PID_Controller_t *pid = tune->pid;
+
+    if (tune->state == PID_TUNE_FAILED)
+        return cfg->output_bias;
+    if (tune->state != PID_TUNE_RUNNING)
+        return PID_Update(pid, feedback);
+
+    tune->ticks++;
+    if (cfg->timeout > 0.0f && (float)tune->ticks * pid->dt > cfg->timeout)
+    {
+        tune->state = PID_TUNE_FAILED;
+        return cfg->output_bias;
+    }
+
+    // 极值跟踪
+    if (feedback > tune->peak_max)
+    {
+        tune->peak_max = feedback;
+    }
+    if (feedback < tune->peak_min)
+    {
+        tune->peak_min = feedback;
+        tune->min_tick = tune->ticks;
+    }
+
+    // 带滞环的继电：穿过 setpoint ± ε 时切换，切到高电平为一个周期的起点
+    if (tune->relay == 0)
+    {
+        tune->relay = (feedback < cfg->setpoint) ? 1 : -1;
+        tune->peak_max = feedback;
+        tune->peak_min = feedback;
+    }
+    else if (tune->relay > 0 && feedback > cfg->setpoint + cfg->hysteresis)
+    {
+        tune->relay = -1;
+    }
+    else if (tune->relay < 0 && feedback < cfg->setpoint - cfg->hysteresis)
+    {
+        tune->relay = 1;
+        PID_AutoTune_Cycle(tune, feedback);
+        if (tune->rises >= cfg->cycles + 2)
+        {
+            PID_AutoTune_Finish(tune, feedback);
+            if (tune->state == PID_TUNE_DONE)
+                return PID_Update(pid, feedback);
+            return cfg->output_bias;
+        }
+    }
+
+    tune->output = TUNE_LIMIT(cfg->output_bias + tune->relay * cfg->relay_amplitude, pid->output_min, pid->output_max);
+    return tune->output;
+}
+
+/**
+ * @brief 中止自整定
+ */
+void PID_AutoTune_Cancel(PID_AutoTune_t *tune)
+{
+    if (tune == NULL)
+        return;
+    if (tune->state == PID_TUNE_RUNNING)
+        tune->state = PID_TUNE_IDLE;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file pid_autotune.h
+ * @brief 继电反馈PID自整定
+ * @details Åström–Hägglund 继电反馈法，在线辨识后把整定结果写入已有的 PID_Controller_t：
+ *          - 整定期间输出在 bias ± amplitude 之间切换 (带滞环)，对象进入等幅振荡
+ *          - 由振荡幅值 a 得临界增益 Ku = 4d / (π·sqrt(a² - ε²))，由振荡周期得临界周期 Tu
+ *          - 由继电切换到反馈出现极值的时间估计纯滞后 θ，供 SIMC 规则换算一阶加纯滞后模型 (计入滞环的相位滞后)
+ *          - 滞环使 Tu 偏大、Ku 偏小，ε 取略大于反馈噪声峰峰值即可，不宜过大
+ *          - 按所选规则计算 Kp / Ki / Kd，用 PID_SetParams() 写入，并把积分预置为 bias，无扰切换到闭环
+ *
+ *          整定期间用 PID_AutoTune_Update() 代替 PID_Update()，要求对象增益为正 (输出增大反馈增大)。
+ *          积分限幅单位为 ∫e·dt，与 Ki 无关，整定后按新的 Ki 检查 integral_max 是否足够
+ *
+ * 使用方法：
+ * @code
+ * static PID_AutoTune_t tune;
+ *
+ * PID_AutoTune_Config_t cfg = {.setpoint = 60.0f, .output_bias = 0.3f, .relay_amplitude = 0.2f,
+ *                              .hysteresis = 0.2f, .cycles = 4, .timeout = 600.0f, .rule = PID_TUNE_TL_PID};
+ * PID_AutoTune_Start(&tune, &heater_pid, &cfg);
+ *
+ * // 控制周期中
+ * float duty = PID_AutoTune_Running(&tune) ? PID_AutoTune_Update(&tune, temp) : PID_Update(&heater_pid, temp);
+ * @endcode
+ */
+
+#ifndef __PID_AUTOTUNE_H
+#define __PID_AUTOTUNE_H
+
+#include <stdint.h>
+#include "pid.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /*============================================================================
+     *                              自整定类型定义
+     *============================================================================*/
+
+    /**
+     * @brief 整定规则
+     */
+    typedef enum
+    {
+        PID_TUNE_ZN_PI = 0, // Ziegler–Nichols PI:  Kp = 0.45Ku, Ti = Tu/1.2
+        PID_TUNE_ZN_PID,    // Ziegler–Nichols PID: Kp = 0.6Ku,  Ti = Tu/2,   Td = Tu/8
+        PID_TUNE_TL_PI,     // Tyreus–Luyben PI:    Kp = Ku/3.2, Ti = 2.2Tu
+        PID_TUNE_TL_PID,    // Tyreus–Luyben PID:   Kp = Ku/2.2, Ti = 2.2Tu,  Td = Tu/6.3
+        PID_TUNE_SIMC_PI,   // SIMC PI (由 Ku、Tu、θ 换算一阶加纯滞后模型)
+    } PID_TuneRule_t;
+
+    /**
+     * @brief 整定状态
+     */
+    typedef enum
+    {
+        PID_TUNE_IDLE = 0, // 未启动
+        PID_TUNE_RUNNING,  // 继电振荡中
+        PID_TUNE_DONE,     // 完成，参数已写入
+        PID_TUNE_FAILED,   // 超时或结果无效，参数未改动
+    } PID_TuneState_t;
+
+    /**
+     * @brief 自整定配置
+     */
+    typedef struct
+    {
+        float setpoint;        // 振荡中心 (整定结束后作为PID目标值)
+        float output_bias;     // 继电输出中心，取维持 setpoint 附近所需的输出
+        float relay_amplitude; // 继电幅值 d
+        float hysteresis;      // 滞环 ε，取反馈噪声峰峰值以上
+        uint8_t cycles;        // 参与平均的振荡周期数 (不含第一个过渡周期)，0 视为 1
+        float timeout;         // 超时时间 (秒)，0 为不限
+        PID_TuneRule_t rule;   // 整定规则
+        float simc_tau_c;      // SIMC 闭环时间常数，0 取 θ
+    } PID_AutoTune_Config_t;
+
+    /**
+     * @brief 自整定器
+     */
+    typedef struct
+    {
+        PID_Controller_t *pid; // 被整定的控制器
+        PID_AutoTune_Config_t config;
+        PID_TuneState_t state;
+
+        /* 继电 */
+        int8_t relay;   // 当前继电方向 (1 高，-1 低)
+        uint32_t ticks; // 已运行的控制周期数
+        float output;   // 当前输出
+
+        /* 振荡测量，以继电切到高电平为一个周期的起点 */
+        uint32_t rise_tick; // 本周期起点
+        uint32_t min_tick;  // 本周期反馈最小值出现的时刻
+        float peak_max;     // 本周期反馈最大值
+        float peak_min;     // 本周期反馈最小值
+        uint8_t rises;      // 已记录的周期起点数
+        float sum_period;
+        float sum_amplitude;
+        float sum_delay;
+
+        /* 结果 */
+        float Ku;         // 临界增益
+        float Tu;         // 临界周期 (秒)
+        float dead_time;  // 纯滞后估计 (秒)
+        float Kp, Ki, Kd; // 整定参数
+    } PID_AutoTune_t;
+
+    /*============================================================================
+     *                              自整定函数
+     *============================================================================*/
+
+    /**
+     * @brief 启动自整定，之后按控制周期调用 PID_AutoTune_Update()
+     * @param pid 被整定的控制器，须已用 PID_Init 初始化 (使用其 dt 与输出限幅)
+     */
+    void PID_AutoTune_Start(PID_AutoTune_t *tune, PID_Controller_t *pid, const PID_AutoTune_Config_t *config);
+
+    /**
+     * @brief 自整定计算，代替 PID_Update 调用
+     * @param feedback 反馈值
+     * @return 整定中为继电输出；失败后为 output_bias；完成 (或未启动、已中止) 后为 PID_Update 的输出
+     */
+    float PID_AutoTune_Update(PID_AutoTune_t *tune, float feedback);
+
+    /**
+     * @brief 中止自整定，控制器参数不变
+     */
+    void PID_AutoTune_Cancel(PID_AutoTune_t *tune);
+
+    /**
+     * @brief 是否仍在整定中
+     */
+    static inline uint8_t PID_AutoTune_Running(const PID_AutoTune_t *tune)
+    {
+        return tune->state == PID_TUNE_RUNNING;
+    }
+
+    /**
+     * @brief 由临界增益、临界周期计算PID参数，可用于整定后换一种规则
+     * @param dead_time 纯滞后 (仅 SIMC 使用，按无滞环的临界点换算模型)
+     * @param tau_c SIMC 闭环时间常数，0 取 dead_time
+     * @return 0 成功，-1 参数无效
+     */
+    int PID_AutoTune_ComputeGains(PID_TuneRule_t rule, float Ku, float Tu, float dead_time, float tau_c, float *Kp,
+                                  float *Ki, float *Kd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PID_AUTOTUNE_H */
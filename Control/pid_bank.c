@@ -0,0 +1,259 @@
+/**
+ * @file pid_bank.c
+ * @brief 多通道PID控制器组实现
+ * @note 逐位一致依赖运算顺序与 PID_Update 相同：每个表达式保持原写法 (含除法，不改为乘倒数)，
+ *       两个文件须使用相同的编译选项 (浮点收缩 -ffp-contract 等)
+ */
+
+#include "pid_bank.h"
+#include <string.h>
+
+/*============================================================================
+ *                              辅助宏
+ *============================================================================*/
+/* 与 pid.c 的 LIMIT/ABS 相同的比较顺序，NaN 与 ±0 的处理一致 */
+#define BANK_LIMIT(val, min, max) ((val) < (min) ? (min) : ((val) > (max) ? (max) : (val)))
+#define BANK_ABS(x) ((x) >= 0 ? (x) : -(x))
+
+#define BANK_CHECK(bank, ch) ((bank) != NULL && (ch) < (bank)->channels)
+
+/*============================================================================
+ *                              配置
+ *============================================================================*/
+
+/**
+ * @brief 初始化控制器组
+ */
+void PID_Bank_Init(PID_Bank_t *bank, uint32_t channels)
+{
+    if (bank == NULL)
+        return;
+
+    memset(bank, 0, sizeof(PID_Bank_t));
+    bank->channels = (channels > PID_BANK_MAX_CHANNELS) ? PID_BANK_MAX_CHANNELS : channels;
+
+    for (uint32_t ch = 0; ch < bank->channels; ch++)
+    {
+        PID_Bank_Config(bank, ch, NULL);
+    }
+}
+
+/**
+ * @brief 配置一个通道
+ */
+void PID_Bank_Config(PID_Bank_t *bank, uint32_t ch, const PID_Config_t *config)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+
+    if (config != NULL)
+    {
+        bank->Kp[ch] = config->Kp;
+        bank->Ki[ch] = config->Ki;
+        bank->Kd[ch] = config->Kd;
+        bank->dt[ch] = config->dt;
+        bank->output_max[ch] = config->output_max;
+        bank->output_min[ch] = config->output_min;
+        bank->integral_max[ch] = config->integral_max;
+        bank->integral_min[ch] = config->integral_min;
+        bank->deadband[ch] = config->deadband;
+        bank->anti_windup[ch] = config->anti_windup;
+        bank->derivative_on_measurement[ch] = config->derivative_on_measurement;
+    }
+    else
+    {
+        // 默认配置，与 PID_Init 相同
+        bank->Kp[ch] = 1.0f;
+        bank->Ki[ch] = 0.0f;
+        bank->Kd[ch] = 0.0f;
+        bank->dt[ch] = 0.01f;
+        bank->output_max[ch] = 1000.0f;
+        bank->output_min[ch] = -1000.0f;
+        bank->integral_max[ch] = 500.0f;
+        bank->integral_min[ch] = -500.0f;
+        bank->deadband[ch] = 0.0f;
+        bank->anti_windup[ch] = 1;
+        bank->derivative_on_measurement[ch] = 0;
+    }
+
+    bank->derivative_filter[ch] = 0;
+    bank->d_alpha[ch] = 0.0f;
+    bank->d_last[ch] = 0.0f;
+    bank->d_started[ch] = 0;
+    PID_Bank_Reset(bank, ch);
+}
+
+/**
+ * @brief 设置通道参数
+ */
+void PID_Bank_SetParams(PID_Bank_t *bank, uint32_t ch, float Kp, float Ki, float Kd)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+    bank->Kp[ch] = Kp;
+    bank->Ki[ch] = Ki;
+    bank->Kd[ch] = Kd;
+}
+
+/**
+ * @brief 设置通道输出限幅
+ */
+void PID_Bank_SetOutputLimits(PID_Bank_t *bank, uint32_t ch, float min, float max)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+    bank->output_min[ch] = min;
+    bank->output_max[ch] = max;
+}
+
+/**
+ * @brief 设置通道积分限幅
+ */
+void PID_Bank_SetIntegralLimits(PID_Bank_t *bank, uint32_t ch, float min, float max)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+    bank->integral_min[ch] = min;
+    bank->integral_max[ch] = max;
+}
+
+/**
+ * @brief 设置通道目标值
+ */
+void PID_Bank_SetSetpoint(PID_Bank_t *bank, uint32_t ch, float setpoint)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+    bank->setpoint[ch] = setpoint;
+}
+
+/**
+ * @brief 设置通道微分项一阶低通
+ */
+void PID_Bank_SetDerivativeLowPass(PID_Bank_t *bank, uint32_t ch, float alpha)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+    bank->d_alpha[ch] = alpha;
+    bank->d_last[ch] = 0.0f;
+    bank->d_started[ch] = 0;
+    bank->derivative_filter[ch] = 1;
+}
+
+/**
+ * @brief 使能/禁用通道微分项滤波
+ */
+void PID_Bank_EnableDerivativeFilter(PID_Bank_t *bank, uint32_t ch, uint8_t enable)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+    bank->derivative_filter[ch] = enable ? 1 : 0;
+}
+
+/*============================================================================
+ *                              更新
+ *============================================================================*/
+
+/**
+ * @brief 更新全部通道
+ * @details 每个通道的计算与 PID_Update 逐项对应；PID_Update 中按条件跳过的计算在这里照常进行，
+ *          再按条件选择结果，循环体内没有分支 (Ki 为 0 时的除零结果被丢弃)
+ */
+void PID_Bank_Update(PID_Bank_t *bank, const float *feedback, float *output)
+{
+    if (bank == NULL || feedback == NULL)
+        return;
+
+    const uint32_t n = bank->channels;
+    const float *__restrict fb_in = feedback;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        // 先读出本通道的全部参数与状态，按条件选择时不再访存
+        const float fb = fb_in[i];
+        const float Kp = bank->Kp[i];
+        const float Ki = bank->Ki[i];
+        const float Kd = bank->Kd[i];
+        const float dt = bank->dt[i];
+        const float omin = bank->output_min[i];
+        const float omax = bank->output_max[i];
+        const float imin = bank->integral_min[i];
+        const float imax = bank->integral_max[i];
+        const float alpha = bank->d_alpha[i];
+        const float d_last = bank->d_last[i];
+        const float last_integral = bank->integral[i];
+        const float last_derivative = bank->derivative[i];
+        const int ki_on = Ki != 0.0f;
+        const int kd_on = Kd != 0.0f;
+        const int d_filter = kd_on & (bank->derivative_filter[i] != 0);
+        const int d_started = bank->d_started[i] != 0;
+        const int dom = bank->derivative_on_measurement[i] != 0;
+        const int aw_on = bank->anti_windup[i] != 0;
+
+        // 误差与死区
+        float error = bank->setpoint[i] - fb;
+        error = (BANK_ABS(error) < bank->deadband[i]) ? 0.0f : error;
+
+        // 比例项
+        const float P_term = Kp * error;
+
+        // 积分项
+        float integral = last_integral + error * dt;
+        integral = BANK_LIMIT(integral, imin, imax);
+        integral = ki_on ? integral : last_integral;
+        const float I_raw = Ki * integral;
+        const float I_term = ki_on ? I_raw : 0.0f;
+
+        // 微分项
+        // 先选择分子再除以 dt，与两种写法各自相除的结果相同
+        const float d_num = dom ? -(fb - bank->last_feedback[i]) : (error - bank->last_error[i]);
+        const float d_raw = d_num / dt;
+        const float d_lpf = alpha * d_raw + (1.0f - alpha) * d_last;
+        const float d_filtered = d_started ? d_lpf : d_raw;
+        const float derivative = kd_on ? (d_filter ? d_filtered : d_raw) : last_derivative;
+        const float D_raw = Kd * derivative;
+        const float D_term = kd_on ? D_raw : 0.0f;
+
+        // 输出与抗积分饱和
+        float out = P_term + I_term + D_term;
+        const float out_sat = BANK_LIMIT(out, omin, omax);
+        const int windup = aw_on & ki_on & (out != out_sat);
+        float integral_aw = integral - (out - out_sat) / Ki;
+        integral_aw = BANK_LIMIT(integral_aw, imin, imax);
+        integral = windup ? integral_aw : integral;
+        out = windup ? out_sat : out;
+        out = BANK_LIMIT(out, omin, omax);
+
+        // 保存状态
+        bank->d_last[i] = d_filter ? d_filtered : d_last;
+        bank->d_started[i] = d_started | d_filter;
+        bank->error[i] = error;
+        bank->integral[i] = integral;
+        bank->derivative[i] = derivative;
+        bank->output[i] = out;
+        bank->last_error[i] = error;
+        bank->last_feedback[i] = fb;
+    }
+
+    if (output != NULL)
+    {
+        memcpy(output, bank->output, n * sizeof(float));
+    }
+}
+
+/**
+ * @brief 重置通道运行时变量，与 PID_Reset 相同 (微分滤波器状态保留)
+ */
+void PID_Bank_Reset(PID_Bank_t *bank, uint32_t ch)
+{
+    if (!BANK_CHECK(bank, ch))
+        return;
+
+    bank->setpoint[ch] = 0.0f;
+    bank->error[ch] = 0.0f;
+    bank->last_error[ch] = 0.0f;
+    bank->last_feedback[ch] = 0.0f;
+    bank->integral[ch] = 0.0f;
+    bank->derivative[ch] = 0.0f;
+    bank->output[ch] = 0.0f;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file pid_bank.h
+ * @brief 多通道PID控制器组 (结构数组布局)
+ * @details 同一类参数、状态按通道连续存放，一次调用更新全部通道：
+ *          - 无函数指针调用，限幅、开关项用条件选择代替分支，主机端可自动向量化
+ *          - 与 PID_Update 使用相同的运算顺序，相同配置下输出逐位一致
+ *          - 微分滤波只支持一阶低通 (与 LowPass_Update 相同)，不支持设定值/反馈/输出滤波
+ *
+ * 使用方法：
+ * @code
+ * static PID_Bank_t rate_pid;
+ *
+ * PID_Bank_Init(&rate_pid, 3);
+ * for (uint32_t ch = 0; ch < 3; ch++)
+ * {
+ *     PID_Bank_Config(&rate_pid, ch, &rate_cfg);
+ *     PID_Bank_SetDerivativeLowPass(&rate_pid, ch, 0.2f);
+ * }
+ *
+ * PID_Bank_SetSetpoint(&rate_pid, 0, target_x);
+ * PID_Bank_Update(&rate_pid, gyro, motor_cmd); // gyro[3] -> motor_cmd[3]
+ * @endcode
+ */
+
+#ifndef __PID_BANK_H
+#define __PID_BANK_H
+
+#include <stdint.h>
+#include "pid.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*============================================================================
+ *                              配置
+ *============================================================================*/
+#ifndef PID_BANK_MAX_CHANNELS
+#define PID_BANK_MAX_CHANNELS 16 // 单个控制器组的最大通道数
+#endif
+
+    /*============================================================================
+     *                              类型定义
+     *============================================================================*/
+
+    /**
+     * @brief 多通道PID控制器组 (位置式)
+     * @note 开关量使用 int32_t，与 float 等宽，便于向量化时作为掩码
+     */
+    typedef struct
+    {
+        /* PID参数 */
+        float Kp[PID_BANK_MAX_CHANNELS];
+        float Ki[PID_BANK_MAX_CHANNELS];
+        float Kd[PID_BANK_MAX_CHANNELS];
+        float dt[PID_BANK_MAX_CHANNELS];
+
+        /* 限幅参数 */
+        float output_max[PID_BANK_MAX_CHANNELS];
+        float output_min[PID_BANK_MAX_CHANNELS];
+        float integral_max[PID_BANK_MAX_CHANNELS];
+        float integral_min[PID_BANK_MAX_CHANNELS];
+        float deadband[PID_BANK_MAX_CHANNELS];
+
+        /* 开关 */
+        int32_t anti_windup[PID_BANK_MAX_CHANNELS];               // 抗积分饱和使能
+        int32_t derivative_on_measurement[PID_BANK_MAX_CHANNELS]; // 基于测量值微分
+        int32_t derivative_filter[PID_BANK_MAX_CHANNELS];         // 微分项一阶低通使能
+
+        /* 微分项一阶低通 */
+        float d_alpha[PID_BANK_MAX_CHANNELS];    // 滤波系数
+        float d_last[PID_BANK_MAX_CHANNELS];     // 上一次输出
+        int32_t d_started[PID_BANK_MAX_CHANNELS]; // 已有输出 (首次直接输出输入值)
+
+        /* 运行时变量 */
+        float setpoint[PID_BANK_MAX_CHANNELS];
+        float error[PID_BANK_MAX_CHANNELS];
+        float last_error[PID_BANK_MAX_CHANNELS];
+        float last_feedback[PID_BANK_MAX_CHANNELS];
+        float integral[PID_BANK_MAX_CHANNELS];
+        float derivative[PID_BANK_MAX_CHANNELS];
+        float output[PID_BANK_MAX_CHANNELS];
+
+        uint32_t channels; // 通道数
+    } PID_Bank_t;
+
+    /*============================================================================
+     *                              函数声明
+     *============================================================================*/
+
+    /**
+     * @brief 初始化控制器组，各通道为 PID_Init(pid, NULL) 的默认配置
+     * @param channels 通道数，超过 PID_BANK_MAX_CHANNELS 时截断
+     */
+    void PID_Bank_Init(PID_Bank_t *bank, uint32_t channels);
+
+    /**
+     * @brief 按 PID_Config_t 配置一个通道并清零其状态
+     */
+    void PID_Bank_Config(PID_Bank_t *bank, uint32_t ch, const PID_Config_t *config);
+
+    /**
+     * @brief 设置通道参数
+     */
+    void PID_Bank_SetParams(PID_Bank_t *bank, uint32_t ch, float Kp, float Ki, float Kd);
+
+    /**
+     * @brief 设置通道输出限幅
+     */
+    void PID_Bank_SetOutputLimits(PID_Bank_t *bank, uint32_t ch, float min, float max);
+
+    /**
+     * @brief 设置通道积分限幅
+     */
+    void PID_Bank_SetIntegralLimits(PID_Bank_t *bank, uint32_t ch, float min, float max);
+
+    /**
+     * @brief 设置通道目标值
+     */
+    void PID_Bank_SetSetpoint(PID_Bank_t *bank, uint32_t ch, float setpoint);
+
+    /**
+     * @brief 设置通道微分项一阶低通系数并使能，等效于 LowPass_Init + PID_SetDerivativeFilter
+     */
+    void PID_Bank_SetDerivativeLowPass(PID_Bank_t *bank, uint32_t ch, float alpha);
+
+    /**
+     * @brief 使能/禁用通道微分项滤波
+     */
+    void PID_Bank_EnableDerivativeFilter(PID_Bank_t *bank, uint32_t ch, uint8_t enable);
+
+    /**
+     * @brief 更新全部通道
+     * @param feedback 各通道反馈值，bank->channels 个
+     * @param output 各通道控制输出，可为 NULL (输出仍保存在 bank->output)
+     */
+    void PID_Bank_Update(PID_Bank_t *bank, const float *feedback, float *output);
+
+    /**
+     * @brief 重置通道运行时变量，与 PID_Reset 相同 (参数与微分滤波器状态保留)
+     */
+    void PID_Bank_Reset(PID_Bank_t *bank, uint32_t ch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PID_BANK_H */
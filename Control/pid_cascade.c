@@ -0,0 +1,161 @@
+/**
+ * @file pid_cascade.c
+ * @brief 串级PID控制器实现
+ */
+
+#include "pid_cascade.h"
+#include <stddef.h>
+#include <string.h>
+
+/*============================================================================
+ *                              辅助宏
+ *============================================================================*/
+#define CASCADE_LIMIT(val, min, max) ((val) < (min) ? (min) : ((val) > (max) ? (max) : (val)))
+
+/*============================================================================
+ *                              串级PID实现
+ *============================================================================*/
+
+/**
+ * @brief 初始化串级PID控制器
+ */
+void PID_Cascade_Init(PID_Cascade_t *cascade, const PID_Cascade_Config_t *config)
+{
+    if (cascade == NULL || config == NULL)
+        return;
+
+    memset(cascade, 0, sizeof(PID_Cascade_t));
+
+    PID_Config_t outer = config->outer;
+    PID_Config_t inner = config->inner;
+
+    cascade->ratio = (config->ratio != 0) ? config->ratio : 1;
+    outer.dt = inner.dt * cascade->ratio; // 外环按内环节拍分频执行
+    PID_Init(&cascade->outer, &outer);
+    PID_Init(&cascade->inner, &inner);
+
+    cascade->setpoint_ff_gain = config->setpoint_ff_gain;
+    cascade->windup_link = config->windup_link;
+}
+
+/**
+ * @brief 设置外环目标值
+ */
+void PID_Cascade_SetSetpoint(PID_Cascade_t *cascade, float setpoint)
+{
+    if (cascade == NULL)
+        return;
+    PID_SetSetpoint(&cascade->outer, setpoint);
+}
+
+/**
+ * @brief 设置输出前馈
+ */
+void PID_Cascade_SetOutputFeedforward(PID_Cascade_t *cascade, float feedforward)
+{
+    if (cascade == NULL)
+        return;
+    cascade->output_ff = feedforward;
+}
+
+/**
+ * @brief 外环计算，结果作为内环目标值
+ */
+static void PID_Cascade_UpdateOuter(PID_Cascade_t *cascade, float feedback)
+{
+    PID_Controller_t *outer = &cascade->outer;
+    float last_integral = outer->integral;
+    float output = PID_Update(outer, feedback);
+
+    // 抗积分饱和联动：内环已饱和时，撤销外环积分项向饱和方向的增量
+    // (外环输出增大使内环输出增大，即两环增益同号的常规配置)
+    if (cascade->windup_link && cascade->inner_sat != 0)
+    {
+        float delta_I = outer->Ki * (outer->integral - last_integral);
+        if (delta_I * cascade->inner_sat > 0.0f)
+        {
+            outer->integral = last_integral;
+            output = CASCADE_LIMIT(output - delta_I, outer->output_min, outer->output_max);
+            outer->output = output;
+            cascade->outer_holds++;
+        }
+    }
+
+    // 设定值速度前馈：外环目标值 (滤波后) 的变化率
+    if (cascade->setpoint_ff_gain != 0.0f)
+    {
+        if (cascade->started)
+        {
+            output += cascade->setpoint_ff_gain * (outer->setpoint - cascade->last_setpoint) / outer->dt;
+        }
+        cascade->last_setpoint = outer->setpoint;
+    }
+    cascade->started = 1;
+
+    cascade->inner_setpoint = output;
+    PID_SetSetpoint(&cascade->inner, output);
+}
+
+/**
+ * @brief 串级PID计算
+ */
+float PID_Cascade_Update(PID_Cascade_t *cascade, float outer_feedback, float inner_feedback)
+{
+    if (cascade == NULL)
+        return 0.0f;
+
+    // 外环按分频执行
+    if (cascade->tick == 0)
+    {
+        PID_Cascade_UpdateOuter(cascade, outer_feedback);
+        cascade->tick = cascade->ratio - 1;
+    }
+    else
+    {
+        cascade->tick--;
+    }
+
+    // 内环：有输出前馈时按扣除前馈后的范围限幅，内环的抗积分饱和随之正确
+    PID_Controller_t *inner = &cascade->inner;
+    float ff = cascade->output_ff;
+    float output;
+
+    if (ff != 0.0f)
+    {
+        float max = inner->output_max;
+        float min = inner->output_min;
+        inner->output_max = max - ff;
+        inner->output_min = min - ff;
+        output = PID_Update(inner, inner_feedback);
+        cascade->inner_sat = (output >= inner->output_max) ? 1 : ((output <= inner->output_min) ? -1 : 0);
+        inner->output_max = max;
+        inner->output_min = min;
+        output += ff;
+    }
+    else
+    {
+        output = PID_Update(inner, inner_feedback);
+        cascade->inner_sat = (output >= inner->output_max) ? 1 : ((output <= inner->output_min) ? -1 : 0);
+    }
+
+    cascade->output = output;
+    return output;
+}
+
+/**
+ * @brief 重置串级PID控制器
+ */
+void PID_Cascade_Reset(PID_Cascade_t *cascade)
+{
+    if (cascade == NULL)
+        return;
+
+    PID_Reset(&cascade->outer);
+    PID_Reset(&cascade->inner);
+    cascade->tick = 0;
+    cascade->started = 0;
+    cascade->last_setpoint = 0.0f;
+    cascade->inner_sat = 0;
+    cascade->inner_setpoint = 0.0f;
+    cascade->output = 0.0f;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file pid_cascade.h
+ * @brief 串级PID控制器
+ * @details 外环 (如角度) 输出作为内环 (如角速度) 的目标值，一个对象、一次调用完成整条串级：
+ *          - 内环每次调用都更新，外环每 ratio 次更新一次，外环 dt 由内环 dt × ratio 自动得到
+ *          - 不更新外环的节拍只运行内环，可用 PID_Cascade_OuterDue() 跳过外环传感器读取
+ *          - 设定值速度前馈：外环目标值的变化率 × 增益叠加到内环目标值
+ *          - 输出前馈 (如重力补偿) 叠加到内环输出，内环抗积分饱和按扣除前馈后的限幅计算
+ *          - 抗积分饱和联动：内环输出饱和时，外环积分不再向饱和方向累积
+ *
+ *          外环、内环为普通的 PID_Controller_t，滤波器等设置直接作用于 cascade.outer / cascade.inner
+ *
+ * 使用方法：
+ * @code
+ * static PID_Cascade_t att;
+ *
+ * PID_Cascade_Config_t cfg = {.outer = angle_cfg, .inner = rate_cfg, .ratio = 4, .setpoint_ff_gain = 1.0f};
+ * PID_Cascade_Init(&att, &cfg);
+ * PID_Cascade_SetSetpoint(&att, target_angle);
+ *
+ * // 1kHz 控制中断，外环 250Hz
+ * float angle = PID_Cascade_OuterDue(&att) ? read_angle() : 0.0f;
+ * motor = PID_Cascade_Update(&att, angle, read_gyro());
+ * @endcode
+ */
+
+#ifndef __PID_CASCADE_H
+#define __PID_CASCADE_H
+
+#include <stdint.h>
+#include "pid.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /*============================================================================
+     *                              串级PID类型定义
+     *============================================================================*/
+
+    /**
+     * @brief 串级PID配置
+     */
+    typedef struct
+    {
+        PID_Config_t outer;     // 外环配置 (dt 忽略，按 inner.dt * ratio 计算)
+        PID_Config_t inner;     // 内环配置
+        uint16_t ratio;         // 内环频率 / 外环频率，0 视为 1
+        float setpoint_ff_gain; // 设定值速度前馈增益，0 为关闭
+        uint8_t windup_link;    // 抗积分饱和联动使能
+    } PID_Cascade_Config_t;
+
+    /**
+     * @brief 串级PID控制器
+     */
+    typedef struct
+    {
+        PID_Controller_t outer; // 外环
+        PID_Controller_t inner; // 内环
+
+        uint16_t ratio; // 内环频率 / 外环频率
+        uint16_t tick;  // 距下次外环更新的内环节拍数，0 表示本次更新外环
+
+        /* 前馈 */
+        float setpoint_ff_gain; // 设定值速度前馈增益
+        float last_setpoint;    // 上次外环更新时的外环目标值
+        uint8_t started;        // 外环已更新过 (首次不计算速度前馈)
+        float output_ff;        // 输出前馈
+
+        /* 抗积分饱和联动 */
+        uint8_t windup_link;  // 使能
+        int8_t inner_sat;     // 内环输出饱和方向 (1 上限，-1 下限，0 未饱和)
+        uint32_t outer_holds; // 外环积分被保持的次数
+
+        float inner_setpoint; // 内环目标值 (外环输出 + 设定值前馈)
+        float output;         // 输出 (内环输出 + 输出前馈)
+    } PID_Cascade_t;
+
+    /*============================================================================
+     *                              串级PID函数
+     *============================================================================*/
+
+    /**
+     * @brief 初始化串级PID控制器
+     */
+    void PID_Cascade_Init(PID_Cascade_t *cascade, const PID_Cascade_Config_t *config);
+
+    /**
+     * @brief 设置外环目标值
+     */
+    void PID_Cascade_SetSetpoint(PID_Cascade_t *cascade, float setpoint);
+
+    /**
+     * @brief 设置输出前馈，叠加到内环输出，总输出仍受内环输出限幅
+     */
+    void PID_Cascade_SetOutputFeedforward(PID_Cascade_t *cascade, float feedforward);
+
+    /**
+     * @brief 下一次 PID_Cascade_Update 是否更新外环
+     */
+    static inline uint8_t PID_Cascade_OuterDue(const PID_Cascade_t *cascade)
+    {
+        return cascade->tick == 0;
+    }
+
+    /**
+     * @brief 串级PID计算，按内环频率调用
+     * @param outer_feedback 外环反馈值，只在外环更新的节拍读取
+     * @param inner_feedback 内环反馈值
+     * @return 控制输出
+     */
+    float PID_Cascade_Update(PID_Cascade_t *cascade, float outer_feedback, float inner_feedback);
+
+    /**
+     * @brief 重置两个环的运行时变量，下一次调用更新外环
+     */
+    void PID_Cascade_Reset(PID_Cascade_t *cascade);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PID_CASCADE_H */
@@ -0,0 +1,339 @@
+/**
+ * @file pid_fixed.c
+ * @brief 定点PID控制器实现
+ * @note Q15 接口转换到 Q31 后调用同一份计算，结果四舍五入回 Q15
+ */
+
+#include "pid_fixed.h"
+#include <stddef.h>
+#include <string.h>
+
+/*============================================================================
+ *                              辅助宏
+ *============================================================================*/
+#define FIXED_LIMIT(val, min, max) ((val) < (min) ? (min) : ((val) > (max) ? (max) : (val)))
+#define FIXED_ABS(x) ((x) >= 0 ? (x) : -(x))
+
+/* 积分项/增量式输出的刻度与饱和值 */
+#define ACC_TERM_MAX (PID_FIXED_TERM_MAX << PID_FIXED_ACC_FRAC)
+
+/*============================================================================
+ *                              位置式PID实现
+ *============================================================================*/
+
+/**
+ * @brief 初始化定点PID控制器
+ */
+void PID_Fixed_Init(PID_Fixed_t *pid, const PID_Config_t *config)
+{
+    if (pid == NULL)
+        return;
+
+    memset(pid, 0, sizeof(PID_Fixed_t));
+
+    if (config != NULL)
+    {
+        pid->kp = Q_GainFromFloat(config->Kp);
+        pid->ki_dt = Q_GainFromFloat(config->Ki * config->dt);
+        pid->kd_dt = Q_GainFromFloat(config->Kd / config->dt);
+        pid->output_max = Q31_FromFloat(config->output_max);
+        pid->output_min = Q31_FromFloat(config->output_min);
+        pid->deadband = Q31_FromFloat(config->deadband);
+        pid->anti_windup = config->anti_windup;
+        pid->derivative_on_measurement = config->derivative_on_measurement;
+
+        // 积分限幅换算到积分项，Ki 为负时上下限交换
+        int64_t i_max = Q_Int64FromFloat(config->Ki * config->integral_max, PID_FIXED_ACC_FRAC, ACC_TERM_MAX);
+        int64_t i_min = Q_Int64FromFloat(config->Ki * config->integral_min, PID_FIXED_ACC_FRAC, ACC_TERM_MAX);
+        pid->i_acc_max = (i_max >= i_min) ? i_max : i_min;
+        pid->i_acc_min = (i_max >= i_min) ? i_min : i_max;
+    }
+    else
+    {
+        // 默认配置，与 PID_Init 相同 (输出限幅为满量程)
+        pid->kp = Q_GainFromFloat(1.0f);
+        pid->ki_dt = Q_GainFromFloat(0.0f);
+        pid->kd_dt = Q_GainFromFloat(0.0f);
+        pid->output_max = Q31_MAX;
+        pid->output_min = Q31_MIN;
+        pid->i_acc_max = ACC_TERM_MAX;
+        pid->i_acc_min = -ACC_TERM_MAX;
+        pid->anti_windup = 1;
+    }
+
+    pid->initialized = 1;
+}
+
+/**
+ * @brief 设置微分项一阶低通系数并使能
+ */
+void PID_Fixed_SetDerivativeLowPass(PID_Fixed_t *pid, float alpha)
+{
+    if (pid == NULL)
+        return;
+
+    pid->d_alpha = Q_GainFromFloat(alpha);
+    pid->d_started = 0;
+    pid->d_filter = 1;
+}
+
+/**
+ * @brief 设置目标值 (Q31)
+ */
+void PID_Q31_SetSetpoint(PID_Fixed_t *pid, q31_t setpoint)
+{
+    if (pid == NULL)
+        return;
+    pid->setpoint = setpoint;
+}
+
+/**
+ * @brief 设置目标值 (Q15)
+ */
+void PID_Q15_SetSetpoint(PID_Fixed_t *pid, q15_t setpoint)
+{
+    PID_Q31_SetSetpoint(pid, Q15_ToQ31(setpoint));
+}
+
+/**
+ * @brief 定点PID计算 (Q31)
+ */
+q31_t PID_Q31_Update(PID_Fixed_t *pid, q31_t feedback)
+{
+    if (pid == NULL || !pid->initialized)
+        return 0;
+
+    int64_t P_term, I_term, D_term;
+
+    pid->feedback = feedback;
+
+    // 计算误差
+    pid->error = (int64_t)pid->setpoint - feedback;
+
+    // 死区处理
+    if (FIXED_ABS(pid->error) < pid->deadband)
+    {
+        pid->error = 0;
+    }
+
+    // 比例项
+    P_term = Q_Clamp(Q_MulGain(pid->error, pid->kp, 0), PID_FIXED_TERM_MAX);
+
+    // 积分项：直接累加 Ki*e*dt
+    if (pid->ki_dt.m != 0)
+    {
+        pid->i_acc += Q_MulGain(pid->error, pid->ki_dt, PID_FIXED_ACC_FRAC);
+        pid->i_acc = FIXED_LIMIT(pid->i_acc, pid->i_acc_min, pid->i_acc_max);
+        I_term = Q_RoundShift(pid->i_acc, PID_FIXED_ACC_FRAC);
+    }
+    else
+    {
+        I_term = 0;
+    }
+
+    // 微分项：Kd/dt 乘以误差 (或测量值) 的变化量
+    if (pid->kd_dt.m != 0)
+    {
+        int64_t diff;
+        if (pid->derivative_on_measurement)
+        {
+            diff = -((int64_t)pid->feedback - pid->last_feedback);
+        }
+        else
+        {
+            diff = pid->error - pid->last_error;
+        }
+        D_term = Q_Clamp(Q_MulGain(diff, pid->kd_dt, 0), PID_FIXED_TERM_MAX);
+
+        // 一阶低通为线性运算，对微分项滤波与先滤波再乘 Kd 相同
+        if (pid->d_filter)
+        {
+            if (pid->d_started)
+            {
+                D_term = pid->d_term + Q_MulGain(D_term - pid->d_term, pid->d_alpha, 0);
+            }
+            pid->d_started = 1;
+        }
+        pid->d_term = D_term;
+    }
+    else
+    {
+        D_term = 0;
+    }
+
+    // 计算输出
+    int64_t output = P_term + I_term + D_term;
+
+    // 抗积分饱和 (Back-calculation)：积分项减去输出超出量
+    if (pid->anti_windup && pid->ki_dt.m != 0)
+    {
+        int64_t output_saturated = FIXED_LIMIT(output, (int64_t)pid->output_min, (int64_t)pid->output_max);
+        if (output != output_saturated)
+        {
+            pid->i_acc -= (output - output_saturated) * ((int64_t)1 << PID_FIXED_ACC_FRAC);
+            pid->i_acc = FIXED_LIMIT(pid->i_acc, pid->i_acc_min, pid->i_acc_max);
+            output = output_saturated;
+        }
+    }
+
+    // 输出限幅
+    pid->output = (q31_t)FIXED_LIMIT(output, (int64_t)pid->output_min, (int64_t)pid->output_max);
+
+    // 保存历史值
+    pid->last_error = pid->error;
+    pid->last_feedback = pid->feedback;
+
+    return pid->output;
+}
+
+/**
+ * @brief 定点PID计算 (Q15)
+ */
+q15_t PID_Q15_Update(PID_Fixed_t *pid, q15_t feedback)
+{
+    return Q31_ToQ15(PID_Q31_Update(pid, Q15_ToQ31(feedback)));
+}
+
+/**
+ * @brief 重置定点PID控制器 (与 PID_Reset 相同，微分滤波器状态保留)
+ */
+void PID_Fixed_Reset(PID_Fixed_t *pid)
+{
+    if (pid == NULL)
+        return;
+
+    pid->setpoint = 0;
+    pid->feedback = 0;
+    pid->error = 0;
+    pid->last_error = 0;
+    pid->i_acc = 0;
+    pid->output = 0;
+    pid->last_feedback = 0;
+}
+
+/**
+ * @brief 获取积分项
+ */
+q31_t PID_Fixed_GetIntegral(PID_Fixed_t *pid)
+{
+    if (pid == NULL)
+        return 0;
+    return Q31_Sat(Q_RoundShift(pid->i_acc, PID_FIXED_ACC_FRAC));
+}
+
+/*============================================================================
+ *                              增量式PID实现
+ *============================================================================*/
+
+/**
+ * @brief 初始化定点增量式PID控制器
+ */
+void PID_Inc_Fixed_Init(PID_Inc_Fixed_t *pid, const PID_Config_t *config)
+{
+    if (pid == NULL)
+        return;
+
+    memset(pid, 0, sizeof(PID_Inc_Fixed_t));
+
+    if (config != NULL)
+    {
+        pid->kp = Q_GainFromFloat(config->Kp);
+        pid->ki_dt = Q_GainFromFloat(config->Ki * config->dt);
+        pid->kd_dt = Q_GainFromFloat(config->Kd / config->dt);
+        pid->out_acc_max = Q_Int64FromFloat(config->output_max, PID_FIXED_ACC_FRAC, Q31_ONE_64 << PID_FIXED_ACC_FRAC);
+        pid->out_acc_min = Q_Int64FromFloat(config->output_min, PID_FIXED_ACC_FRAC, Q31_ONE_64 << PID_FIXED_ACC_FRAC);
+        PID_Inc_Fixed_SetDeltaLimit(pid, (config->output_max - config->output_min) * 0.1f); // 默认10%
+    }
+    else
+    {
+        pid->kp = Q_GainFromFloat(1.0f);
+        pid->ki_dt = Q_GainFromFloat(0.0f);
+        pid->kd_dt = Q_GainFromFloat(0.0f);
+        pid->out_acc_max = Q31_ONE_64 << PID_FIXED_ACC_FRAC;
+        pid->out_acc_min = -(Q31_ONE_64 << PID_FIXED_ACC_FRAC);
+        PID_Inc_Fixed_SetDeltaLimit(pid, 0.2f);
+    }
+
+    pid->initialized = 1;
+}
+
+/**
+ * @brief 设置单次增量上限
+ */
+void PID_Inc_Fixed_SetDeltaLimit(PID_Inc_Fixed_t *pid, float delta_max)
+{
+    if (pid == NULL)
+        return;
+    pid->delta_acc_max = Q_Int64FromFloat(delta_max, PID_FIXED_ACC_FRAC, ACC_TERM_MAX);
+}
+
+/**
+ * @brief 设置目标值 (Q31)
+ */
+void PID_Inc_Q31_SetSetpoint(PID_Inc_Fixed_t *pid, q31_t setpoint)
+{
+    if (pid == NULL)
+        return;
+    pid->setpoint = setpoint;
+}
+
+/**
+ * @brief 设置目标值 (Q15)
+ */
+void PID_Inc_Q15_SetSetpoint(PID_Inc_Fixed_t *pid, q15_t setpoint)
+{
+    PID_Inc_Q31_SetSetpoint(pid, Q15_ToQ31(setpoint));
+}
+
+/**
+ * @brief 定点增量式PID计算 (Q31)
+ * @note 增量式PID: Δu = Kp*(e[k]-e[k-1]) + Ki*dt*e[k] + Kd/dt*(e[k]-2*e[k-1]+e[k-2])
+ */
+q31_t PID_Inc_Q31_Update(PID_Inc_Fixed_t *pid, q31_t feedback)
+{
+    if (pid == NULL || !pid->initialized)
+        return 0;
+
+    // 计算误差
+    pid->error = (int64_t)pid->setpoint - feedback;
+
+    // 计算增量 (保留 PID_FIXED_ACC_FRAC 位额外小数)
+    int64_t delta_P = Q_MulGain(pid->error - pid->last_error, pid->kp, PID_FIXED_ACC_FRAC);
+    int64_t delta_I = Q_MulGain(pid->error, pid->ki_dt, PID_FIXED_ACC_FRAC);
+    int64_t delta_D = Q_MulGain(pid->error - 2 * pid->last_error + pid->prev_error, pid->kd_dt, PID_FIXED_ACC_FRAC);
+
+    // 增量限幅
+    int64_t delta = Q_Clamp(delta_P + delta_I + delta_D, pid->delta_acc_max);
+
+    // 累加输出并限幅
+    pid->out_acc = FIXED_LIMIT(pid->out_acc + delta, pid->out_acc_min, pid->out_acc_max);
+
+    // 保存历史误差
+    pid->prev_error = pid->last_error;
+    pid->last_error = pid->error;
+
+    return Q31_Sat(Q_RoundShift(pid->out_acc, PID_FIXED_ACC_FRAC));
+}
+
+/**
+ * @brief 定点增量式PID计算 (Q15)
+ */
+q15_t PID_Inc_Q15_Update(PID_Inc_Fixed_t *pid, q15_t feedback)
+{
+    return Q31_ToQ15(PID_Inc_Q31_Update(pid, Q15_ToQ31(feedback)));
+}
+
+/**
+ * @brief 重置定点增量式PID控制器
+ */
+void PID_Inc_Fixed_Reset(PID_Inc_Fixed_t *pid)
+{
+    if (pid == NULL)
+        return;
+
+    pid->setpoint = 0;
+    pid->error = 0;
+    pid->last_error = 0;
+    pid->prev_error = 0;
+    pid->out_acc = 0;
+}
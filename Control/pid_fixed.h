@@ -0,0 +1,187 @@
+/**
+ * @file pid_fixed.h
+ * @brief 定点PID控制器 (Q15 / Q31)
+ * @details 位置式与增量式PID的定点版本，计算步骤与 PID_Update / PID_Inc_Update 一一对应：
+ *          - 由 PID_Config_t 初始化，增益换算为 Kp、Ki·dt、Kd/dt 三个定点增益，更新时不再乘除 dt
+ *          - 积分在积分项 (Ki·∫e dt) 上累加并限幅，抗积分饱和直接减去输出超出量，不需要除以 Ki
+ *          - 积分项与增量式输出额外保留 16 位小数，Ki·dt 很小时误差也能逐步累积
+ *          - 同一个结构体提供 Q15 与 Q31 更新函数，内部状态统一为 Q31 刻度
+ *
+ *          与浮点版本的差异：
+ *          - 设定值、反馈与输出限幅须归一化到 [-1, 1)，Kp、Ki·dt、Kd/dt 的绝对值小于 2048
+ *          - P、I、D 各项在 ±8.0 处饱和 (输出已限幅在 [-1, 1) 内，只影响极端配置)
+ *          - 微分滤波只支持一阶低通 (PID_Fixed_SetDerivativeLowPass)，不支持设定值/反馈/输出滤波
+ *          - 积分限幅随 Ki 换算，修改参数需重新 PID_Fixed_Init
+ *
+ * 使用方法：
+ * @code
+ * static PID_Fixed_t speed_pid;
+ *
+ * PID_Fixed_Init(&speed_pid, &speed_cfg); // 增益、限幅按归一化后的单位给出
+ * PID_Q15_SetSetpoint(&speed_pid, Q15_FromFloat(0.25f));
+ * q15_t duty = PID_Q15_Update(&speed_pid, speed_q15);
+ * @endcode
+ */
+
+#ifndef __PID_FIXED_H
+#define __PID_FIXED_H
+
+#include <stdint.h>
+#include "fixed.h"
+#include "pid.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*============================================================================
+ *                              PID配置
+ *============================================================================*/
+#define PID_FIXED_TERM_MAX (((int64_t)8 << 31) - 1) // P、I、D 各项的饱和值 (Q31 刻度的 8.0)
+#define PID_FIXED_ACC_FRAC 16                       // 积分项/增量式输出额外保留的小数位数
+
+    /*============================================================================
+     *                              PID类型定义
+     *============================================================================*/
+
+    /**
+     * @brief 定点PID控制器 (位置式)
+     * @note 带 _acc 后缀的量为 Q31 再左移 PID_FIXED_ACC_FRAC 位
+     */
+    typedef struct
+    {
+        /* PID参数 */
+        q_gain_t kp;    // Kp
+        q_gain_t ki_dt; // Ki * dt
+        q_gain_t kd_dt; // Kd / dt
+
+        /* 限幅参数 */
+        q31_t output_max;   // 输出上限
+        q31_t output_min;   // 输出下限
+        int64_t i_acc_max;  // 积分项上限 (Ki * integral_max)
+        int64_t i_acc_min;  // 积分项下限 (Ki * integral_min)
+        q31_t deadband;     // 死区
+
+        /* 微分项一阶低通 */
+        q_gain_t d_alpha;  // 滤波系数
+        uint8_t d_filter;  // 使能
+        uint8_t d_started; // 已有输出 (首次直接输出输入值)
+
+        /* 功能开关 */
+        uint8_t anti_windup;               // 抗积分饱和使能
+        uint8_t derivative_on_measurement; // 基于测量值微分
+
+        /* 运行时变量 */
+        q31_t setpoint;      // 目标值
+        q31_t feedback;      // 反馈值
+        q31_t last_feedback; // 上次反馈值
+        int64_t error;       // 当前误差 (可超出 [-1, 1))
+        int64_t last_error;  // 上次误差
+        int64_t i_acc;       // 积分项
+        int64_t d_term;      // 微分项
+        q31_t output;        // 输出值
+
+        uint8_t initialized; // 初始化标志
+    } PID_Fixed_t;
+
+    /**
+     * @brief 定点PID控制器 (增量式)
+     */
+    typedef struct
+    {
+        /* PID参数 */
+        q_gain_t kp;    // Kp
+        q_gain_t ki_dt; // Ki * dt
+        q_gain_t kd_dt; // Kd / dt
+
+        /* 限幅参数 */
+        int64_t out_acc_max;   // 输出上限
+        int64_t out_acc_min;   // 输出下限
+        int64_t delta_acc_max; // 单次增量上限
+
+        /* 运行时变量 */
+        q31_t setpoint;     // 目标值
+        int64_t error;      // 当前误差
+        int64_t last_error; // 上次误差
+        int64_t prev_error; // 上上次误差
+        int64_t out_acc;    // 累计输出
+
+        uint8_t initialized; // 初始化标志
+    } PID_Inc_Fixed_t;
+
+    /*============================================================================
+     *                              函数声明 - 位置式PID
+     *============================================================================*/
+
+    /**
+     * @brief 初始化定点PID，config 为 NULL 时使用 PID_Init 的默认增益与 [-1, 1) 输出限幅
+     */
+    void PID_Fixed_Init(PID_Fixed_t *pid, const PID_Config_t *config);
+
+    /**
+     * @brief 设置微分项一阶低通系数并使能，等效于 LowPass_Init + PID_SetDerivativeFilter
+     */
+    void PID_Fixed_SetDerivativeLowPass(PID_Fixed_t *pid, float alpha);
+
+    /**
+     * @brief 设置目标值
+     */
+    void PID_Q15_SetSetpoint(PID_Fixed_t *pid, q15_t setpoint);
+    void PID_Q31_SetSetpoint(PID_Fixed_t *pid, q31_t setpoint);
+
+    /**
+     * @brief PID计算
+     * @param feedback 反馈值
+     * @return 控制输出
+     */
+    q15_t PID_Q15_Update(PID_Fixed_t *pid, q15_t feedback);
+    q31_t PID_Q31_Update(PID_Fixed_t *pid, q31_t feedback);
+
+    /**
+     * @brief 重置PID控制器运行时变量 (参数与微分滤波器状态保留)
+     */
+    void PID_Fixed_Reset(PID_Fixed_t *pid);
+
+    /**
+     * @brief 获取积分项 (Ki * integral)
+     */
+    q31_t PID_Fixed_GetIntegral(PID_Fixed_t *pid);
+
+    /*============================================================================
+     *                              函数声明 - 增量式PID
+     *============================================================================*/
+
+    /**
+     * @brief 初始化定点增量式PID，单次增量上限默认为输出范围的 10%
+     */
+    void PID_Inc_Fixed_Init(PID_Inc_Fixed_t *pid, const PID_Config_t *config);
+
+    /**
+     * @brief 设置单次增量上限
+     */
+    void PID_Inc_Fixed_SetDeltaLimit(PID_Inc_Fixed_t *pid, float delta_max);
+
+    /**
+     * @brief 设置目标值
+     */
+    void PID_Inc_Q15_SetSetpoint(PID_Inc_Fixed_t *pid, q15_t setpoint);
+    void PID_Inc_Q31_SetSetpoint(PID_Inc_Fixed_t *pid, q31_t setpoint);
+
+    /**
+     * @brief 增量式PID计算
+     * @return 累计输出
+     */
+    q15_t PID_Inc_Q15_Update(PID_Inc_Fixed_t *pid, q15_t feedback);
+    q31_t PID_Inc_Q31_Update(PID_Inc_Fixed_t *pid, q31_t feedback);
+
+    /**
+     * @brief 重置增量式PID运行时变量
+     */
+    void PID_Inc_Fixed_Reset(PID_Inc_Fixed_t *pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PID_FIXED_H */
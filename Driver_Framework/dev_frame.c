@@ -1,6 +1,8 @@
 #include "dev_frame.h"
 #include "df_log.h"
 #include "df_init.h"
+#include "df_shell.h"
+#include <driver.h>
 #include <string.h>
 
 // ============ 错误码转字符串 ============
@@ -33,6 +35,163 @@ const char *df_err_to_str(df_err_t err)
     }
 }
 
+// ============ 名称哈希索引 ============
+// 开放定址、线性探测；哈希值单独存放，探测时只访问这两个数组
+static df_dev_t *df_dev_index[DF_DEV_HASH_SIZE];
+static uint32_t df_dev_index_hash[DF_DEV_HASH_SIZE];
+
+#if DF_DEV_STATS
+// 统计表与设备本身分开存放，索引槽记录统计表下标
+#define DF_DEV_STAT_NONE 0xFF
+static uint8_t df_dev_index_stat[DF_DEV_HASH_SIZE];
+static df_dev_t *df_dev_stat_dev[DF_DEV_STATS_MAX];
+static df_dev_op_stats_t df_dev_stats[DF_DEV_STATS_MAX][DF_DEV_OP_NUM];
+static uint8_t df_dev_stat_num = 0;
+#endif
+
+/**
+ * @brief 把注册表条目加入名称索引
+ * @details 哈希值相同的两个设备（重名或碰撞）只保留先注册的一个，
+ *          保证 df_dev_get_hash() 无需比较字符串
+ */
+static int df_dev_index_add(df_dev_t *dev)
+{
+    uint32_t mask = DF_DEV_HASH_SIZE - 1;
+    uint32_t i = dev->hash & mask;
+
+    for (uint32_t n = 0; n < DF_DEV_HASH_SIZE; n++, i = (i + 1) & mask)
+    {
+        if (df_dev_index[i] == dev)
+        {
+            return DF_OK; // 重复注册同一张表
+        }
+        if (df_dev_index[i] == NULL)
+        {
+            df_dev_index[i] = dev;
+            df_dev_index_hash[i] = dev->hash;
+#if DF_DEV_STATS
+            df_dev_index_stat[i] = DF_DEV_STAT_NONE;
+            if (df_dev_stat_num < DF_DEV_STATS_MAX)
+            {
+                df_dev_stat_dev[df_dev_stat_num] = dev;
+                df_dev_index_stat[i] = df_dev_stat_num++;
+            }
+#endif
+            return DF_OK;
+        }
+        if (df_dev_index_hash[i] == dev->hash)
+        {
+            if (strcmp(df_dev_index[i]->name, dev->name) == 0)
+            {
+                LOG_E("DEV", "Device '%s' already registered", dev->name);
+            }
+            else
+            {
+                LOG_E("DEV", "Device '%s' name hash conflicts with '%s'", dev->name,
+                      df_dev_index[i]->name);
+            }
+            return DF_ERR_ALREADY;
+        }
+    }
+    LOG_E("DEV", "Device '%s' not indexed: DF_DEV_HASH_SIZE too small", dev->name);
+    return DF_ERR_NO_MEM;
+}
+
+/**
+ * @brief 清空名称索引与统计表
+ * @details 注册另一张设备表时调用，旧表的句柄不再可查
+ */
+static void df_dev_index_clear(void)
+{
+    memset(df_dev_index, 0, sizeof(df_dev_index));
+    memset(df_dev_index_hash, 0, sizeof(df_dev_index_hash));
+#if DF_DEV_STATS
+    memset(df_dev_index_stat, DF_DEV_STAT_NONE, sizeof(df_dev_index_stat));
+    memset(df_dev_stat_dev, 0, sizeof(df_dev_stat_dev));
+    memset(df_dev_stats, 0, sizeof(df_dev_stats));
+    df_dev_stat_num = 0;
+#endif
+}
+
+df_dev_t *df_dev_get_hash(uint32_t hash)
+{
+    uint32_t mask = DF_DEV_HASH_SIZE - 1;
+    uint32_t i = hash & mask;
+
+    for (uint32_t n = 0; n < DF_DEV_HASH_SIZE && df_dev_index[i] != NULL; n++, i = (i + 1) & mask)
+    {
+        if (df_dev_index_hash[i] == hash)
+        {
+            return df_dev_index[i];
+        }
+    }
+    return NULL;
+}
+
+df_dev_t *df_dev_get(const char *name)
+{
+    if (name == NULL)
+    {
+        return NULL;
+    }
+    // 未注册的名称可能与已注册设备哈希相同，比较一次确认
+    df_dev_t *dev = df_dev_get_hash(df_dev_hash(name));
+    return (dev != NULL && strcmp(dev->name, name) == 0) ? dev : NULL;
+}
+
+// ============ 设备初始化 ============
+static df_dev_t *df_dev_table = NULL; // 最近注册的设备表，供 Shell 命令查看
+
+/**
+ * @brief 调用 init() 并记录耗时
+ */
+static int df_dev_do_init(df_dev_t *dev)
+{
+    uint64_t t0 = get_cycles64();
+    int ret = dev->init(dev->arg);
+    uint64_t cycles = get_cycles64() - t0;
+
+    dev->init_cycles = (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+    if (dev->init_cycles == 0)
+    {
+        dev->init_cycles = 1; // 0 表示未执行
+    }
+    if (ret == DF_OK)
+    {
+        dev->status = DF_STATE_INITIALIZED;
+        LOG_I("DEV", "Device '%s' initialized successfully", dev->name);
+    }
+    else
+    {
+        dev->status = DF_STATE_ERROR;
+        LOG_E("DEV", "Device '%s' initialization failed: %s", dev->name, df_err_to_str(ret));
+    }
+    return ret;
+}
+
+/**
+ * @brief 延迟初始化设备首次使用时执行 init()
+ * @details 状态保存在注册表条目中，df_dev_find() 得到的多个副本只会初始化一次
+ * @return DF_OK 可以继续操作，其他为初始化失败
+ */
+static int df_dev_lazy_init(df_dev_t *device)
+{
+    df_dev_t *dev = (device->origin != NULL) ? device->origin : device;
+
+    if ((dev->flags & DF_DEV_FLAG_LAZY) && dev->status == DF_STATE_UNINITIALIZED &&
+        dev->init != NULL)
+    {
+        LOG_I("DEV", "Device '%s' first use, initializing", dev->name);
+        df_dev_do_init(dev);
+    }
+    if (device != dev && device->status == DF_STATE_UNINITIALIZED)
+    {
+        device->status = dev->status;
+        device->init_cycles = dev->init_cycles;
+    }
+    return (device->status == DF_STATE_ERROR) ? DF_ERR_NOT_INIT : DF_OK;
+}
+
 // ============ 设备注册 ============
 int df_dev_register(df_dev_t dev_info[])
 {
@@ -44,29 +203,43 @@ int df_dev_register(df_dev_t dev_info[])
 
     unsigned int i = 0;
     int success_count = 0;
+    int lazy_count = 0;
+    int reject_count = 0;
 
+    // 索引只对应最近注册的一张表
+    if (dev_info != df_dev_table)
+    {
+        df_dev_index_clear();
+    }
+    df_dev_table = dev_info;
     while (dev_info[i].name[0] != '\0')
     {
         // 分配索引
         dev_info[i].index = i;
         dev_info[i].ref_count = 0;
+        dev_info[i].init_cycles = 0;
+        dev_info[i].origin = &dev_info[i];
+        dev_info[i].hash = df_dev_hash(dev_info[i].name);
 
+        // 重名或哈希碰撞的条目不初始化，标记为错误，打开时返回 DF_ERR_NOT_INIT
+        if (df_dev_index_add(&dev_info[i]) == DF_ERR_ALREADY)
+        {
+            dev_info[i].status = DF_STATE_ERROR;
+            reject_count++;
+        }
         // 初始化设备状态
-        if (dev_info[i].init != NULL)
+        else if (dev_info[i].init != NULL && (dev_info[i].flags & DF_DEV_FLAG_LAZY))
+        {
+            dev_info[i].status = DF_STATE_UNINITIALIZED;
+            LOG_I("DEV", "Device '%s' init deferred to first use", dev_info[i].name);
+            lazy_count++;
+        }
+        else if (dev_info[i].init != NULL)
         {
-            int ret = dev_info[i].init(dev_info[i].arg);
-            if (ret == DF_OK)
+            if (df_dev_do_init(&dev_info[i]) == DF_OK)
             {
-                dev_info[i].status = DF_STATE_INITIALIZED;
-                LOG_I("DEV", "Device '%s' initialized successfully", dev_info[i].name);
                 success_count++;
             }
-            else
-            {
-                dev_info[i].status = DF_STATE_ERROR;
-                LOG_E("DEV", "Device '%s' initialization failed: %s",
-                      dev_info[i].name, df_err_to_str(ret));
-            }
         }
         else
         {
@@ -78,10 +251,62 @@ int df_dev_register(df_dev_t dev_info[])
 
     LOG_I("DEV", "Device registration complete: %d/%d devices initialized",
           success_count, i);
+    if (lazy_count > 0)
+    {
+        LOG_I("DEV", "%d lazy devices will initialize on first open", lazy_count);
+    }
+    if (reject_count > 0)
+    {
+        LOG_E("DEV", "%d devices rejected: duplicate name or hash conflict", reject_count);
+        return DF_ERR_ALREADY;
+    }
 
     return DF_OK;
 }
 
+// ============ 启动报告 ============
+void df_dev_report(df_dev_t dev_info[])
+{
+    uint32_t cpu_us = SystemCoreClock / 1000000;
+    uint64_t eager = 0;
+    uint64_t lazy_done = 0;
+    int never = 0;
+
+    if (dev_info == NULL)
+    {
+        return;
+    }
+    LOG_I("DEV", "name                 policy  state          init(us)");
+    for (unsigned int i = 0; dev_info[i].name[0] != '\0'; i++)
+    {
+        const df_dev_t *dev = &dev_info[i];
+        bool lazy = (dev->flags & DF_DEV_FLAG_LAZY) != 0;
+        const char *state = (dev->status == DF_STATE_ERROR)           ? "error"
+                            : (dev->status == DF_STATE_UNINITIALIZED) ? "uninitialized"
+                            : (dev->status == DF_STATE_ENABLED)       ? "enabled"
+                            : (dev->status == DF_STATE_DISABLED)      ? "disabled"
+                                                                      : "initialized";
+
+        if (lazy && dev->init_cycles == 0)
+        {
+            never++;
+        }
+        else if (lazy)
+        {
+            lazy_done += dev->init_cycles;
+        }
+        else
+        {
+            eager += dev->init_cycles;
+        }
+        LOG_I("DEV", "%-20s %-7s %-13s %9u", dev->name, lazy ? "lazy" : "eager", state,
+              (unsigned)(dev->init_cycles / cpu_us));
+        log_flush();
+    }
+    LOG_I("DEV", "boot init %u us; lazy init moved out of boot %u us, %d lazy devices never opened",
+          (unsigned)(eager / cpu_us), (unsigned)(lazy_done / cpu_us), never);
+}
+
 // ============ 设备查找 ============
 int df_dev_find(df_dev_t dev_info[], const char *name, df_dev_t *device)
 {
@@ -107,7 +332,7 @@ int df_dev_find(df_dev_t dev_info[], const char *name, df_dev_t *device)
 }
 
 // ============ 设备打开 ============
-int df_dev_open(df_dev_t *device)
+static int df_dev_open_op(df_dev_t *device)
 {
     if (device == NULL)
     {
@@ -115,6 +340,12 @@ int df_dev_open(df_dev_t *device)
         return DF_ERR_PARAM;
     }
 
+    int lazy = df_dev_lazy_init(device);
+    if (lazy != DF_OK)
+    {
+        return lazy;
+    }
+
     if (device->status != DF_STATE_INITIALIZED &&
         device->status != DF_STATE_DISABLED)
     {
@@ -144,7 +375,7 @@ int df_dev_open(df_dev_t *device)
 }
 
 // ============ 设备关闭 ============
-int df_dev_close(df_dev_t *device)
+static int df_dev_close_op(df_dev_t *device)
 {
     if (device == NULL)
     {
@@ -177,7 +408,7 @@ int df_dev_close(df_dev_t *device)
 }
 
 
-int df_dev_read(df_dev_t *device, df_arg_t arg)
+static int df_dev_read_op(df_dev_t *device, df_arg_t arg)
 {
     if (device == NULL)
     {
@@ -191,12 +422,18 @@ int df_dev_read(df_dev_t *device, df_arg_t arg)
         return DF_ERR_NOT_SUPPORT;
     }
 
+    int lazy = df_dev_lazy_init(device);
+    if (lazy != DF_OK)
+    {
+        return lazy;
+    }
+
     LOG_D("DEV", "Device '%s' read operation\n", device->name);
     return device->read(arg);
 }
 
 // ============ 设备启用 ============
-int df_dev_enable(df_dev_t *device)
+static int df_dev_enable_op(df_dev_t *device)
 {
     if (device == NULL)
     {
@@ -210,6 +447,12 @@ int df_dev_enable(df_dev_t *device)
         return DF_ERR_ALREADY;
     }
 
+    int lazy = df_dev_lazy_init(device);
+    if (lazy != DF_OK)
+    {
+        return lazy;
+    }
+
     if (device->enable != NULL)
     {
         int ret = device->enable(device->arg);
@@ -226,7 +469,7 @@ int df_dev_enable(df_dev_t *device)
 }
 
 // ============ 设备禁用 ============
-int df_dev_disable(df_dev_t *device)
+static int df_dev_disable_op(df_dev_t *device)
 {
     if (device == NULL)
     {
@@ -256,7 +499,7 @@ int df_dev_disable(df_dev_t *device)
 }
 
 // ============ 设备控制 ============
-int df_dev_ioctl(df_dev_t *device, int cmd, df_arg_t arg)
+static int df_dev_ioctl_op(df_dev_t *device, int cmd, df_arg_t arg)
 {
     if (device == NULL)
     {
@@ -270,8 +513,270 @@ int df_dev_ioctl(df_dev_t *device, int cmd, df_arg_t arg)
         return DF_ERR_NOT_SUPPORT;
     }
 
+    int lazy = df_dev_lazy_init(device);
+    if (lazy != DF_OK)
+    {
+        return lazy;
+    }
+
     LOG_D("DEV", "Device '%s' ioctl cmd=0x%02X\n", device->name, cmd);
     return device->ioctl(cmd, arg);
 }
 
+// ============ 操作统计 ============
+#if DF_DEV_STATS
+/**
+ * @brief 设备（或其副本）对应的统计项，未统计返回 NULL
+ */
+static df_dev_op_stats_t *df_dev_stat_of(const df_dev_t *device)
+{
+    const df_dev_t *dev = (device->origin != NULL) ? device->origin : device;
+    uint32_t mask = DF_DEV_HASH_SIZE - 1;
+    uint32_t i = dev->hash & mask;
+
+    for (uint32_t n = 0; n < DF_DEV_HASH_SIZE && df_dev_index[i] != NULL; n++, i = (i + 1) & mask)
+    {
+        if (df_dev_index[i] == dev)
+        {
+            uint8_t id = df_dev_index_stat[i];
+            return (id != DF_DEV_STAT_NONE) ? df_dev_stats[id] : NULL;
+        }
+    }
+    return NULL;
+}
+
+static void df_dev_stat_record(const df_dev_t *device, df_dev_op_t op, uint64_t t0, int ret)
+{
+    uint64_t elapsed = get_cycles64() - t0;
+    df_dev_op_stats_t *st;
+
+    if (device == NULL || (st = df_dev_stat_of(device)) == NULL)
+    {
+        return;
+    }
+    st = &st[op];
+
+    uint32_t cycles = (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+    uint32_t v = cycles >> DF_DEV_HIST_SHIFT;
+    uint32_t b = (v == 0) ? 0 : 32 - __builtin_clz(v);
+    if (b >= DF_DEV_HIST_BUCKETS)
+    {
+        b = DF_DEV_HIST_BUCKETS - 1;
+    }
+
+    if (st->calls == 0 || cycles < st->min)
+    {
+        st->min = cycles;
+    }
+    if (cycles > st->max)
+    {
+        st->max = cycles;
+    }
+    st->calls++;
+    st->total += cycles;
+    if (ret < 0)
+    {
+        st->errors++;
+    }
+    if (st->hist[b] != UINT16_MAX)
+    {
+        st->hist[b]++;
+    }
+}
+
+#define DF_DEV_STAT_BEGIN() get_cycles64()
+#define DF_DEV_STAT_END(device, op, t0, ret) df_dev_stat_record((device), (op), (t0), (ret))
+#else
+#define DF_DEV_STAT_BEGIN() 0
+#define DF_DEV_STAT_END(device, op, t0, ret) ((void)(t0))
+#endif
+
+int df_dev_open(df_dev_t *device)
+{
+    uint64_t t0 = DF_DEV_STAT_BEGIN();
+    int ret = df_dev_open_op(device);
+    DF_DEV_STAT_END(device, DF_DEV_OP_OPEN, t0, ret);
+    return ret;
+}
+
+int df_dev_close(df_dev_t *device)
+{
+    uint64_t t0 = DF_DEV_STAT_BEGIN();
+    int ret = df_dev_close_op(device);
+    DF_DEV_STAT_END(device, DF_DEV_OP_CLOSE, t0, ret);
+    return ret;
+}
+
+int df_dev_read(df_dev_t *device, df_arg_t arg)
+{
+    uint64_t t0 = DF_DEV_STAT_BEGIN();
+    int ret = df_dev_read_op(device, arg);
+    DF_DEV_STAT_END(device, DF_DEV_OP_READ, t0, ret);
+    return ret;
+}
+
+int df_dev_enable(df_dev_t *device)
+{
+    uint64_t t0 = DF_DEV_STAT_BEGIN();
+    int ret = df_dev_enable_op(device);
+    DF_DEV_STAT_END(device, DF_DEV_OP_ENABLE, t0, ret);
+    return ret;
+}
+
+int df_dev_disable(df_dev_t *device)
+{
+    uint64_t t0 = DF_DEV_STAT_BEGIN();
+    int ret = df_dev_disable_op(device);
+    DF_DEV_STAT_END(device, DF_DEV_OP_DISABLE, t0, ret);
+    return ret;
+}
+
+int df_dev_ioctl(df_dev_t *device, int cmd, df_arg_t arg)
+{
+    uint64_t t0 = DF_DEV_STAT_BEGIN();
+    int ret = df_dev_ioctl_op(device, cmd, arg);
+    DF_DEV_STAT_END(device, DF_DEV_OP_IOCTL, t0, ret);
+    return ret;
+}
 
+int df_dev_get_stats(const df_dev_t *device, df_dev_op_t op, df_dev_op_stats_t *stats)
+{
+#if DF_DEV_STATS
+    df_dev_op_stats_t *st;
+
+    if (device == NULL || stats == NULL || op >= DF_DEV_OP_NUM)
+    {
+        return DF_ERR_PARAM;
+    }
+    if ((st = df_dev_stat_of(device)) == NULL)
+    {
+        return DF_ERR_NOT_FOUND;
+    }
+    *stats = st[op];
+    return DF_OK;
+#else
+    return DF_ERR_NOT_SUPPORT;
+#endif
+}
+
+void df_dev_reset_stats(void)
+{
+#if DF_DEV_STATS
+    memset(df_dev_stats, 0, sizeof(df_dev_stats));
+#endif
+}
+
+#if DF_DEV_STATS
+static const char *const df_dev_op_name[DF_DEV_OP_NUM] = {"open", "close", "read",
+                                                           "enable", "disable", "ioctl"};
+
+/**
+ * @brief 直方图中累计达到 permille/1000 的桶的上限（周期）
+ */
+static uint32_t df_dev_hist_bound(const df_dev_op_stats_t *st, uint32_t permille)
+{
+    uint32_t total = 0, sum = 0;
+    for (int b = 0; b < DF_DEV_HIST_BUCKETS; b++)
+    {
+        total += st->hist[b];
+    }
+    for (int b = 0; b < DF_DEV_HIST_BUCKETS - 1; b++)
+    {
+        sum += st->hist[b];
+        if ((uint64_t)sum * 1000 >= (uint64_t)total * permille)
+        {
+            return 1u << (b + DF_DEV_HIST_SHIFT);
+        }
+    }
+    return st->max;
+}
+#endif
+
+void df_dev_log_stats(void)
+{
+#if DF_DEV_STATS
+    for (int d = 0; d < df_dev_stat_num; d++)
+    {
+        for (int op = 0; op < DF_DEV_OP_NUM; op++)
+        {
+            const df_dev_op_stats_t *st = &df_dev_stats[d][op];
+            if (st->calls == 0)
+            {
+                continue;
+            }
+            LOG_I("DEV", "%-16s %-7s calls %u err %u cyc min %u avg %u max %u p50<=%u p99<=%u",
+                  df_dev_stat_dev[d]->name, df_dev_op_name[op], (unsigned)st->calls,
+                  (unsigned)st->errors, (unsigned)st->min, (unsigned)(st->total / st->calls),
+                  (unsigned)st->max, (unsigned)df_dev_hist_bound(st, 500),
+                  (unsigned)df_dev_hist_bound(st, 990));
+            log_flush();
+        }
+    }
+#endif
+}
+
+// ============ Shell 命令 ============
+/**
+ * @brief dev  查看设备初始化策略、状态与耗时
+ */
+static void df_dev_cmd(int argc, void *argv[])
+{
+    uint32_t cpu_us = SystemCoreClock / 1000000;
+
+    if (df_dev_table == NULL)
+    {
+        shell_printf("no device registered\n");
+        return;
+    }
+    shell_printf("name                 policy  status  init(us)\n");
+    for (unsigned int i = 0; df_dev_table[i].name[0] != '\0'; i++)
+    {
+        const df_dev_t *dev = &df_dev_table[i];
+        shell_printf("%-20s %-7s %6d %9u\n", dev->name,
+                     (dev->flags & DF_DEV_FLAG_LAZY) ? "lazy" : "eager", (int)dev->status,
+                     (unsigned)(dev->init_cycles / cpu_us));
+    }
+}
+DF_SHELL_CMD(dev, df_dev_cmd, "list devices, init policy and duration");
+
+#if DF_DEV_STATS
+/**
+ * @brief devstat        查看各设备操作统计与耗时直方图
+ *        devstat reset  清零统计
+ */
+static void df_dev_stat_cmd(int argc, void *argv[])
+{
+    if (argc > 1 && strcmp((char *)argv[0], "reset") == 0)
+    {
+        df_dev_reset_stats();
+        return;
+    }
+    shell_printf("device           op          calls   err  min(cyc)  avg(cyc)  max(cyc)\n");
+    for (int d = 0; d < df_dev_stat_num; d++)
+    {
+        for (int op = 0; op < DF_DEV_OP_NUM; op++)
+        {
+            const df_dev_op_stats_t *st = &df_dev_stats[d][op];
+            if (st->calls == 0)
+            {
+                continue;
+            }
+            shell_printf("%-16s %-7s %9u %5u %9u %9u %9u\n", df_dev_stat_dev[d]->name,
+                         df_dev_op_name[op], (unsigned)st->calls, (unsigned)st->errors,
+                         (unsigned)st->min, (unsigned)(st->total / st->calls), (unsigned)st->max);
+            shell_printf("  hist");
+            for (int b = 0; b < DF_DEV_HIST_BUCKETS; b++)
+            {
+                if (st->hist[b] != 0)
+                {
+                    shell_printf(" %s%u:%u", (b == 0) ? "<" : ">=",
+                                 1u << (b == 0 ? DF_DEV_HIST_SHIFT : b + DF_DEV_HIST_SHIFT - 1),
+                                 (unsigned)st->hist[b]);
+                }
+            }
+            shell_printf("\n");
+        }
+    }
+}
+DF_SHELL_CMD(devstat, df_dev_stat_cmd, "device op stats, 'devstat reset' to clear");
+#endif
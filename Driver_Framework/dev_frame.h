@@ -69,6 +69,35 @@ typedef enum
   DF_CTRL_CUSTOM = 0x80      // 自定义命令起始
 } df_ctrl_cmd_t;
 
+// ============ 名称索引配置 ============
+#ifndef DF_DEV_HASH_SIZE
+#define DF_DEV_HASH_SIZE 32 // 名称哈希索引槽数（2的幂），可注册的设备总数上限
+#endif
+
+#if (DF_DEV_HASH_SIZE & (DF_DEV_HASH_SIZE - 1)) != 0
+#error "DF_DEV_HASH_SIZE must be a power of 2"
+#endif
+
+// ============ 操作统计配置 ============
+#ifndef DF_DEV_STATS
+#define DF_DEV_STATS 1 // 1: 统计各设备 open/close/read/enable/disable/ioctl 的次数、错误与耗时
+#endif
+
+#ifndef DF_DEV_STATS_MAX
+#define DF_DEV_STATS_MAX 8 // 统计表容量（设备数），按注册顺序分配，超出的设备不统计
+#endif
+
+#ifndef DF_DEV_HIST_BUCKETS
+#define DF_DEV_HIST_BUCKETS 16 // 耗时直方图桶数
+#endif
+
+#ifndef DF_DEV_HIST_SHIFT
+#define DF_DEV_HIST_SHIFT 6 // 第0桶 < 2^6 周期，第 i 桶 [2^(i+5), 2^(i+6))，最后一桶包含更长的
+#endif
+
+// ============ 设备标志 ============
+#define DF_DEV_FLAG_LAZY 0x01 // 延迟初始化：注册时不调用 init()，首次 open/enable/read/ioctl 时调用
+
 // ============ 设备模型核心结构 ============
 typedef struct df_dev_struct
 {
@@ -90,16 +119,65 @@ typedef struct df_dev_struct
   int (*ioctl)(int cmd, df_arg_t); // 控制命令接口
 
   void **priv;   // 私有数据指针
+
+  uint8_t flags;                // DF_DEV_FLAG_xxx
+  uint32_t init_cycles;         // init() 耗时（内核周期），未执行为 0
+  struct df_dev_struct *origin; // 注册表中的条目，df_dev_find() 返回的副本经由它共享初始化状态
+  uint32_t hash;                // 名称哈希，注册时计算
 } df_dev_t;
 
+// ============ 操作统计 ============
+typedef enum
+{
+  DF_DEV_OP_OPEN = 0,
+  DF_DEV_OP_CLOSE,
+  DF_DEV_OP_READ,
+  DF_DEV_OP_ENABLE,
+  DF_DEV_OP_DISABLE,
+  DF_DEV_OP_IOCTL,
+  DF_DEV_OP_NUM
+} df_dev_op_t;
+
+typedef struct
+{
+  uint32_t calls;                         // 调用次数
+  uint32_t errors;                        // 返回值小于0的次数
+  uint32_t min;                           // 最小耗时（周期）
+  uint32_t max;                           // 最大耗时（周期）
+  uint64_t total;                         // 耗时累计（周期），平均值 = total / calls
+  uint16_t hist[DF_DEV_HIST_BUCKETS];     // log2 耗时直方图，计数饱和于 65535
+} df_dev_op_stats_t;
+
+// ============ 名称哈希 ============
+/**
+ * @brief 设备名称哈希（FNV-1a 32位）
+ * @details 热路径中可预先计算一次，之后以 df_dev_get_hash() 查找，不再比较字符串
+ */
+static inline uint32_t df_dev_hash(const char *name)
+{
+  uint32_t h = 2166136261u;
+  while (*name != '\0')
+  {
+    h = (h ^ (uint8_t)*name++) * 16777619u;
+  }
+  return h;
+}
+
 // ============ 核心函数声明 ============
-int df_dev_register(df_dev_t dev_info[]);
-int df_dev_find(df_dev_t dev_info[], const char *name, df_dev_t *device);
+int df_dev_register(df_dev_t dev_info[]); // 注册另一张表时清空名称索引；有重名/哈希碰撞的条目时返回 DF_ERR_ALREADY，该条目不初始化
+int df_dev_find(df_dev_t dev_info[], const char *name, df_dev_t *device); // 按值复制，状态不回写注册表，建议改用 df_dev_get()
+df_dev_t *df_dev_get(const char *name);    // 返回注册表条目（句柄），未找到返回 NULL
+df_dev_t *df_dev_get_hash(uint32_t hash);  // 按预计算的 df_dev_hash() 查找，不比较字符串
 int df_dev_open(df_dev_t *device);
 int df_dev_close(df_dev_t *device);
 int df_dev_enable(df_dev_t *device);
 int df_dev_disable(df_dev_t *device);
+int df_dev_read(df_dev_t *device, df_arg_t arg);
 int df_dev_ioctl(df_dev_t *device, int cmd, df_arg_t arg);
+void df_dev_report(df_dev_t dev_info[]); // 输出各设备初始化策略、状态与耗时，以及延迟初始化节省的启动时间
+int df_dev_get_stats(const df_dev_t *device, df_dev_op_t op, df_dev_op_stats_t *stats); // 未统计的设备返回 DF_ERR_NOT_FOUND
+void df_dev_reset_stats(void);
+void df_dev_log_stats(void); // 通过日志输出各设备有调用的操作统计
 const char *df_err_to_str(df_err_t err);
 
 #endif
\ No newline at end of file
@@ -6,11 +6,27 @@
 
 #include "df_init.h"
 #include "df_log.h"
+#include "df_shell.h"
+#include <driver.h>
 #include <stddef.h>
+#include <string.h>
 
 // ============ 初始化状态 ============
 static volatile uint8_t df_initialized = 0;
 
+typedef struct
+{
+    uint8_t state;   // df_init_state_t
+    int ret;         // 返回值
+    uint32_t cycles; // 耗时（内核周期）
+} df_init_record_t;
+
+static const df_init_desc_t *df_init_table = NULL;
+static int df_init_num = 0;
+static int df_init_pending_num = 0;
+static df_init_record_t df_init_rec[DF_INIT_MAX];
+static uint32_t df_init_boot_cycles = 0; // df_framework_init 总耗时
+
 // ============ 链接器段符号声明 ============
 // 采用RT-Thread风格：段名自动按字典序排序
 #if defined(__ARMCC_VERSION) /* Keil MDK */
@@ -19,10 +35,154 @@ extern const int DF_InitFnSection$$Limit;
 #elif defined(__ICCARM__) /* IAR */
 #pragma section = "DF_InitFnSection"
 #elif defined(__GNUC__) /* GCC */
-extern df_init_fn_t __df_init_fn_start;
-extern df_init_fn_t __df_init_fn_end;
+extern const df_init_desc_t __df_init_fn_start;
+extern const df_init_desc_t __df_init_fn_end;
+#endif
+
+/**
+ * @brief 定位初始化段
+ */
+static void df_init_locate(void)
+{
+    const df_init_desc_t *begin = NULL;
+    const df_init_desc_t *end = NULL;
+
+#if defined(__ARMCC_VERSION) /* Keil MDK */
+    begin = (const df_init_desc_t *)&DF_InitFnSection$$Base;
+    end = (const df_init_desc_t *)&DF_InitFnSection$$Limit;
+#elif defined(__ICCARM__) /* IAR */
+    begin = __section_begin("DF_InitFnSection");
+    end = __section_end("DF_InitFnSection");
+#elif defined(__GNUC__) /* GCC/Clang */
+    begin = &__df_init_fn_start;
+    end = &__df_init_fn_end;
+#else
+#warning "DF_Framework_Init not implemented for this compiler"
 #endif
 
+    df_init_table = begin;
+    df_init_num = (begin != NULL) ? (int)(end - begin) : 0;
+    if (df_init_num > DF_INIT_MAX)
+    {
+        LOGE("[DF_INIT] %d entries exceed DF_INIT_MAX (%d), the rest are skipped", df_init_num,
+             DF_INIT_MAX);
+        df_init_num = DF_INIT_MAX;
+    }
+}
+
+// ============ 依赖解析 ============
+static int df_init_find(const char *name, size_t len)
+{
+    for (int i = 0; i < df_init_num; i++)
+    {
+        const char *n = df_init_table[i].name;
+        if (n != NULL && strncmp(n, name, len) == 0 && n[len] == '\0')
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 检查依赖
+ * @return 1 全部完成，0 仍有依赖未执行，-1 依赖失败或不存在
+ */
+static int df_init_deps_ready(const df_init_desc_t *desc)
+{
+    const char *p = desc->deps;
+    int ready = 1;
+
+    while (p != NULL && *p != '\0')
+    {
+        while (*p == ' ' || *p == ',')
+        {
+            p++;
+        }
+        size_t len = 0;
+        while (p[len] != '\0' && p[len] != ',' && p[len] != ' ')
+        {
+            len++;
+        }
+        if (len == 0)
+        {
+            break;
+        }
+
+        int idx = df_init_find(p, len);
+        if (idx < 0)
+        {
+            LOGE("[DF_INIT] %s: dependency not found in \"%s\"", desc->name, desc->deps);
+            return -1;
+        }
+        if (df_init_rec[idx].state == DF_INIT_FAILED || df_init_rec[idx].state == DF_INIT_SKIPPED)
+        {
+            LOGE("[DF_INIT] %s: dependency '%s' did not complete", desc->name, df_init_table[idx].name);
+            return -1;
+        }
+        if (df_init_rec[idx].state != DF_INIT_DONE)
+        {
+            ready = 0;
+        }
+        p += len;
+    }
+    return ready;
+}
+
+/**
+ * @brief 执行一个条目并记录耗时
+ */
+static void df_init_exec(int i)
+{
+    const df_init_desc_t *desc = &df_init_table[i];
+    df_init_record_t *rec = &df_init_rec[i];
+
+    uint64_t t0 = get_cycles64();
+    rec->ret = desc->fn();
+    uint64_t cycles = get_cycles64() - t0;
+    rec->cycles = (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+    rec->state = (rec->ret == 0) ? DF_INIT_DONE : DF_INIT_FAILED;
+    df_init_pending_num--;
+
+    if (rec->ret != 0)
+    {
+        LOGE("[DF_INIT] %s failed (ret=%d)", desc->name, rec->ret);
+    }
+}
+
+/**
+ * @brief 按链接顺序执行第一个依赖已满足的条目
+ * @param deferred 是否包含延迟条目
+ * @return 1 执行或跳过了一个条目，0 没有可执行的条目
+ */
+static int df_init_step(int deferred)
+{
+    for (int i = 0; i < df_init_num; i++)
+    {
+        const df_init_desc_t *desc = &df_init_table[i];
+
+        if (df_init_rec[i].state != DF_INIT_PENDING ||
+            (!deferred && (desc->flags & DF_INIT_FLAG_DEFER)))
+        {
+            continue;
+        }
+
+        int ready = df_init_deps_ready(desc);
+        if (ready < 0)
+        {
+            df_init_rec[i].state = DF_INIT_SKIPPED;
+            df_init_pending_num--;
+            return 1;
+        }
+        if (ready > 0)
+        {
+            df_init_exec(i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
 // ============ 查询是否已初始化 ============
 int df_is_initialized(void)
 {
@@ -37,86 +197,138 @@ int df_framework_init(void)
         return 0;
     }
 
-    const df_init_fn_t *fn_ptr;
-    int result;
-    int success = 0;
-    int failed = 0;
+    dwt_cycle_init(); // 耗时统计使用 DWT 周期计数
+    uint64_t boot_start = get_cycles64();
 
     LOGI("|________________________________________|");
     LOGI("|  Driver Framework Initialization       |");
     LOGI("|________________________________________|");
 
-#if defined(__ARMCC_VERSION) /* Keil MDK */
-    // Keil: 从$$Base到$$Limit遍历
-    for (fn_ptr = (const df_init_fn_t *)&DF_InitFnSection$$Base;
-         fn_ptr < (const df_init_fn_t *)&DF_InitFnSection$$Limit;
-         fn_ptr++)
+    df_init_locate();
+    memset(df_init_rec, 0, sizeof(df_init_rec));
+    df_init_pending_num = 0;
+    for (int i = 0; i < df_init_num; i++)
     {
-        if (*fn_ptr != NULL)
+        if (df_init_table[i].fn != NULL)
         {
-            result = (*fn_ptr)();
-            if (result == 0)
-            {
-                success++;
-            }
-            else
-            {
-                failed++;
-                LOGE("[DF_INIT] Function at %p failed (ret=%d)\n", *fn_ptr, result);
-            }
+            df_init_pending_num++;
         }
-    }
-#elif defined(__ICCARM__) /* IAR */
-    // IAR: 使用pragma section
-    fn_ptr = __section_begin("DF_InitFnSection");
-    const df_init_fn_t *fn_end = __section_end("DF_InitFnSection");
-
-    for (; fn_ptr < fn_end; fn_ptr++)
-    {
-        if (*fn_ptr != NULL)
+        else
         {
-            result = (*fn_ptr)();
-            if (result == 0)
-            {
-                success++;
-            }
-            else
-            {
-                failed++;
-            }
+            df_init_rec[i].state = DF_INIT_SKIPPED;
         }
     }
-#elif defined(__GNUC__)   /* GCC/Clang */
-    // GCC: 从__df_init_fn_start到__df_init_fn_end遍历
-    for (fn_ptr = &__df_init_fn_start; fn_ptr < &__df_init_fn_end; fn_ptr++)
+
+    // 每次执行后从头查找，依赖刚完成的条目先于链接顺序在后的条目执行
+    while (df_init_step(0))
     {
-        if (*fn_ptr != NULL)
-        {
-            result = (*fn_ptr)();
-            if (result == 0)
-            {
-                success++;
-            }
-            else
-            {
-                failed++;
-                LOGE("[DF_INIT] Init function failed (ret=%d)\n", result);
-            }
-        }
     }
-#else
-#warning "DF_Framework_Init not implemented for this compiler"
-#endif
 
     df_initialized = 1;
+    uint64_t boot = get_cycles64() - boot_start;
+    df_init_boot_cycles = (boot > UINT32_MAX) ? UINT32_MAX : (uint32_t)boot;
+
+    int success = 0;
+    int failed = 0;
+    for (int i = 0; i < df_init_num; i++)
+    {
+        success += (df_init_rec[i].state == DF_INIT_DONE);
+        failed += (df_init_rec[i].state == DF_INIT_FAILED || df_init_rec[i].state == DF_INIT_SKIPPED);
+    }
 
+    log_flush(); // 先输出启动期间积累的日志
+    df_init_log_profile();
     LOGI("============================================");
     LOGI("[DF_INIT] %d components initialized", success);
     if (failed > 0)
     {
         LOGE(", %d failed", failed);
     }
+    if (df_init_pending_num > 0)
+    {
+        LOGI("[DF_INIT] %d deferred to main loop", df_init_pending_num);
+    }
     LOGI("============================================\n");
 
     return success;
 }
+
+int df_init_run_deferred(void)
+{
+    if (!df_initialized || df_init_pending_num == 0)
+    {
+        return 0;
+    }
+    if (df_init_step(1))
+    {
+        return 1;
+    }
+
+    // 剩余条目互相依赖，无法执行
+    for (int i = 0; i < df_init_num; i++)
+    {
+        if (df_init_rec[i].state == DF_INIT_PENDING)
+        {
+            LOGE("[DF_INIT] %s: circular dependency, skipped", df_init_table[i].name);
+            df_init_rec[i].state = DF_INIT_SKIPPED;
+        }
+    }
+    df_init_pending_num = 0;
+    return 0;
+}
+
+df_init_state_t df_init_get_state(const char *name)
+{
+    int idx = (name != NULL) ? df_init_find(name, strlen(name)) : -1;
+    return (idx < 0) ? DF_INIT_UNKNOWN : (df_init_state_t)df_init_rec[idx].state;
+}
+
+int df_init_done(const char *name)
+{
+    return df_init_get_state(name) == DF_INIT_DONE;
+}
+
+// ============ 耗时统计 ============
+static const char *const df_init_state_str[] = {"pending", "ok", "FAILED", "skipped"};
+
+void df_init_log_profile(void)
+{
+    uint32_t cpu_us = SystemCoreClock / 1000000;
+
+    LOGI("[DF_INIT] lvl name                        cycles      us  result");
+    for (int i = 0; i < df_init_num; i++)
+    {
+        const df_init_desc_t *desc = &df_init_table[i];
+        const df_init_record_t *rec = &df_init_rec[i];
+
+        LOGI("[DF_INIT]  %s  %-24s %10u %7u  %s%s", desc->level, desc->name,
+             (unsigned)rec->cycles, (unsigned)(rec->cycles / cpu_us),
+             df_init_state_str[rec->state], (desc->flags & DF_INIT_FLAG_DEFER) ? " (deferred)" : "");
+        log_flush(); // 逐行输出，条目较多时不溢出日志缓冲区
+    }
+    LOGI("[DF_INIT] boot %u cycles (%u us)", (unsigned)df_init_boot_cycles,
+         (unsigned)(df_init_boot_cycles / cpu_us));
+}
+
+// ============ Shell 命令 ============
+/**
+ * @brief init  查看初始化条目状态与耗时
+ */
+static void df_init_cmd(int argc, void *argv[])
+{
+    uint32_t cpu_us = SystemCoreClock / 1000000;
+
+    shell_printf("lvl name                        cycles      us  result\n");
+    for (int i = 0; i < df_init_num; i++)
+    {
+        const df_init_desc_t *desc = &df_init_table[i];
+        const df_init_record_t *rec = &df_init_rec[i];
+
+        shell_printf(" %s  %-24s %10u %7u  %s%s\n", desc->level, desc->name, (unsigned)rec->cycles,
+                     (unsigned)(rec->cycles / cpu_us), df_init_state_str[rec->state],
+                     (desc->flags & DF_INIT_FLAG_DEFER) ? " (deferred)" : "");
+    }
+    shell_printf("boot %u us, %d pending\n", (unsigned)(df_init_boot_cycles / cpu_us),
+                 df_init_pending_num);
+}
+DF_SHELL_CMD(init, df_init_cmd, "list init entries, status and duration");
@@ -5,12 +5,15 @@
  *          - GCC/Clang: 使用段+constructor属性
  *          - Keil MDK: 使用$Sub$$main机制
  *          - IAR: 需手动调用
+ *          每个条目记录名称、依赖与耗时（内核周期），启动结束时输出初始化耗时表；
+ *          标记为延迟的条目在主循环开始后空闲时执行
  * @date 2026-01-02
  */
 
 #ifndef DF_INIT_H
 #define DF_INIT_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -36,6 +39,38 @@ extern "C"
     // ============ 初始化函数类型 ============
     typedef int (*df_init_fn_t)(void);
 
+    // ============ 配置 ============
+#ifndef DF_INIT_MAX
+#define DF_INIT_MAX 32 // 可记录状态与耗时的初始化条目数，超出的条目不执行
+#endif
+
+    // ============ 条目标志 ============
+#define DF_INIT_FLAG_DEFER 0x01 // 延迟到主循环空闲时执行（df_init_run_deferred）
+
+    /**
+     * @brief 初始化条目（放入 .df_init_fn.<level> 段，按链接顺序构成数组）
+     */
+    typedef struct
+    {
+        df_init_fn_t fn;   // 初始化函数
+        const char *name;  // 函数名，用于日志、依赖查找
+        const char *level; // 级别字符串 DF_INIT_EXPORT_xxx
+        const char *deps;  // 依赖的条目名，逗号分隔，NULL 表示无
+        uint32_t flags;    // DF_INIT_FLAG_xxx
+    } df_init_desc_t;
+
+    /**
+     * @brief 条目运行状态
+     */
+    typedef enum
+    {
+        DF_INIT_PENDING = 0, // 未执行（等待依赖或延迟执行）
+        DF_INIT_DONE,        // 返回 0
+        DF_INIT_FAILED,      // 返回非 0
+        DF_INIT_SKIPPED,     // 依赖失败、不存在或循环依赖，未执行
+        DF_INIT_UNKNOWN      // 没有该名称的条目
+    } df_init_state_t;
+
     // ============ 初始化优先级定义 ============
     /**
      * 初始化优先级（采用RT-Thread命名风格）
@@ -72,7 +107,50 @@ extern "C"
      */
     int df_is_initialized(void);
 
+    /**
+     * @brief 执行一个依赖已满足的延迟初始化条目
+     * @return 1 执行了一个条目，0 没有可执行的条目
+     * @note df_sched_step() 在没有任务可执行时自动调用；不使用调度器时在主循环中调用
+     */
+    int df_init_run_deferred(void);
+
+    /**
+     * @brief 查询初始化条目状态
+     * @param name 初始化函数名
+     */
+    df_init_state_t df_init_get_state(const char *name);
+
+    /**
+     * @brief 初始化条目是否已成功执行
+     */
+    int df_init_done(const char *name);
+
+    /**
+     * @brief 输出各条目的级别、状态与耗时（启动时自动输出一次）
+     */
+    void df_init_log_profile(void);
+
+/** @brief 固定段内条目对齐：避免编译器放大对齐，使段内不再是连续数组 */
+#if defined(__GNUC__)
+#define DF_INIT_ALIGN __attribute__((aligned(sizeof(void *))))
+#else
+#define DF_INIT_ALIGN
+#endif
+
 // ============ RT-Thread风格自动初始化宏 ============
+/**
+ * @brief 自动初始化宏（完整形式）
+ * @param fn 初始化函数
+ * @param level 初始化级别字符串 (DF_INIT_EXPORT_xxx)
+ * @param dep 依赖的初始化函数名字符串，多个用逗号分隔，NULL 表示无
+ * @param flag DF_INIT_FLAG_xxx
+ * @note 同一级别内按链接顺序执行；依赖未完成的条目推迟到依赖完成后执行，
+ *       可以依赖更高级别（更晚）的条目；依赖失败或不存在时跳过
+ */
+#define DF_INIT_EXPORT_EX(fn, level, dep, flag)                           \
+    DF_USED const df_init_desc_t __df_init_##fn DF_INIT_ALIGN             \
+        DF_SECTION(".df_init_fn." level) = {fn, #fn, level, dep, flag}
+
 /**
  * @brief 自动初始化宏（RT-Thread风格）
  * @param fn 初始化函数
@@ -82,9 +160,20 @@ extern "C"
  * static int log_init(void) { return 0; }
  * DF_INIT_EXPORT(log_init, DF_INIT_EXPORT_BOARD);
  */
-#define DF_INIT_EXPORT(fn, level)             \
-    DF_USED const df_init_fn_t __df_init_##fn \
-        DF_SECTION(".df_init_fn." level) = fn
+#define DF_INIT_EXPORT(fn, level) DF_INIT_EXPORT_EX(fn, level, NULL, 0)
+
+/**
+ * @brief 带依赖的自动初始化
+ * @example DF_INIT_EXPORT_DEP(sensor_init, DF_INIT_EXPORT_DEVICE, "df_interface_auto_init");
+ */
+#define DF_INIT_EXPORT_DEP(fn, level, dep) DF_INIT_EXPORT_EX(fn, level, dep, 0)
+
+/**
+ * @brief 延迟初始化：启动时不执行，主循环开始后空闲时按依赖顺序执行
+ * @note 适合加载固件、屏幕上电等耗时较长且主循环开始前不需要的初始化，
+ *       使用方在首次访问前用 df_init_done() 检查
+ */
+#define DF_INIT_EXPORT_DEFER(fn, level, dep) DF_INIT_EXPORT_EX(fn, level, dep, DF_INIT_FLAG_DEFER)
 
 // ============ 分级自动初始化宏（便捷使用） ============
 #define DF_BOARD_INIT(fn) DF_INIT_EXPORT(fn, DF_INIT_EXPORT_BOARD)
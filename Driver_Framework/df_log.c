@@ -14,34 +14,64 @@
 // ============ UART 设备绑定 ============
 static df_uart_t *g_log_uart = NULL;
 
+// 字符串接口兼容输出时的分段大小
+#define LOG_OUTPUT_SHIM_CHUNK 64
+
+// ============ 异步输出（DMA 等）============
+static int (*g_log_drain)(void) = NULL;
+
 // ============ 时间戳回调函数（需要用户实现）============
 static uint32_t (*g_get_tick_func)(void) = NULL;
+static uint64_t (*g_get_us_func)(void) = NULL; // 微秒时间戳，设置后优先使用
 
 // ============ 日志缓冲区 ============
+/*
+ * 无锁环形缓冲区
+ * - 容量为2的幂，下标为自由递增的32位计数，取模改为按位与
+ * - 生产者（log_print，可在中断中调用）：CAS 预留空间 -> 最多两段 memcpy -> 提交
+ * - 消费者（log_flush）：直接把已提交的连续段交给输出函数 -> 推进读指针
+ *   刷新期间 OVERWRITE 策略不移动读指针，缓冲区满时新日志被丢弃
+ * - 提交采用嵌套计数：最外层生产者退出时统一发布 commit，
+ *   被中断打断的写入未完成前，后续中断写入的数据不会被提前读出
+ * @note 多生产者安全基于单核中断嵌套模型（Cortex-M），Cortex-M3/M4 上原子操作编译为 LDREX/STREX
+ */
 typedef struct
 {
-    char *buffer;     // 缓冲区指针
-    size_t size;      // 缓冲区总大小
-    size_t write_pos; // 写位置
-    size_t read_pos;  // 读位置
-    size_t used;      // 已使用大小
-    bool initialized; // 是否已初始化
+    char *buffer;           // 缓冲区指针
+    uint32_t size;          // 缓冲区总大小（2的幂）
+    uint32_t mask;          // 下标掩码 size - 1
+    uint32_t reserve;       // 生产者预留位置
+    uint32_t commit;        // 已提交位置（消费者可读上限）
+    uint32_t tail;          // 读位置
+    uint32_t nest;          // 正在写入的生产者数量
+    uint32_t flushing;      // 消费者互斥标志
+    uint32_t dropped;       // 丢弃的日志条数（DISCARD策略或空间不足）
+    uint32_t dropped_bytes; // 丢弃的字节数
+    uint32_t overwritten;   // 被覆盖的字节数（OVERWRITE策略）
+    uint32_t high_water;    // 历史最大使用量
+    bool initialized;       // 是否已初始化
 } log_buffer_t;
 
 static log_buffer_t g_log_buffer = {
     .buffer = NULL,
     .size = 0,
-    .write_pos = 0,
-    .read_pos = 0,
-    .used = 0,
     .initialized = false};
 
+// 原子操作封装（GCC 内建，目标板与主机通用）
+#define LOG_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define LOG_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define LOG_CAS(p, expect, desired) \
+    __atomic_compare_exchange_n((p), (expect), (desired), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define LOG_ADD(p, v) __atomic_add_fetch((p), (v), __ATOMIC_ACQ_REL)
+#define LOG_SUB(p, v) __atomic_sub_fetch((p), (v), __ATOMIC_ACQ_REL)
+
 // ============ 全局日志配置 ============
 log_config_t g_log_config = {
     .level = LOG_LEVEL_INFO,
     .enable_timestamp = false,
     .enable_color = false,
     .output_func = NULL,
+    .write_func = NULL,
     .buffer_mode = LOG_BUFFER_MODE_BUFFERED,
     .overflow_policy = LOG_OVERFLOW_OVERWRITE};
 
@@ -67,16 +97,176 @@ void log_set_level(log_level_t level)
     g_log_config.level = level;
 }
 
+// ============ 按标签设置级别 ============
+/*
+ * 两级结构：
+ * - g_log_tags: 按名称保存的标签级别（设置时拷贝名称，shell 等临时缓冲区传入也安全）
+ * - g_log_tag_cache: 以标签指针哈希为下标的直接映射缓存，记录该指针对应的级别
+ *   日志宏传入的标签几乎都是字符串常量，命中后一次比较即可得到级别
+ * 缓存项先清指针、再写级别、最后写指针；读者先读级别再核对指针，
+ * 指针匹配时读到的级别一定属于该指针（单核中断嵌套模型）
+ */
+#define LOG_TAG_INHERIT 0xFF // 使用全局级别
+#define LOG_TAG_CACHE_SIZE (1u << LOG_TAG_CACHE_BITS)
+
+typedef struct
+{
+    char name[LOG_TAG_NAME_MAX];
+    uint8_t level;
+    bool used;
+} log_tag_entry_t;
+
+typedef struct
+{
+    const char *tag;
+    uint8_t level;
+} log_tag_cache_t;
+
+static log_tag_entry_t g_log_tags[LOG_TAG_TABLE_SIZE];
+static log_tag_cache_t g_log_tag_cache[LOG_TAG_CACHE_SIZE];
+volatile uint8_t g_log_tag_count = 0;
+
+static inline uint32_t log_tag_hash(const char *tag)
+{
+    // 乘法哈希，取高位作为下标
+    return ((uint32_t)(uintptr_t)tag * 2654435761u) >> (32 - LOG_TAG_CACHE_BITS);
+}
+
+static void log_tag_cache_clear(void)
+{
+    for (uint32_t i = 0; i < LOG_TAG_CACHE_SIZE; i++)
+    {
+        __atomic_store_n(&g_log_tag_cache[i].tag, NULL, __ATOMIC_RELEASE);
+    }
+}
+
+static log_tag_entry_t *log_tag_find(const char *tag)
+{
+    for (uint32_t i = 0; i < LOG_TAG_TABLE_SIZE; i++)
+    {
+        if (g_log_tags[i].used && strncmp(g_log_tags[i].name, tag, LOG_TAG_NAME_MAX) == 0)
+        {
+            return &g_log_tags[i];
+        }
+    }
+    return NULL;
+}
+
+static void log_tag_recount(void)
+{
+    uint8_t count = 0;
+    for (uint32_t i = 0; i < LOG_TAG_TABLE_SIZE; i++)
+    {
+        count += g_log_tags[i].used ? 1 : 0;
+    }
+    g_log_tag_count = count;
+}
+
+bool log_tag_enabled(log_level_t level, const char *tag)
+{
+    if (tag == NULL)
+    {
+        return level <= g_log_config.level;
+    }
+
+    log_tag_cache_t *slot = &g_log_tag_cache[log_tag_hash(tag)];
+    uint8_t tag_level = slot->level;
+
+    if (__atomic_load_n(&slot->tag, __ATOMIC_ACQUIRE) != tag)
+    {
+        // 未命中：按名称查表并写入缓存（包括“未设置”的结果）
+        log_tag_entry_t *entry = log_tag_find(tag);
+        tag_level = (entry != NULL) ? entry->level : LOG_TAG_INHERIT;
+        __atomic_store_n(&slot->tag, NULL, __ATOMIC_RELEASE);
+        slot->level = tag_level;
+        __atomic_store_n(&slot->tag, tag, __ATOMIC_RELEASE);
+    }
+
+    if (tag_level == LOG_TAG_INHERIT)
+    {
+        return level <= g_log_config.level;
+    }
+    return (uint8_t)level <= tag_level;
+}
+
+int log_set_tag_level(const char *tag, log_level_t level)
+{
+    if (tag == NULL || strlen(tag) >= LOG_TAG_NAME_MAX)
+    {
+        return -1;
+    }
+
+    log_tag_entry_t *entry = log_tag_find(tag);
+    if (entry == NULL)
+    {
+        for (uint32_t i = 0; i < LOG_TAG_TABLE_SIZE; i++)
+        {
+            if (!g_log_tags[i].used)
+            {
+                entry = &g_log_tags[i];
+                break;
+            }
+        }
+        if (entry == NULL)
+        {
+            return -1;
+        }
+        strcpy(entry->name, tag);
+        entry->used = true;
+    }
+
+    entry->level = (uint8_t)level;
+    log_tag_cache_clear();
+    log_tag_recount();
+    return 0;
+}
+
+void log_clear_tag_level(const char *tag)
+{
+    if (tag == NULL)
+    {
+        return;
+    }
+
+    log_tag_entry_t *entry = log_tag_find(tag);
+    if (entry != NULL)
+    {
+        entry->used = false;
+        log_tag_cache_clear();
+        log_tag_recount();
+    }
+}
+
+void log_clear_tag_levels(void)
+{
+    for (uint32_t i = 0; i < LOG_TAG_TABLE_SIZE; i++)
+    {
+        g_log_tags[i].used = false;
+    }
+    log_tag_cache_clear();
+    log_tag_recount();
+}
+
 void log_set_output(void (*func)(const char *))
 {
     g_log_config.output_func = func;
 }
 
+void log_set_write(void (*func)(const void *data, size_t len))
+{
+    g_log_config.write_func = func;
+}
+
 void log_set_timestamp_func(uint32_t (*get_tick)(void))
 {
     g_get_tick_func = get_tick;
 }
 
+void log_set_timestamp_us_func(uint64_t (*get_us)(void))
+{
+    g_get_us_func = get_us;
+}
+
 void log_enable_timestamp(bool enable)
 {
     g_log_config.enable_timestamp = enable;
@@ -102,7 +292,7 @@ void log_set_uart(struct df_uart_struct *uart)
 
 // ============ 统一输出函数 ============
 /**
- * @brief 内部统一输出函数
+ * @brief 字符串输出（兼容旧的字符串接口）
  * @param str 要输出的字符串
  */
 static void log_output_internal(const char *str)
@@ -125,6 +315,45 @@ static void log_output_internal(const char *str)
     }
 }
 
+/**
+ * @brief 内部统一输出函数（按长度输出）
+ * @param data 数据指针，不要求NUL结尾
+ * @param len 数据长度
+ * @note 优先使用按长度输出的接口；只提供字符串接口时分段拷贝并补NUL
+ */
+static void log_output_write(const char *data, size_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+
+    if (g_log_uart != NULL)
+    {
+        if (g_log_uart->write != NULL)
+        {
+            g_log_uart->write(data, len);
+            return;
+        }
+    }
+    else if (g_log_config.write_func != NULL)
+    {
+        g_log_config.write_func(data, len);
+        return;
+    }
+
+    char temp[LOG_OUTPUT_SHIM_CHUNK + 1];
+    while (len > 0)
+    {
+        size_t n = (len < LOG_OUTPUT_SHIM_CHUNK) ? len : LOG_OUTPUT_SHIM_CHUNK;
+        memcpy(temp, data, n);
+        temp[n] = '\0';
+        log_output_internal(temp);
+        data += n;
+        len -= n;
+    }
+}
+
 /**
  * @brief 原始字符串输出（不带格式化）
  * @param str 要输出的字符串
@@ -133,7 +362,7 @@ void log_raw(const char *str)
 {
     if (str != NULL)
     {
-        log_output_internal(str);
+        log_output_write(str, strlen(str));
     }
 }
 
@@ -147,29 +376,52 @@ void log_printf(const char *fmt, ...)
     static char log_printf_buf[128];
     va_list args;
     va_start(args, fmt);
-    vsnprintf(log_printf_buf, sizeof(log_printf_buf), fmt, args);
+    int len = vsnprintf(log_printf_buf, sizeof(log_printf_buf), fmt, args);
     va_end(args);
-    log_output_internal(log_printf_buf);
+    if (len > 0)
+    {
+        log_output_write(log_printf_buf, ((size_t)len < sizeof(log_printf_buf)) ? (size_t)len : sizeof(log_printf_buf) - 1);
+    }
 }
 
 // ============ 缓冲区管理 ============
+/**
+ * @brief 初始化日志缓冲区
+ * @param size 缓冲区大小，向上取整为2的幂
+ */
 void log_buffer_init(size_t size)
 {
+    uint32_t cap = 16;
+
+    while (cap < size && cap < 0x40000000u)
+    {
+        cap <<= 1;
+    }
+
     // 如果已经初始化，先释放
-    if (g_log_buffer.initialized && g_log_buffer.buffer != NULL)
+    g_log_buffer.initialized = false;
+    if (g_log_buffer.buffer != NULL)
     {
         free(g_log_buffer.buffer);
+        g_log_buffer.buffer = NULL;
     }
 
     // 分配新缓冲区
-    g_log_buffer.buffer = (char *)malloc(size);
+    g_log_buffer.buffer = (char *)malloc(cap);
     if (g_log_buffer.buffer != NULL)
     {
-        g_log_buffer.size = size;
-        g_log_buffer.write_pos = 0;
-        g_log_buffer.read_pos = 0;
-        g_log_buffer.used = 0;
-        g_log_buffer.initialized = true;
+        g_log_buffer.size = cap;
+        g_log_buffer.mask = cap - 1;
+        g_log_buffer.reserve = 0;
+        g_log_buffer.commit = 0;
+        g_log_buffer.tail = 0;
+        g_log_buffer.nest = 0;
+        g_log_buffer.flushing = 0;
+        g_log_buffer.dropped = 0;
+        g_log_buffer.dropped_bytes = 0;
+        g_log_buffer.overwritten = 0;
+        g_log_buffer.high_water = 0;
+        LOG_STORE(&g_log_buffer.initialized, true);
     }
 }
 
@@ -187,145 +439,432 @@ void log_buffer_clear(void)
 {
     if (g_log_buffer.initialized)
     {
-        g_log_buffer.write_pos = 0;
-        g_log_buffer.read_pos = 0;
-        g_log_buffer.used = 0;
+        // 读指针追到已提交位置，正在写入的数据保留
+        uint32_t tail = LOG_LOAD(&g_log_buffer.tail);
+        while (!LOG_CAS(&g_log_buffer.tail, &tail, LOG_LOAD(&g_log_buffer.commit)))
+        {
+        }
     }
 }
 
 size_t log_buffer_get_usage(void)
 {
-    return g_log_buffer.used;
+    if (!g_log_buffer.initialized)
+    {
+        return 0;
+    }
+    return LOG_LOAD(&g_log_buffer.reserve) - LOG_LOAD(&g_log_buffer.tail);
 }
 
 bool log_buffer_is_full(void)
 {
-    return g_log_buffer.used >= g_log_buffer.size;
+    return g_log_buffer.initialized && log_buffer_get_usage() >= g_log_buffer.size;
+}
+
+void log_buffer_get_stats(log_buffer_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+    stats->size = g_log_buffer.size;
+    stats->used = (uint32_t)log_buffer_get_usage();
+    stats->high_water = LOG_LOAD(&g_log_buffer.high_water);
+    stats->dropped = LOG_LOAD(&g_log_buffer.dropped);
+    stats->dropped_bytes = LOG_LOAD(&g_log_buffer.dropped_bytes);
+    stats->overwritten = LOG_LOAD(&g_log_buffer.overwritten);
+}
+
+void log_buffer_reset_stats(void)
+{
+    LOG_STORE(&g_log_buffer.dropped, 0);
+    LOG_STORE(&g_log_buffer.dropped_bytes, 0);
+    LOG_STORE(&g_log_buffer.overwritten, 0);
+    LOG_STORE(&g_log_buffer.high_water, (uint32_t)log_buffer_get_usage());
+}
+
+// ============ 内部函数：环形缓冲区拷贝 ============
+/**
+ * @brief 写入环形缓冲区，回绕时拆为两段 memcpy
+ */
+static void log_ring_copy_in(uint32_t pos, const char *data, uint32_t len)
+{
+    uint32_t off = pos & g_log_buffer.mask;
+    uint32_t first = g_log_buffer.size - off;
+
+    if (first >= len)
+    {
+        memcpy(&g_log_buffer.buffer[off], data, len);
+    }
+    else
+    {
+        memcpy(&g_log_buffer.buffer[off], data, first);
+        memcpy(g_log_buffer.buffer, data + first, len - first);
+    }
+}
+
+/**
+ * @brief 发布已完成的写入
+ * @note 只有最外层生产者发布；发布后再次检查，防止被中断写入的 commit 被旧值覆盖
+ */
+static void log_ring_publish(void)
+{
+    while (LOG_SUB(&g_log_buffer.nest, 1) == 0)
+    {
+        uint32_t reserve = LOG_LOAD(&g_log_buffer.reserve);
+        LOG_STORE(&g_log_buffer.commit, reserve);
+        if (LOG_LOAD(&g_log_buffer.reserve) == reserve)
+        {
+            return;
+        }
+        // 发布期间有新写入完成，重新进入并发布最新位置
+        LOG_ADD(&g_log_buffer.nest, 1);
+    }
 }
 
 // ============ 内部函数：写入缓冲区 ============
 static int log_buffer_write(const char *data, size_t len)
 {
-    if (!g_log_buffer.initialized || g_log_buffer.buffer == NULL)
+    if (!LOG_LOAD(&g_log_buffer.initialized))
     {
         return -1;
     }
 
-    // 检查是否有足够空间
-    if (g_log_buffer.used + len > g_log_buffer.size)
+    // 单条日志超过缓冲区容量，只能丢弃
+    if (len == 0 || len > g_log_buffer.size)
     {
-        // 根据策略处理溢出
-        if (g_log_config.overflow_policy == LOG_OVERFLOW_DISCARD)
+        LOG_ADD(&g_log_buffer.dropped, 1);
+        LOG_ADD(&g_log_buffer.dropped_bytes, (uint32_t)len);
+        return -1;
+    }
+
+    uint32_t n = (uint32_t)len;
+    LOG_ADD(&g_log_buffer.nest, 1);
+
+    // 预留空间
+    uint32_t head = LOG_LOAD(&g_log_buffer.reserve);
+    for (;;)
+    {
+        uint32_t tail = LOG_LOAD(&g_log_buffer.tail);
+        uint32_t used = head - tail;
+
+        if (used + n > g_log_buffer.size)
         {
-            return -1; // 丢弃新数据
+            // 根据策略处理溢出
+            uint32_t need = used + n - g_log_buffer.size;
+            uint32_t commit = LOG_LOAD(&g_log_buffer.commit);
+
+            // DISCARD: 丢弃新数据；OVERWRITE 时不能覆盖尚未提交的数据，
+            // 也不能覆盖正在刷新的数据（log_flush 直接从缓冲区输出）
+            if (g_log_config.overflow_policy == LOG_OVERFLOW_DISCARD ||
+                LOG_LOAD(&g_log_buffer.flushing) ||
+                (int32_t)(commit - (tail + need)) < 0)
+            {
+                LOG_ADD(&g_log_buffer.dropped, 1);
+                LOG_ADD(&g_log_buffer.dropped_bytes, n);
+                log_ring_publish();
+                return -1;
+            }
+
+            // LOG_OVERFLOW_OVERWRITE: 推进读指针，覆盖最旧数据
+            if (LOG_CAS(&g_log_buffer.tail, &tail, tail + need))
+            {
+                LOG_ADD(&g_log_buffer.overwritten, need);
+            }
+            head = LOG_LOAD(&g_log_buffer.reserve);
+            continue;
         }
-        // LOG_OVERFLOW_OVERWRITE: 覆盖旧数据（环形缓冲区）
+
+        if (LOG_CAS(&g_log_buffer.reserve, &head, head + n))
+        {
+            // 更新历史最大使用量
+            uint32_t hw = LOG_LOAD(&g_log_buffer.high_water);
+            while (used + n > hw && !LOG_CAS(&g_log_buffer.high_water, &hw, used + n))
+            {
+            }
+            break;
+        }
+        // CAS 失败时 head 已更新为最新值，重试
     }
 
     // 写入数据
-    for (size_t i = 0; i < len; i++)
+    log_ring_copy_in(head, data, n);
+    log_ring_publish();
+
+    return 0;
+}
+
+// ============ 刷新缓冲区 ============
+void log_set_drain(int (*drain)(void))
+{
+    g_log_drain = drain;
+}
+
+size_t log_buffer_read(void *dst, size_t max)
+{
+    if (!LOG_LOAD(&g_log_buffer.initialized) || dst == NULL || max == 0)
+    {
+        return 0;
+    }
+
+    // 与 log_flush 共用消费者互斥，忙时直接返回，由调用者稍后重试
+    uint32_t idle = 0;
+    if (!LOG_CAS(&g_log_buffer.flushing, &idle, 1))
+    {
+        return 0;
+    }
+
+    size_t copied = 0;
+    uint32_t tail = LOG_LOAD(&g_log_buffer.tail);
+    uint32_t avail = LOG_LOAD(&g_log_buffer.commit) - tail;
+
+    if (avail > 0 && avail <= g_log_buffer.size)
     {
-        g_log_buffer.buffer[g_log_buffer.write_pos] = data[i];
-        g_log_buffer.write_pos = (g_log_buffer.write_pos + 1) % g_log_buffer.size;
+        if (avail > max)
+        {
+            avail = (uint32_t)max;
+        }
 
-        if (g_log_buffer.used < g_log_buffer.size)
+        uint32_t off = tail & g_log_buffer.mask;
+        uint32_t first = g_log_buffer.size - off;
+        if (first > avail)
         {
-            g_log_buffer.used++;
+            first = avail;
         }
-        else
+        memcpy(dst, &g_log_buffer.buffer[off], first);
+        memcpy((char *)dst + first, g_log_buffer.buffer, avail - first);
+
+        if (LOG_CAS(&g_log_buffer.tail, &tail, tail + avail))
         {
-            // 覆盖模式：移动读指针
-            g_log_buffer.read_pos = (g_log_buffer.read_pos + 1) % g_log_buffer.size;
+            copied = avail;
         }
     }
 
-    return 0;
+    LOG_STORE(&g_log_buffer.flushing, 0);
+    return copied;
 }
 
-// ============ 刷新缓冲区 ============
 int log_flush(void)
 {
-    if (!g_log_buffer.initialized || g_log_buffer.used == 0)
+    if (!LOG_LOAD(&g_log_buffer.initialized))
+    {
+        return 0;
+    }
+
+    // 注册了异步输出时只负责启动传输，实际发送由完成中断接力
+    if (g_log_drain != NULL)
+    {
+        return g_log_drain();
+    }
+
+    // 同一时刻只允许一个消费者（主循环与 SysTick 都可能调用）
+    uint32_t idle = 0;
+    if (!LOG_CAS(&g_log_buffer.flushing, &idle, 1))
     {
         return 0;
     }
 
-    // 临时缓冲区用于输出
-    char temp[256];
     size_t output_count = 0;
 
-    while (g_log_buffer.used > 0)
+    for (;;)
     {
-        size_t chunk_size = (g_log_buffer.used < sizeof(temp)) ? g_log_buffer.used : sizeof(temp);
+        uint32_t tail = LOG_LOAD(&g_log_buffer.tail);
+        uint32_t avail = LOG_LOAD(&g_log_buffer.commit) - tail;
 
-        // 从缓冲区读取数据
-        for (size_t i = 0; i < chunk_size; i++)
+        if (avail == 0 || avail > g_log_buffer.size)
         {
-            temp[i] = g_log_buffer.buffer[g_log_buffer.read_pos];
-            g_log_buffer.read_pos = (g_log_buffer.read_pos + 1) % g_log_buffer.size;
-            g_log_buffer.used--;
+            break;
         }
 
-        // 输出数据
-        temp[chunk_size] = '\0';
-        log_output_internal(temp);
+        // 直接输出环形缓冲区中的连续段（回绕时分两次），不经过临时缓冲区
+        uint32_t off = tail & g_log_buffer.mask;
+        uint32_t span = g_log_buffer.size - off;
+        if (span > avail)
+        {
+            span = avail;
+        }
+        log_output_write(&g_log_buffer.buffer[off], span);
 
-        output_count += chunk_size;
+        // 刷新期间生产者不会移动读指针；失败只可能是 log_buffer_clear()
+        if (LOG_CAS(&g_log_buffer.tail, &tail, tail + span))
+        {
+            output_count += span;
+        }
     }
 
+    LOG_STORE(&g_log_buffer.flushing, 0);
     return output_count;
 }
 
 // ============ 日志打印实现 ============
 // 时间戳宽度配置（用于对齐）
-#define LOG_TIMESTAMP_WIDTH 8
+#define LOG_TIMESTAMP_WIDTH 8     // 毫秒时间戳宽度
+#define LOG_TIMESTAMP_SEC_WIDTH 5 // 微秒时间戳的秒部分宽度
+
+/**
+ * @brief 无符号整数右对齐输出（时间戳专用，不经过 vsnprintf）
+ * @return 写入的字符数
+ */
+static int log_fmt_uint(char *dst, uint32_t value, int width, char pad)
+{
+    char digits[10];
+    int n = 0;
+    int len = 0;
+
+    do
+    {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (len + n < width)
+    {
+        dst[len++] = pad;
+    }
+    while (n > 0)
+    {
+        dst[len++] = digits[--n];
+    }
+    return len;
+}
+
+static bool log_timestamp_enabled(void)
+{
+    return g_log_config.enable_timestamp && (g_get_us_func != NULL || g_get_tick_func != NULL);
+}
+
+/**
+ * @brief 输出时间戳前缀："[    1234] " 或 "[    1.234567] "
+ * @note dst 至少 24 字节
+ */
+static int log_fmt_timestamp(char *dst)
+{
+    int len = 0;
+
+    dst[len++] = '[';
+    if (g_get_us_func != NULL)
+    {
+        uint64_t us = g_get_us_func();
+        len += log_fmt_uint(&dst[len], (uint32_t)(us / 1000000u), LOG_TIMESTAMP_SEC_WIDTH, ' ');
+        dst[len++] = '.';
+        len += log_fmt_uint(&dst[len], (uint32_t)(us % 1000000u), 6, '0');
+    }
+    else
+    {
+        len += log_fmt_uint(&dst[len], g_get_tick_func(), LOG_TIMESTAMP_WIDTH, ' ');
+    }
+    dst[len++] = ']';
+    dst[len++] = ' ';
+    return len;
+}
 
 void log_print(log_level_t level, const char *tag, const char *fmt, ...)
 {
-    // 检查日志级别
-    if (level > g_log_config.level)
+    // 检查日志级别（LOG_x 宏已过滤，直接调用时在此过滤）
+    if (!LOG_ENABLED(level, tag))
     {
         return;
     }
 
-    // 构建日志前缀（包含时间戳）
-    char prefix[64] = {0};
+    // 前缀（时间戳）、正文和换行直接格式化到同一缓冲区，避免二次拷贝
+    char full_log[384];
+    int len = 0;
 
     // 添加时间戳（固定宽度对齐）
-    if (g_log_config.enable_timestamp && g_get_tick_func != NULL)
+    if (log_timestamp_enabled())
     {
-        uint32_t timestamp = g_get_tick_func();
-        snprintf(prefix, sizeof(prefix), "[%*lu] ", LOG_TIMESTAMP_WIDTH, (unsigned long)timestamp);
+        len = log_fmt_timestamp(full_log);
     }
 
-    // 格式化日志内容
-    char buffer[256];
+    // 格式化日志内容（正文最长255字节，与原实现一致）
     va_list args;
     va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    int body = vsnprintf(full_log + len, 256, fmt, args);
     va_end(args);
+    if (body < 0)
+    {
+        return;
+    }
+    len += (body < 256) ? body : 255;
 
-    // 组合完整日志（添加换行符）
-    char full_log[384];
-    snprintf(full_log, sizeof(full_log), "%s%s\n", prefix, buffer);
+    // 添加换行符
+    full_log[len++] = '\n';
+    full_log[len] = '\0';
 
     // 根据模式选择输出方式
     if (g_log_config.buffer_mode == LOG_BUFFER_MODE_BUFFERED)
     {
         // 缓冲模式：写入缓冲区
-        log_buffer_write(full_log, strlen(full_log));
+        log_buffer_write(full_log, (size_t)len);
     }
     else
     {
         // 直接输出模式：使用统一输出函数
-        log_output_internal(full_log);
+        log_output_write(full_log, (size_t)len);
+    }
+}
+
+// ============ 延迟日志 ============
+/**
+ * @brief 写入一条延迟日志记录
+ * @param level 日志级别（调用宏已过滤，保留用于扩展）
+ * @param fmt 位于 .df_log_fmt 段的格式字符串，ID 为其在段内的偏移
+ * @param args 参数字数组
+ * @param nargs 参数个数
+ */
+void log_deferred_write(log_level_t level, const char *fmt, const uint32_t *args, uint32_t nargs)
+{
+    extern const char __df_log_fmt_start[];
+    uint8_t record[2 + 4 + 4 + 4 * LOG_DEFERRED_MAX_ARGS];
+    uint32_t id = (uint32_t)((uintptr_t)fmt - (uintptr_t)__df_log_fmt_start);
+    size_t len = 0;
+
+    (void)level;
+    if (nargs > LOG_DEFERRED_MAX_ARGS)
+    {
+        nargs = LOG_DEFERRED_MAX_ARGS;
+    }
+
+    record[len++] = LOG_DEFERRED_SYNC;
+    record[len++] = (uint8_t)nargs;
+    memcpy(&record[len], &id, 4);
+    len += 4;
+
+    if (log_timestamp_enabled())
+    {
+        // 微秒时间戳只记录低32位（约71分钟回绕），由主机解码
+        uint32_t timestamp;
+        if (g_get_us_func != NULL)
+        {
+            timestamp = (uint32_t)g_get_us_func();
+            record[1] |= LOG_DEFERRED_FLAG_US;
+        }
+        else
+        {
+            timestamp = g_get_tick_func();
+        }
+        record[1] |= LOG_DEFERRED_FLAG_TS;
+        memcpy(&record[len], &timestamp, 4);
+        len += 4;
+    }
+
+    memcpy(&record[len], args, 4 * nargs);
+    len += 4 * nargs;
+
+    if (g_log_config.buffer_mode == LOG_BUFFER_MODE_BUFFERED)
+    {
+        log_buffer_write((const char *)record, len);
+    }
+    else
+    {
+        log_output_write((const char *)record, len);
     }
 }
 
 // ============ 十六进制数据打印 ============
 void log_hex_dump(log_level_t level, const char *tag, const void *data, size_t len)
 {
-    if (level > g_log_config.level || data == NULL || len == 0)
+    if (!LOG_ENABLED(level, tag) || data == NULL || len == 0)
     {
         return;
     }
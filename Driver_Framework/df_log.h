@@ -94,6 +94,16 @@ typedef enum
     LOG_LEVEL_VERBOSE   // 详细日志
 } log_level_t;
 
+// ============ 编译期日志级别 ============
+/*
+ * 级别高于 LOG_COMPILE_LEVEL 的 LOG_x 宏在编译期被移除：不生成调用、参数不求值、
+ * 格式字符串不进入固件。取值为数字 0-5（对应 LOG_LEVEL_NONE..LOG_LEVEL_VERBOSE），
+ * 例如发布版本定义 LOG_COMPILE_LEVEL=3 去掉全部 LOG_D/LOG_V
+ */
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 5
+#endif
+
 // ============ 日志颜色定义（可选）============
 #ifdef LOG_USE_COLOR
 #define LOG_COLOR_RED FG_RED
@@ -127,13 +137,25 @@ typedef enum
     LOG_OVERFLOW_DISCARD = 1    // 丢弃新数据
 } log_overflow_policy_t;
 
+// ============ 缓冲区统计 ============
+typedef struct
+{
+    uint32_t size;          // 缓冲区容量
+    uint32_t used;          // 当前使用量
+    uint32_t high_water;    // 历史最大使用量
+    uint32_t dropped;       // 丢弃的日志条数
+    uint32_t dropped_bytes; // 丢弃的字节数
+    uint32_t overwritten;   // 被覆盖的旧数据字节数
+} log_buffer_stats_t;
+
 // ============ 日志配置 ============
 typedef struct
 {
     log_level_t level;                     // 当前日志级别
     bool enable_timestamp;                 // 是否启用时间戳
     bool enable_color;                     // 是否启用颜色
-    void (*output_func)(const char *);     // 自定义输出函数
+    void (*output_func)(const char *);     // 自定义输出函数（字符串接口，兼容保留）
+    void (*write_func)(const void *, size_t); // 按长度输出函数（优先于 output_func，延迟日志模式必需）
     log_buffer_mode_t buffer_mode;         // 缓冲模式
     log_overflow_policy_t overflow_policy; // 溢出策略
 } log_config_t;
@@ -149,44 +171,219 @@ void log_set_uart(struct df_uart_struct *uart); // 绑定 UART 设备
 void log_init(log_level_t level);
 void log_set_level(log_level_t level);
 void log_set_output(void (*func)(const char *));
-void log_set_timestamp_func(uint32_t (*get_tick)(void)); // 设置时间戳回调函数
+void log_set_write(void (*func)(const void *data, size_t len)); // 设置二进制输出函数
+void log_set_timestamp_func(uint32_t (*get_tick)(void)); // 设置时间戳回调函数（毫秒）
+void log_set_timestamp_us_func(uint64_t (*get_us)(void)); // 设置微秒时间戳回调（优先于毫秒，如 DWT）
 void log_enable_timestamp(bool enable);                  // 启用/禁用时间戳
+
+// ============ 按标签设置级别 ============
+/*
+ * 单独提高/降低某个标签的运行时级别（如只打开 "IIC" 的 LOG_V），其余标签仍使用全局级别
+ * - 未设置任何标签时只比较全局级别，没有额外开销
+ * - 查询先按标签指针哈希访问缓存（O(1)），未命中时按名称查表并写入缓存，
+ *   不同源文件中同名但地址不同的字符串常量同样匹配
+ * - 编译期移除的日志（LOG_COMPILE_LEVEL）无法在运行时打开
+ */
+#define LOG_TAG_TABLE_SIZE 8  // 可单独设置级别的标签数
+#define LOG_TAG_NAME_MAX 12   // 标签名最大长度（含结尾0）
+#define LOG_TAG_CACHE_BITS 5  // 标签指针缓存 2^N 项
+
+extern volatile uint8_t g_log_tag_count; // 已设置级别的标签数
+int log_set_tag_level(const char *tag, log_level_t level); // 设置标签级别，0成功/-1表满或名称过长
+void log_clear_tag_level(const char *tag);                 // 恢复该标签使用全局级别
+void log_clear_tag_levels(void);                           // 清除全部标签级别
+bool log_tag_enabled(log_level_t level, const char *tag);  // 按标签级别判断是否输出
+
+// 是否输出：未设置标签级别时只比较全局级别
+#define LOG_ENABLED(lvl, tag) \
+    (g_log_tag_count == 0 ? ((lvl) <= g_log_config.level) : log_tag_enabled((lvl), (tag)))
 // ============ 缓冲区管理 ============
-void log_buffer_init(size_t size);                          // 初始化缓冲区（默认1024字节）
+void log_buffer_init(size_t size);                          // 初始化缓冲区（默认1024字节，向上取整为2的幂）
 void log_set_buffer_mode(log_buffer_mode_t mode);           // 设置缓冲模式
 void log_set_overflow_policy(log_overflow_policy_t policy); // 设置溢出策略
 int log_flush(void);                                        // 刷新缓冲区，输出所有日志
 void log_buffer_clear(void);                                // 清空缓冲区
 size_t log_buffer_get_usage(void);                          // 获取缓冲区使用量
 bool log_buffer_is_full(void);                              // 检查缓冲区是否满
+void log_buffer_get_stats(log_buffer_stats_t *stats);       // 获取丢弃/覆盖统计
+void log_buffer_reset_stats(void);                          // 清零统计计数
+size_t log_buffer_read(void *dst, size_t max);              // 取出最多 max 字节（供异步输出使用，消费者忙时返回0）
+void log_set_drain(int (*drain)(void));                     // 设置异步输出，log_flush() 改为调用 drain()
 // ============ 底层日志函数 ============
 void log_print(log_level_t level, const char *tag, const char *fmt, ...);
 void log_raw(const char *str);         // 原始输出（不带格式）
 void log_printf(const char *fmt, ...); // 格式化输出（不带级别/标签）
 
+// ============ 延迟（二进制）日志 ============
+/*
+ * 定义 LOG_DEFERRED 后，LOG_E/W/I/D/V 不再在设备上格式化字符串：
+ * - 格式字符串放入不加载的 .df_log_fmt 段（只存在于 ELF 文件中，不占 FLASH）
+ * - 缓冲区中只记录 格式ID + 时间戳 + 参数字（每个参数32位）
+ * - 主机端用 tool/log_decode.py 结合 ELF 文件还原文本
+ *
+ * 记录格式（小端）：
+ *   [0xDF][flags|nargs][fmt_id:4][timestamp:4 可选][arg0:4]...[argN:4]
+ *   flags bit7 = 带时间戳，bit6 = 时间戳单位为微秒（低32位），低4位为参数个数
+ *
+ * 参数限制：
+ * - 整数截断为32位（不支持 %lld）；float/double 按 float 保存
+ * - %s 只能是常量字符串（地址在 ELF 中可解析），运行时缓冲区内容无法还原
+ * - 链接时需要 Driver_Framework/linker/df_log_fmt.ld
+ */
+#define LOG_DEFERRED_SYNC 0xDF       // 记录起始字节
+#define LOG_DEFERRED_FLAG_TS 0x80    // 带时间戳标志
+#define LOG_DEFERRED_FLAG_US 0x40    // 时间戳为微秒
+#define LOG_DEFERRED_MAX_ARGS 15     // 最大参数个数（含标签宽度与标签）
+#define LOG_DEFERRED_SECTION ".df_log_fmt"
+
+void log_deferred_write(log_level_t level, const char *fmt, const uint32_t *args, uint32_t nargs);
+
+static inline uint32_t log_arg_int(long long v)
+{
+    return (uint32_t)v;
+}
+
+static inline uint32_t log_arg_float(double v)
+{
+    float f = (float)v;
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static inline uint32_t log_arg_ptr(const void *p)
+{
+    return (uint32_t)(uintptr_t)p;
+}
+
+// 参数按类型转换为32位字：任意指针（含数组、函数指针）走 log_arg_ptr，浮点走 log_arg_float，其余按整数
+// 未选中的分支也要通过类型检查，指针分支先转 uintptr_t，整数分支对指针传入 0，避免整数/指针隐式转换
+#define LOG_ARG_IS_PTR(x) (__builtin_classify_type(x) == 5) // GCC pointer_type_class
+#define LOG_ARG_WORD(x)                                                                 \
+    __builtin_choose_expr(LOG_ARG_IS_PTR(x), log_arg_ptr((const void *)(uintptr_t)(x)), \
+                          _Generic((x),                                                 \
+                              float: log_arg_float,                                     \
+                              double: log_arg_float,                                    \
+                              default: log_arg_int)(__builtin_choose_expr(LOG_ARG_IS_PTR(x), 0, (x))))
+
+// 可变参数计数与逐个展开（最多 LOG_DEFERRED_MAX_ARGS 个）
+#define LOG_NARGS(...) LOG_NARGS_(0, ##__VA_ARGS__, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, N, ...) N
+#define LOG_CAT(a, b) LOG_CAT_(a, b)
+#define LOG_CAT_(a, b) a##b
+#define LOG_MAP(f, ...) LOG_CAT(LOG_MAP_, LOG_NARGS(__VA_ARGS__))(f, ##__VA_ARGS__)
+#define LOG_MAP_0(f)
+#define LOG_MAP_1(f, a) f(a),
+#define LOG_MAP_2(f, a, ...) f(a), LOG_MAP_1(f, __VA_ARGS__)
+#define LOG_MAP_3(f, a, ...) f(a), LOG_MAP_2(f, __VA_ARGS__)
+#define LOG_MAP_4(f, a, ...) f(a), LOG_MAP_3(f, __VA_ARGS__)
+#define LOG_MAP_5(f, a, ...) f(a), LOG_MAP_4(f, __VA_ARGS__)
+#define LOG_MAP_6(f, a, ...) f(a), LOG_MAP_5(f, __VA_ARGS__)
+#define LOG_MAP_7(f, a, ...) f(a), LOG_MAP_6(f, __VA_ARGS__)
+#define LOG_MAP_8(f, a, ...) f(a), LOG_MAP_7(f, __VA_ARGS__)
+#define LOG_MAP_9(f, a, ...) f(a), LOG_MAP_8(f, __VA_ARGS__)
+#define LOG_MAP_10(f, a, ...) f(a), LOG_MAP_9(f, __VA_ARGS__)
+#define LOG_MAP_11(f, a, ...) f(a), LOG_MAP_10(f, __VA_ARGS__)
+#define LOG_MAP_12(f, a, ...) f(a), LOG_MAP_11(f, __VA_ARGS__)
+#define LOG_MAP_13(f, a, ...) f(a), LOG_MAP_12(f, __VA_ARGS__)
+#define LOG_MAP_14(f, a, ...) f(a), LOG_MAP_13(f, __VA_ARGS__)
+#define LOG_MAP_15(f, a, ...) f(a), LOG_MAP_14(f, __VA_ARGS__)
+
+/**
+ * @brief 记录一条延迟日志（不检查级别）
+ * @note fmt 必须是字符串字面量；args 数组首元素为占位，保证无参数时数组非空
+ */
+#define LOG_DEFERRED_RECORD(lvl, fmt, ...)                                                  \
+    do                                                                                        \
+    {                                                                                         \
+        static const char _log_fmt[] __attribute__((section(LOG_DEFERRED_SECTION), used)) = fmt; \
+        const uint32_t _log_args[] = {0, LOG_MAP(LOG_ARG_WORD, ##__VA_ARGS__)};              \
+        log_deferred_write((lvl), _log_fmt, &_log_args[1],                                  \
+                           sizeof(_log_args) / sizeof(_log_args[0]) - 1);                     \
+    } while (0)
+
+/**
+ * @brief 按级别过滤后记录一条延迟日志
+ * @note 与 LOGI 等无标签的文本日志相同，按 LOG_TAG_DEFAULT 的标签级别（未设置时为全局级别）过滤
+ */
+#define LOG_DEFERRED_PRINT(lvl, fmt, ...)                 \
+    do                                                    \
+    {                                                     \
+        if (LOG_ENABLED(lvl, LOG_TAG_DEFAULT))            \
+        {                                                 \
+            LOG_DEFERRED_RECORD(lvl, fmt, ##__VA_ARGS__); \
+        }                                                 \
+    } while (0)
+
 // ============ 日志宏定义 ============
 #define LOG_TAG_DEFAULT "DF"
 #define LOG_TAG_WIDTH 8 // 标签对齐宽度
 
+#ifdef LOG_DEFERRED
+#define LOG_EMIT(level, tag, fmt, ...) LOG_DEFERRED_RECORD(level, fmt, ##__VA_ARGS__)
+#else
+#define LOG_EMIT(level, tag, fmt, ...) log_print(level, tag, fmt, ##__VA_ARGS__)
+#endif
+
+// 先按级别/标签过滤，未通过时参数不求值
+#define LOG_OUTPUT(level, tag, fmt, ...)              \
+    do                                                \
+    {                                                 \
+        if (LOG_ENABLED(level, tag))                  \
+        {                                             \
+            LOG_EMIT(level, tag, fmt, ##__VA_ARGS__); \
+        }                                             \
+    } while (0)
+
+// 编译期移除的日志：保留类型检查（参数视为已使用），不生成任何代码
+#define LOG_REMOVED(tag, fmt, ...)                              \
+    do                                                          \
+    {                                                           \
+        if (0)                                                  \
+        {                                                       \
+            log_print(LOG_LEVEL_NONE, tag, fmt, ##__VA_ARGS__); \
+        }                                                       \
+    } while (0)
+
+#if LOG_COMPILE_LEVEL >= 1
 // 错误日志 - 红色
 #define LOG_E(tag, fmt, ...) \
-    log_print(LOG_LEVEL_ERROR, tag, LOG_COLOR_RED "[E]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+    LOG_OUTPUT(LOG_LEVEL_ERROR, tag, LOG_COLOR_RED "[E]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+#else
+#define LOG_E(tag, fmt, ...) LOG_REMOVED(tag, fmt, ##__VA_ARGS__)
+#endif
 
+#if LOG_COMPILE_LEVEL >= 2
 // 警告日志 - 黄色
 #define LOG_W(tag, fmt, ...) \
-    log_print(LOG_LEVEL_WARN, tag, LOG_COLOR_YELLOW "[W]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+    LOG_OUTPUT(LOG_LEVEL_WARN, tag, LOG_COLOR_YELLOW "[W]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+#else
+#define LOG_W(tag, fmt, ...) LOG_REMOVED(tag, fmt, ##__VA_ARGS__)
+#endif
 
+#if LOG_COMPILE_LEVEL >= 3
 // 信息日志 - 绿色
 #define LOG_I(tag, fmt, ...) \
-    log_print(LOG_LEVEL_INFO, tag, LOG_COLOR_GREEN "[I]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+    LOG_OUTPUT(LOG_LEVEL_INFO, tag, LOG_COLOR_GREEN "[I]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+#else
+#define LOG_I(tag, fmt, ...) LOG_REMOVED(tag, fmt, ##__VA_ARGS__)
+#endif
 
+#if LOG_COMPILE_LEVEL >= 4
 // 调试日志 - 青色
 #define LOG_D(tag, fmt, ...) \
-    log_print(LOG_LEVEL_DEBUG, tag, LOG_COLOR_CYAN "[D]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+    LOG_OUTPUT(LOG_LEVEL_DEBUG, tag, LOG_COLOR_CYAN "[D]" LOG_COLOR_RESET " %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+#else
+#define LOG_D(tag, fmt, ...) LOG_REMOVED(tag, fmt, ##__VA_ARGS__)
+#endif
 
+#if LOG_COMPILE_LEVEL >= 5
 // 详细日志
 #define LOG_V(tag, fmt, ...) \
-    log_print(LOG_LEVEL_VERBOSE, tag, "[V] %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+    LOG_OUTPUT(LOG_LEVEL_VERBOSE, tag, "[V] %-*s| " fmt, LOG_TAG_WIDTH, tag, ##__VA_ARGS__)
+#else
+#define LOG_V(tag, fmt, ...) LOG_REMOVED(tag, fmt, ##__VA_ARGS__)
+#endif
 
 // ============ 带默认标签的简化宏 ============
 #define LOGE(fmt, ...) LOG_E(LOG_TAG_DEFAULT, fmt, ##__VA_ARGS__)
@@ -215,9 +412,21 @@ void log_printf(const char *fmt, ...); // 格式化输出（不带级别/标签
 void log_hex_dump(log_level_t level, const char *tag, const void *data, size_t len);
 
 // 便捷宏
+#if LOG_COMPILE_LEVEL >= 1
 #define LOG_HEX_E(tag, data, len) log_hex_dump(LOG_LEVEL_ERROR, tag, data, len)
+#else
+#define LOG_HEX_E(tag, data, len) ((void)0)
+#endif
+#if LOG_COMPILE_LEVEL >= 3
 #define LOG_HEX_I(tag, data, len) log_hex_dump(LOG_LEVEL_INFO, tag, data, len)
+#else
+#define LOG_HEX_I(tag, data, len) ((void)0)
+#endif
+#if LOG_COMPILE_LEVEL >= 4
 #define LOG_HEX_D(tag, data, len) log_hex_dump(LOG_LEVEL_DEBUG, tag, data, len)
+#else
+#define LOG_HEX_D(tag, data, len) ((void)0)
+#endif
 
 // ============================================================================
 //                          自动对齐输出宏
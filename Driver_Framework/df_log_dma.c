@@ -0,0 +1,174 @@
+/**
+ * @file df_log_dma.c
+ * @brief 日志 DMA 异步输出（双缓冲）实现
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ */
+
+#include "df_log_dma.h"
+#include "df_log.h"
+#include <string.h>
+
+// ============ 发送缓冲区 ============
+/*
+ * 两块缓冲区按 0,1,0,1... 的顺序填充，也按同样的顺序发送，因此输出顺序与环形缓冲区一致
+ * 每块缓冲区的状态只通过 CAS 推进：
+ *   FREE -> FILLING（填充者独占） -> READY -> BUSY（DMA 传输中） -> FREE（完成中断）
+ * 主循环、SysTick 与 DMA 完成中断都可能进入 stage/start，抢不到状态的一方直接返回
+ */
+enum
+{
+    LOG_DMA_FREE = 0,
+    LOG_DMA_FILLING,
+    LOG_DMA_READY,
+    LOG_DMA_BUSY
+};
+
+typedef struct
+{
+    const log_dma_port_t *port;
+    uint8_t buf[2][LOG_DMA_BUF_SIZE];
+    uint32_t len[2];
+    uint32_t state[2];
+    uint32_t fill_idx; // 下一块要填充的缓冲区
+    uint32_t tx_idx;   // 下一块要发送（或正在发送）的缓冲区
+    log_dma_stats_t stats;
+} log_dma_t;
+
+static log_dma_t g_log_dma;
+
+#define DMA_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define DMA_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define DMA_CAS(p, expect, desired) \
+    __atomic_compare_exchange_n((p), (expect), (desired), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define DMA_ADD(p, v) __atomic_add_fetch((p), (v), __ATOMIC_RELAXED) // 统计计数，主循环与完成中断都会更新
+
+/**
+ * @brief 从环形缓冲区填充空闲的发送缓冲区
+ * @return 取出的字节数
+ */
+static int log_dma_stage(void)
+{
+    int staged = 0;
+
+    for (;;)
+    {
+        uint32_t idx = DMA_LOAD(&g_log_dma.fill_idx);
+        uint32_t expect = LOG_DMA_FREE;
+
+        if (!DMA_CAS(&g_log_dma.state[idx], &expect, LOG_DMA_FILLING))
+        {
+            // 另一块仍在发送/等待发送，剩余数据留在环形缓冲区
+            if (expect != LOG_DMA_FILLING && log_buffer_get_usage() > 0)
+            {
+                DMA_ADD(&g_log_dma.stats.stalls, 1);
+            }
+            break;
+        }
+
+        size_t n = log_buffer_read(g_log_dma.buf[idx], LOG_DMA_BUF_SIZE);
+        if (n == 0)
+        {
+            DMA_STORE(&g_log_dma.state[idx], LOG_DMA_FREE);
+            break;
+        }
+
+        g_log_dma.len[idx] = (uint32_t)n;
+        DMA_STORE(&g_log_dma.fill_idx, idx ^ 1);
+        DMA_STORE(&g_log_dma.state[idx], LOG_DMA_READY);
+        staged += (int)n;
+    }
+    return staged;
+}
+
+/**
+ * @brief 启动已填好的发送缓冲区
+ */
+static void log_dma_start(void)
+{
+    uint32_t idx = DMA_LOAD(&g_log_dma.tx_idx);
+    uint32_t expect = LOG_DMA_READY;
+
+    if (!DMA_CAS(&g_log_dma.state[idx], &expect, LOG_DMA_BUSY))
+    {
+        return;
+    }
+
+    // 读取 tx_idx 与 CAS 之间可能完成了一次传输，此时该块已不是下一个要发送的
+    if (DMA_LOAD(&g_log_dma.tx_idx) != idx ||
+        g_log_dma.port->start(g_log_dma.buf[idx], g_log_dma.len[idx]) != 0)
+    {
+        DMA_STORE(&g_log_dma.state[idx], LOG_DMA_READY);
+    }
+}
+
+int log_dma_kick(void)
+{
+    if (g_log_dma.port == NULL)
+    {
+        return 0;
+    }
+
+    int staged = log_dma_stage();
+    log_dma_start();
+    return staged;
+}
+
+void log_dma_tx_complete(void)
+{
+    if (g_log_dma.port == NULL)
+    {
+        return;
+    }
+
+    uint32_t idx = DMA_LOAD(&g_log_dma.tx_idx);
+    if (DMA_LOAD(&g_log_dma.state[idx]) != LOG_DMA_BUSY)
+    {
+        return;
+    }
+
+    DMA_ADD(&g_log_dma.stats.transfers, 1);
+    DMA_ADD(&g_log_dma.stats.bytes, g_log_dma.len[idx]);
+
+    // 先切换到另一块并立即发送，缩短串口空闲时间，再补充刚释放的缓冲区
+    DMA_STORE(&g_log_dma.tx_idx, idx ^ 1);
+    DMA_STORE(&g_log_dma.state[idx], LOG_DMA_FREE);
+    log_dma_start();
+    log_dma_stage();
+    log_dma_start();
+}
+
+int log_dma_init(const log_dma_port_t *port)
+{
+    if (port == NULL || port->start == NULL)
+    {
+        return -1;
+    }
+
+    memset(&g_log_dma, 0, sizeof(g_log_dma));
+    g_log_dma.port = port;
+    log_set_drain(log_dma_kick);
+    return 0;
+}
+
+void log_dma_deinit(void)
+{
+    log_set_drain(NULL);
+    g_log_dma.port = NULL;
+}
+
+bool log_dma_busy(void)
+{
+    return DMA_LOAD(&g_log_dma.state[0]) != LOG_DMA_FREE ||
+           DMA_LOAD(&g_log_dma.state[1]) != LOG_DMA_FREE;
+}
+
+void log_dma_get_stats(log_dma_stats_t *stats)
+{
+    if (stats != NULL)
+    {
+        stats->transfers = DMA_LOAD(&g_log_dma.stats.transfers);
+        stats->bytes = DMA_LOAD(&g_log_dma.stats.bytes);
+        stats->stalls = DMA_LOAD(&g_log_dma.stats.stalls);
+    }
+}
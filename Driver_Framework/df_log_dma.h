@@ -0,0 +1,75 @@
+/**
+ * @file df_log_dma.h
+ * @brief 日志 DMA 异步输出（双缓冲）
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ * @details 把日志环形缓冲区的数据搬到两块发送缓冲区中轮流交给 DMA：
+ *          - log_flush() 只负责填充空闲发送缓冲区并启动 DMA，立即返回，不再等待串口
+ *          - DMA 传输完成中断释放当前缓冲区，立即启动已填好的另一块，再补充数据
+ *          - 一块在发送时另一块可以填充，串口在日志连续输出时不会出现空闲间隙
+ *
+ * 使用方法：
+ * @code
+ * static int uart_dma_start(const void *data, size_t len) { ... 启动 DMA，忙时返回 -1 ... }
+ * static const log_dma_port_t port = {.start = uart_dma_start};
+ *
+ * log_dma_init(&port);          // 之后 log_flush() 自动改为 DMA 输出
+ * void DMAx_IRQHandler(void)    // DMA 发送完成中断中
+ * {
+ *     ...清除标志...
+ *     log_dma_tx_complete();
+ * }
+ * @endcode
+ * @note 发送缓冲区必须位于 DMA 可访问的内存（STM32F4 的 CCM RAM 不可用）
+ */
+
+#ifndef __DF_LOG_DMA_H__
+#define __DF_LOG_DMA_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ============ 配置 ============
+#ifndef LOG_DMA_BUF_SIZE
+#define LOG_DMA_BUF_SIZE 128 // 单块发送缓冲区大小（共两块）
+#endif
+
+// ============ 硬件接口 ============
+typedef struct
+{
+    /**
+     * @brief 启动一次 DMA 发送
+     * @param data 发送数据，传输完成前保持有效
+     * @param len 数据长度（不超过 LOG_DMA_BUF_SIZE）
+     * @return 0 成功，-1 DMA 忙或暂不可用（稍后由 log_dma_kick() 重试）
+     */
+    int (*start)(const void *data, size_t len);
+} log_dma_port_t;
+
+// ============ 统计 ============
+typedef struct
+{
+    uint32_t transfers; // 完成的传输次数
+    uint32_t bytes;     // 发送的字节数
+    uint32_t stalls;    // 两块缓冲区都在使用、数据留在环形缓冲区的次数
+} log_dma_stats_t;
+
+// ============ 接口 ============
+int log_dma_init(const log_dma_port_t *port); // 注册 DMA 接口并接管 log_flush()
+void log_dma_deinit(void);                    // 恢复同步输出（需在 DMA 空闲时调用）
+int log_dma_kick(void);                       // 填充并启动发送，返回本次从环形缓冲区取出的字节数
+void log_dma_tx_complete(void);               // DMA 发送完成中断中调用
+bool log_dma_busy(void);                      // 是否还有数据未发送完
+void log_dma_get_stats(log_dma_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DF_LOG_DMA_H__ */
@@ -0,0 +1,257 @@
+/**
+ * @file df_sched.c
+ * @brief 协作式任务调度器实现
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ */
+
+#include "df_sched.h"
+#include "df_init.h"
+#include "df_shell.h"
+#include "df_timer.h"
+#include "df_work.h"
+#include <driver.h>
+#include <string.h>
+
+// ============ 任务状态 ============
+enum
+{
+    DF_TASK_STATE_IDLE = 0, // 未加入调度
+    DF_TASK_STATE_ACTIVE,   // wake 到期后执行
+    DF_TASK_STATE_WAITING   // 每轮检查条件
+};
+
+#define SCHED_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define SCHED_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define SCHED_XCHG(p, v) __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+
+// 节拍比较（32位毫秒节拍约49天回绕）
+#define SCHED_DUE(now, t) ((int32_t)((now) - (t)) >= 0)
+
+static df_task_t *df_sched_list = NULL; // 按优先级排序
+static bool df_sched_tickless = DF_SCHED_TICKLESS;
+static uint64_t (*df_sched_cycles)(void) = NULL;
+
+static inline uint64_t df_sched_now(void)
+{
+    return (df_sched_cycles != NULL) ? df_sched_cycles() : 0;
+}
+
+void df_sched_set_cycle_func(uint64_t (*fn)(void))
+{
+    df_sched_cycles = fn;
+}
+
+void df_sched_set_tickless(bool enable)
+{
+    df_sched_tickless = enable;
+}
+
+int df_sched_add(df_task_t *task)
+{
+    if (task == NULL || task->fn == NULL || task->state != DF_TASK_STATE_IDLE)
+    {
+        return -1;
+    }
+
+    task->lc = 0;
+    task->signaled = 0;
+    task->release = get_tick();
+    task->wake = task->release;
+    memset(&task->stats, 0, sizeof(task->stats));
+    task->state = DF_TASK_STATE_ACTIVE;
+
+    // 插入到同优先级任务之后
+    df_task_t **pp = &df_sched_list;
+    while (*pp != NULL && (*pp)->prio <= task->prio)
+    {
+        pp = &(*pp)->next;
+    }
+    task->next = *pp;
+    *pp = task;
+    return 0;
+}
+
+void df_sched_remove(df_task_t *task)
+{
+    for (df_task_t **pp = &df_sched_list; *pp != NULL; pp = &(*pp)->next)
+    {
+        if (*pp == task)
+        {
+            *pp = task->next;
+            task->next = NULL;
+            task->state = DF_TASK_STATE_IDLE;
+            return;
+        }
+    }
+}
+
+void df_task_sleep(df_task_t *task, uint32_t ms)
+{
+    task->wake = get_tick() + ms;
+}
+
+void df_task_wake(df_task_t *task)
+{
+    SCHED_STORE(&task->signaled, 1);
+}
+
+/**
+ * @brief 作业完成：统计截止时间，周期任务释放下一个作业
+ */
+static void df_sched_job_done(df_task_t *task, uint32_t now)
+{
+    uint32_t deadline = (task->deadline != 0) ? task->deadline : task->period;
+
+    task->stats.runs++;
+    if (deadline != 0 && (int32_t)(now - task->release) > (int32_t)deadline)
+    {
+        task->stats.misses++;
+    }
+
+    if (task->period == 0)
+    {
+        df_sched_remove(task);
+        return;
+    }
+
+    // 落后超过一个周期的作业直接跳过，不连续补执行
+    task->release += task->period;
+    while ((int32_t)(now - task->release) >= (int32_t)task->period)
+    {
+        task->release += task->period;
+        task->stats.misses++;
+    }
+    task->wake = task->release;
+}
+
+/**
+ * @brief 任务本轮是否需要执行
+ */
+static bool df_sched_ready(const df_task_t *task, uint32_t now)
+{
+    return SCHED_LOAD(&task->signaled) ||
+           (task->state == DF_TASK_STATE_ACTIVE && SCHED_DUE(now, task->wake));
+}
+
+int df_sched_run_once(void)
+{
+    int progress = 0;
+    df_task_t *task = df_sched_list;
+
+    while (task != NULL)
+    {
+        df_task_t *next = task->next; // 单次任务完成后会被移出链表
+        uint32_t now = get_tick();
+
+        if (task->state == DF_TASK_STATE_WAITING || df_sched_ready(task, now))
+        {
+            SCHED_XCHG(&task->signaled, 0);
+            if (task->lc == 0 && task->state == DF_TASK_STATE_ACTIVE)
+            {
+                uint32_t late = now - task->release;
+                if ((int32_t)late > 0 && late > task->stats.max_late)
+                {
+                    task->stats.max_late = late;
+                }
+            }
+
+            uint64_t t0 = df_sched_now();
+            int ret = task->fn(task);
+            uint64_t exec = df_sched_now() - t0;
+            if (exec > task->stats.max_exec)
+            {
+                task->stats.max_exec = (exec > UINT32_MAX) ? UINT32_MAX : (uint32_t)exec;
+            }
+
+            switch (ret)
+            {
+            case DF_TASK_WAITING:
+                task->state = DF_TASK_STATE_WAITING;
+                break;
+            case DF_TASK_YIELDED:
+                task->state = DF_TASK_STATE_ACTIVE;
+                task->wake = get_tick();
+                progress++;
+                break;
+            case DF_TASK_SLEEPING:
+                task->state = DF_TASK_STATE_ACTIVE; // wake 已由 df_task_sleep 设置
+                progress++;
+                break;
+            default:
+                task->state = DF_TASK_STATE_ACTIVE;
+                df_sched_job_done(task, get_tick());
+                progress++;
+                break;
+            }
+        }
+        task = next;
+    }
+    return progress;
+}
+
+void df_sched_idle(void)
+{
+#if DF_SCHED_USE_WFI
+    // 关中断后再检查，检查之后到达的中断会挂起并立即唤醒 WFI，不会丢失
+    __disable_irq();
+    bool ready = df_work_pending();
+    uint32_t now = get_tick();
+    uint32_t sleep = df_timer_next_expiry(); // 可以休眠的节拍数
+    for (df_task_t *task = df_sched_list; task != NULL && !ready; task = task->next)
+    {
+        ready = df_sched_ready(task, now);
+        if (task->state == DF_TASK_STATE_ACTIVE && task->wake - now < sleep)
+        {
+            sleep = task->wake - now;
+        }
+    }
+    if (!ready)
+    {
+        if (df_sched_tickless)
+        {
+            Systick_Sleep(sleep);
+        }
+        else
+        {
+            __WFI();
+        }
+    }
+    __enable_irq();
+#endif
+}
+
+void df_sched_step(void)
+{
+    int n = df_work_run();
+    n += df_sched_run_once();
+    if (n == 0 && df_init_run_deferred() == 0)
+    {
+        df_sched_idle();
+    }
+}
+
+void df_sched_start(void)
+{
+    while (1)
+    {
+        df_sched_step();
+    }
+}
+
+// ============ Shell 命令 ============
+/**
+ * @brief task  查看调度中的任务与统计
+ */
+static void df_sched_cmd(int argc, void *argv[])
+{
+    shell_printf("name         prio  period      runs  misses  late(ms)  exec(cyc)\n");
+    for (df_task_t *task = df_sched_list; task != NULL; task = task->next)
+    {
+        shell_printf("%-12s %4u %7u %9u %7u %9u %10u\n", task->name ? task->name : "-",
+                     (unsigned)task->prio, (unsigned)task->period, (unsigned)task->stats.runs,
+                     (unsigned)task->stats.misses, (unsigned)task->stats.max_late,
+                     (unsigned)task->stats.max_exec);
+    }
+}
+DF_SHELL_CMD(task, df_sched_cmd, "list scheduled tasks and stats");
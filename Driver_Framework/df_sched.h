@@ -0,0 +1,213 @@
+/**
+ * @file df_sched.h
+ * @brief 协作式任务调度器（无栈协程）
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ * @details 运行到完成的单栈调度器，替代主循环中手写的节拍计数：
+ *          - 周期任务按 SysTick 毫秒节拍释放，带截止时间与超时统计
+ *          - 任务函数可以写成无栈协程（DF_TASK_BEGIN/END），在等待条件、
+ *            让出或休眠处返回，下次调用从返回处继续
+ *          - 同一轮中按优先级依次执行所有到期任务
+ *          - 没有到期任务且工作队列为空时执行 WFI，CPU 休眠到下一个中断
+ *          - 无节拍模式下按最近的任务/定时器到期时刻重设 SysTick，跳过中间的节拍中断
+ *
+ * 使用方法：
+ * @code
+ * static int control_fn(df_task_t *task)
+ * {
+ *     control_update();
+ *     return DF_TASK_ENDED;            // 普通函数：本周期完成
+ * }
+ *
+ * static int display_fn(df_task_t *task)
+ * {
+ *     static uint8_t page;             // 协程局部变量必须为静态或放在任务外
+ *     DF_TASK_BEGIN(task);
+ *     for (page = 0; page < 8; page++)
+ *     {
+ *         oled_flush_page(page);
+ *         DF_TASK_YIELD(task);         // 每页之间让出，其他任务可以先执行
+ *     }
+ *     DF_TASK_END(task);
+ * }
+ *
+ * static df_task_t control = DF_TASK_INIT("control", control_fn, 1, 0);   // 1kHz
+ * static df_task_t display = DF_TASK_INIT("display", display_fn, 20, 2);  // 50Hz
+ *
+ * int main(void)
+ * {
+ *     df_sched_add(&control);
+ *     df_sched_add(&display);
+ *     df_sched_start();                // 不返回
+ * }
+ * @endcode
+ */
+
+#ifndef __DF_SCHED_H__
+#define __DF_SCHED_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <dev_frame.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ============ 配置 ============
+#ifndef DF_SCHED_USE_WFI
+#define DF_SCHED_USE_WFI 1 // 空闲时执行 WFI，调试器连接不稳定时可设为0
+#endif
+
+#ifndef DF_SCHED_TICKLESS
+#define DF_SCHED_TICKLESS 0 // 上电默认是否启用无节拍空闲，运行时可用 df_sched_set_tickless 切换
+#endif
+
+// ============ 任务函数返回值 ============
+#define DF_TASK_ENDED 0    // 本次作业完成（周期任务等待下一周期，单次任务结束）
+#define DF_TASK_YIELDED 1  // 让出，下一轮继续执行
+#define DF_TASK_WAITING 2  // 等待条件，每轮检查一次，不阻止空闲休眠
+#define DF_TASK_SLEEPING 3 // 休眠到 df_task_sleep 设置的时刻
+
+// ============ 任务 ============
+typedef struct df_task df_task_t;
+typedef int (*df_task_fn_t)(df_task_t *task);
+
+typedef struct
+{
+    uint32_t runs;     // 完成的作业数
+    uint32_t misses;   // 超过截止时间完成或被跳过的作业数
+    uint32_t max_late; // 释放到开始执行的最大延迟（ms）
+    uint32_t max_exec; // 单次调用的最长执行时间（周期）
+} df_task_stats_t;
+
+struct df_task
+{
+    const char *name;  // 任务名称
+    df_task_fn_t fn;   // 任务函数
+    uint32_t period;   // 周期（ms），0 表示单次任务
+    uint32_t deadline; // 相对释放时刻的截止时间（ms），0 表示等于周期
+    uint8_t prio;      // 优先级，数值越小越先执行
+    df_arg_t arg;      // 任务参数
+
+    uint16_t lc;           // 内部：协程续点
+    uint8_t state;         // 内部：任务状态
+    uint8_t signaled;      // 内部：df_task_wake 唤醒标志
+    uint32_t release;      // 内部：当前作业释放时刻
+    uint32_t wake;         // 内部：下次调用时刻
+    df_task_t *next;       // 内部：任务链表
+    df_task_stats_t stats; // 运行统计
+};
+
+/** @brief 静态初始化任务 */
+#define DF_TASK_INIT(task_name, func, period_ms, priority) \
+    {.name = (task_name), .fn = (func), .period = (period_ms), .prio = (priority)}
+
+// ============ 无栈协程 ============
+/*
+ * 基于 switch/case 的续点（Duff's device），任务函数返回后局部变量不保留，
+ * 协程体内不能再使用 switch 语句
+ */
+#define DF_TASK_BEGIN(t) \
+    switch ((t)->lc)     \
+    {                    \
+    case 0:
+
+#define DF_TASK_END(t) \
+    }                  \
+    (t)->lc = 0;       \
+    return DF_TASK_ENDED
+
+/** @brief 条件不满足时返回，每轮重新检查 */
+#define DF_TASK_WAIT_UNTIL(t, cond) \
+    do                              \
+    {                               \
+        (t)->lc = __LINE__;         \
+    case __LINE__:                  \
+        if (!(cond))                \
+        {                           \
+            return DF_TASK_WAITING; \
+        }                           \
+    } while (0)
+
+/** @brief 让出 CPU，下一轮从此处继续 */
+#define DF_TASK_YIELD(t)        \
+    do                          \
+    {                           \
+        (t)->lc = __LINE__;     \
+        return DF_TASK_YIELDED; \
+    case __LINE__:;             \
+    } while (0)
+
+/** @brief 休眠 ms 毫秒后从此处继续 */
+#define DF_TASK_SLEEP(t, ms)      \
+    do                            \
+    {                             \
+        df_task_sleep((t), (ms)); \
+        (t)->lc = __LINE__;       \
+        return DF_TASK_SLEEPING;  \
+    case __LINE__:;               \
+    } while (0)
+
+// ============ 接口 ============
+/**
+ * @brief 加入调度，第一次作业立即释放
+ * @return 0 成功，-1 参数错误或已在调度中
+ */
+int df_sched_add(df_task_t *task);
+
+/**
+ * @brief 移出调度（不能在该任务自身的函数中调用）
+ */
+void df_sched_remove(df_task_t *task);
+
+/**
+ * @brief 设置任务下次调用时刻为 ms 毫秒后（DF_TASK_SLEEP 使用）
+ */
+void df_task_sleep(df_task_t *task, uint32_t ms);
+
+/**
+ * @brief 唤醒任务：立即结束休眠或等待，下一轮执行（中断安全）
+ */
+void df_task_wake(df_task_t *task);
+
+/**
+ * @brief 按优先级执行一轮到期任务
+ * @return 执行后有进展（非 WAITING）的任务数
+ */
+int df_sched_run_once(void);
+
+/**
+ * @brief 没有到期任务且工作队列为空时休眠到下一个中断
+ */
+void df_sched_idle(void);
+
+/**
+ * @brief 调度一步：执行工作队列、一轮任务，没有可执行内容时执行一个延迟初始化条目，都没有时休眠
+ */
+void df_sched_step(void);
+
+/**
+ * @brief 启动调度，不返回
+ */
+void df_sched_start(void);
+
+/**
+ * @brief 启用/关闭无节拍空闲
+ * @details 启用后空闲时取最近的任务唤醒时刻与 df_timer_next_expiry() 的较小者，
+ *          调用 Systick_Sleep() 跳过中间的节拍中断，get_tick() 在唤醒时补偿
+ */
+void df_sched_set_tickless(bool enable);
+
+/**
+ * @brief 设置周期计数函数，用于执行时间统计，NULL 关闭
+ */
+void df_sched_set_cycle_func(uint64_t (*fn)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DF_SCHED_H__ */
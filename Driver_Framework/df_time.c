@@ -0,0 +1,84 @@
+/**
+ * @file df_time.c
+ * @brief 64位单调时间基准实现
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ */
+
+#include "df_time.h"
+#include "df_shell.h"
+#include <driver.h>
+
+// ============ 换算系数 ============
+/*
+ * t = 节拍数 × 每节拍时长 + 节拍内周期 × 每周期时长
+ * 每周期时长用 32 位小数定点表示（mult = 10^9 × 2^32 / f），节拍内周期小于 2^24，乘积不溢出
+ * 系数在时钟频率或节拍周期变化时重新计算
+ */
+typedef struct
+{
+    uint32_t hz;      // 计算系数时的内核频率
+    uint32_t period;  // 计算系数时每节拍周期数
+    uint64_t tick_ns; // 每节拍纳秒数
+    uint64_t tick_us; // 每节拍微秒数
+    uint64_t ns_mult; // 每周期纳秒数（32位小数）
+    uint64_t us_mult; // 每周期微秒数（32位小数）
+} df_time_scale_t;
+
+static df_time_scale_t df_time_scale;
+
+static const df_time_scale_t *df_time_get_scale(uint32_t period)
+{
+    uint32_t hz = SystemCoreClock;
+
+    if (df_time_scale.hz != hz || df_time_scale.period != period)
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        df_time_scale.hz = hz;
+        df_time_scale.period = period;
+        df_time_scale.tick_ns = (uint64_t)period * 1000000000ULL / hz;
+        df_time_scale.tick_us = (uint64_t)period * 1000000ULL / hz;
+        df_time_scale.ns_mult = (1000000000ULL << 32) / hz;
+        df_time_scale.us_mult = (1000000ULL << 32) / hz;
+        __set_PRIMASK(primask);
+    }
+    return &df_time_scale;
+}
+
+// ============ 接口 ============
+uint64_t df_time_now_ns(void)
+{
+    uint32_t cycles;
+    uint64_t ticks = Systick_GetTime(&cycles);
+    const df_time_scale_t *scale = df_time_get_scale(Systick_GetPeriod());
+
+    return ticks * scale->tick_ns + (((uint64_t)cycles * scale->ns_mult) >> 32);
+}
+
+uint64_t df_time_now_us(void)
+{
+    uint32_t cycles;
+    uint64_t ticks = Systick_GetTime(&cycles);
+    const df_time_scale_t *scale = df_time_get_scale(Systick_GetPeriod());
+
+    return ticks * scale->tick_us + (((uint64_t)cycles * scale->us_mult) >> 32);
+}
+
+uint64_t df_time_now_ms(void)
+{
+    return df_time_now_us() / 1000;
+}
+
+// ============ Shell 命令 ============
+/**
+ * @brief time  查看当前时间基准
+ */
+static void df_time_cmd(int argc, void *argv[])
+{
+    uint64_t us = df_time_now_us();
+
+    shell_printf("tick %u, uptime %u.%06u s, %u cycles/tick\n", (unsigned)get_tick(),
+                 (unsigned)(us / 1000000), (unsigned)(us % 1000000), (unsigned)Systick_GetPeriod());
+}
+DF_SHELL_CMD(time, df_time_cmd, "show monotonic time base");
@@ -0,0 +1,51 @@
+/**
+ * @file df_time.h
+ * @brief 64位单调时间基准（微秒/纳秒）
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ * @details 由 SysTick 节拍计数与当前节拍内的计数值合成，日志时间戳、传感器采样、控制回路共用同一时钟：
+ *          - 与 get_tick() 同源，节拍补偿（无节拍空闲）后仍一致，64位不回绕
+ *          - 节拍已到期但中断尚未执行时同样计入，中断、关中断期间调用均单调递增
+ *          - 换算只用一次 32×64 位乘法与移位，不做64位除法
+ *          - 分辨率为 1 个内核周期（72MHz 约 14ns，168MHz 约 6ns）
+ *
+ * 使用方法：
+ * @code
+ * uint64_t t0 = df_time_now_us();
+ * mpu6050.read(arg_ptr(&sample));
+ * sample.timestamp_us = t0;
+ *
+ * float dt = (float)(df_time_now_us() - last_us) * 1e-6f;  // 控制周期实测值
+ * @endcode
+ */
+
+#ifndef __DF_TIME_H__
+#define __DF_TIME_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief 上电（SysTick 启动）以来的纳秒数
+ */
+uint64_t df_time_now_ns(void);
+
+/**
+ * @brief 上电以来的微秒数
+ */
+uint64_t df_time_now_us(void);
+
+/**
+ * @brief 上电以来的毫秒数（节拍为 1ms 时即 get_tick() 的64位版本）
+ */
+uint64_t df_time_now_ms(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DF_TIME_H__ */
@@ -0,0 +1,277 @@
+/**
+ * @file df_timer.c
+ * @brief 软件定时器服务（分层时间轮）实现
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ */
+
+#include "df_timer.h"
+#include <driver.h>
+#include <string.h>
+
+// ============ 时间轮 ============
+/*
+ * 第 L 层的槽覆盖 2^(BITS*L) 个节拍，距到期 delta 个节拍的定时器放入满足
+ * delta < 2^(BITS*(L+1)) 的最低层，槽号取到期节拍的第 L 段位
+ *
+ * 每个节拍：
+ *   1. 低层索引回到 0 时，把上一层当前槽中的定时器重新分配（级联），逐层向上
+ *   2. 取下第 0 层当前槽整条链表，依次到期；超出时间轮范围的定时器未到期则重新放入
+ *
+ * 链表用 pprev（指向前一节点 next 字段的指针）实现 O(1) 删除
+ * 启动/停止可能在其他中断中调用，链表操作在关中断下进行，回调执行期间开中断
+ */
+#define TIMER_SLOTS (1u << DF_TIMER_WHEEL_BITS)
+#define TIMER_MASK (TIMER_SLOTS - 1)
+#define TIMER_SHIFT(level) ((level) * DF_TIMER_WHEEL_BITS)
+#define TIMER_RANGE (1u << (DF_TIMER_WHEEL_BITS * DF_TIMER_WHEEL_LEVELS))
+
+#define TIMER_LOCK()                          \
+    uint32_t timer_primask = __get_PRIMASK(); \
+    __disable_irq()
+#define TIMER_UNLOCK() __set_PRIMASK(timer_primask)
+
+static df_timer_t *df_timer_wheel[DF_TIMER_WHEEL_LEVELS][TIMER_SLOTS];
+static volatile uint32_t df_timer_jiffies = 0; // 当前（正在处理的）节拍
+static uint32_t df_timer_active_num = 0;
+
+static void df_timer_link(df_timer_t **head, df_timer_t *timer)
+{
+    timer->next = *head;
+    if (*head != NULL)
+    {
+        (*head)->pprev = &timer->next;
+    }
+    timer->pprev = head;
+    *head = timer;
+}
+
+static void df_timer_unlink(df_timer_t *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next != NULL)
+    {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/**
+ * @brief 按到期时间放入时间轮（调用者持有锁）
+ */
+static void df_timer_enqueue(df_timer_t *timer)
+{
+    uint32_t now = df_timer_jiffies;
+    uint32_t expires = timer->expires;
+    uint32_t delta = expires - now;
+    uint32_t level;
+
+    if ((int32_t)delta < 0)
+    {
+        // 已过期（级联时发现），放入当前槽，本节拍处理
+        expires = now;
+        delta = 0;
+    }
+    else if (delta >= TIMER_RANGE)
+    {
+        // 超出范围：先放入顶层最远的槽，级联回来后重新计算
+        expires = now + TIMER_RANGE - 1;
+        delta = TIMER_RANGE - 1;
+    }
+
+    for (level = 0; level < DF_TIMER_WHEEL_LEVELS - 1; level++)
+    {
+        if (delta < (1u << TIMER_SHIFT(level + 1)))
+        {
+            break;
+        }
+    }
+    df_timer_link(&df_timer_wheel[level][(expires >> TIMER_SHIFT(level)) & TIMER_MASK], timer);
+}
+
+/**
+ * @brief 把第 level 层 idx 槽的定时器重新分配到低层（调用者持有锁）
+ */
+static void df_timer_cascade(uint32_t level, uint32_t idx)
+{
+    df_timer_t *list = df_timer_wheel[level][idx];
+    df_timer_wheel[level][idx] = NULL;
+
+    while (list != NULL)
+    {
+        df_timer_t *timer = list;
+        list = timer->next;
+        df_timer_enqueue(timer);
+    }
+}
+
+static void df_timer_work_fn(df_work_t *work)
+{
+    df_timer_t *timer = (df_timer_t *)work->arg.ptr;
+    timer->fn(timer);
+}
+
+// ============ 接口 ============
+void df_timer_init(df_timer_t *timer, df_timer_fn_t fn, uint8_t flags)
+{
+    if (timer == NULL)
+    {
+        return;
+    }
+    memset(timer, 0, sizeof(*timer));
+    timer->fn = fn;
+    timer->flags = flags;
+}
+
+int df_timer_start(df_timer_t *timer, uint32_t delay, uint32_t period)
+{
+    if (timer == NULL || timer->fn == NULL)
+    {
+        return -1;
+    }
+    if (!(timer->flags & DF_TIMER_ISR) && timer->work.fn == NULL)
+    {
+        df_work_init(&timer->work, df_timer_work_fn, DF_TIMER_WORK_PRIO);
+        timer->work.arg = arg_ptr(timer);
+    }
+
+    TIMER_LOCK();
+    if (timer->pprev != NULL)
+    {
+        df_timer_unlink(timer);
+        df_timer_active_num--;
+    }
+    timer->period = period;
+    // 当前节拍已处理，delay 从下一个节拍开始计
+    timer->expires = df_timer_jiffies + ((delay > 0) ? delay : 1);
+    df_timer_enqueue(timer);
+    df_timer_active_num++;
+    TIMER_UNLOCK();
+    return 0;
+}
+
+int df_timer_stop(df_timer_t *timer)
+{
+    int ret = 1;
+
+    if (timer == NULL)
+    {
+        return 1;
+    }
+    TIMER_LOCK();
+    if (timer->pprev != NULL)
+    {
+        df_timer_unlink(timer);
+        df_timer_active_num--;
+        ret = 0;
+    }
+    TIMER_UNLOCK();
+    return ret;
+}
+
+bool df_timer_active(const df_timer_t *timer)
+{
+    return timer != NULL && timer->pprev != NULL;
+}
+
+void df_timer_tick(void)
+{
+    df_timer_t *expired = NULL;
+    df_timer_t *timer;
+
+    TIMER_LOCK();
+    uint32_t now = ++df_timer_jiffies;
+
+    for (uint32_t level = 1; level < DF_TIMER_WHEEL_LEVELS; level++)
+    {
+        if (((now >> TIMER_SHIFT(level - 1)) & TIMER_MASK) != 0)
+        {
+            break;
+        }
+        df_timer_cascade(level, (now >> TIMER_SHIFT(level)) & TIMER_MASK);
+    }
+
+    // 取下当前槽，回调中启动/停止的定时器不会再进入这条链表
+    df_timer_t **slot = &df_timer_wheel[0][now & TIMER_MASK];
+    if (*slot != NULL)
+    {
+        expired = *slot;
+        expired->pprev = &expired;
+        *slot = NULL;
+    }
+
+    while ((timer = expired) != NULL)
+    {
+        df_timer_unlink(timer);
+        if ((int32_t)(timer->expires - now) > 0)
+        {
+            df_timer_enqueue(timer); // 超出范围的长定时器，尚未到期
+            continue;
+        }
+
+        if (timer->period > 0)
+        {
+            // 落后多个周期时跳过，不连续补执行
+            do
+            {
+                timer->expires += timer->period;
+            } while ((int32_t)(timer->expires - now) <= 0);
+            df_timer_enqueue(timer);
+        }
+        else
+        {
+            df_timer_active_num--;
+        }
+
+        if (timer->flags & DF_TIMER_ISR)
+        {
+            TIMER_UNLOCK();
+            timer->fn(timer);
+            __disable_irq();
+        }
+        else
+        {
+            df_work_submit(&timer->work);
+        }
+    }
+    TIMER_UNLOCK();
+}
+
+uint32_t df_timer_next_expiry(void)
+{
+    uint32_t next = UINT32_MAX;
+
+    TIMER_LOCK();
+    uint32_t now = df_timer_jiffies;
+    for (uint32_t level = 0; level < DF_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t base = now >> TIMER_SHIFT(level);
+        // 当前槽（k = 0）已处理过，再次轮到它是在一整圈之后（k = TIMER_SLOTS）
+        for (uint32_t k = 1; k <= TIMER_SLOTS; k++)
+        {
+            if (df_timer_wheel[level][(base + k) & TIMER_MASK] != NULL)
+            {
+                // 该槽在其起始节拍处理（第0层到期，高层级联）
+                uint32_t delta = ((base + k) << TIMER_SHIFT(level)) - now;
+                if (delta < next)
+                {
+                    next = delta;
+                }
+                break;
+            }
+        }
+    }
+    TIMER_UNLOCK();
+    return next;
+}
+
+uint32_t df_timer_now(void)
+{
+    return df_timer_jiffies;
+}
+
+uint32_t df_timer_count(void)
+{
+    return df_timer_active_num;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file df_timer.h
+ * @brief 软件定时器服务（分层时间轮）
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ * @details 由 SysTick 节拍驱动的单次/周期定时器，取代各模块各自维护的毫秒计数：
+ *          - DF_TIMER_WHEEL_LEVELS 层、每层 2^DF_TIMER_WHEEL_BITS 个槽的时间轮，
+ *            启动、停止均为 O(1)，每个节拍只处理当前槽，与定时器数量无关
+ *          - 高层槽到期时把其中的定时器重新分配到低层（级联）
+ *          - 回调可在节拍中断中直接执行（DF_TIMER_ISR），
+ *            或提交到 df_work 工作队列在主循环执行（DF_TIMER_DEFERRED，默认）
+ *
+ * 使用方法：
+ * @code
+ * static void blink_fn(df_timer_t *timer)
+ * {
+ *     led.toggle(arg_null);
+ * }
+ *
+ * static df_timer_t blink = DF_TIMER_INIT(blink_fn, DF_TIMER_DEFERRED);
+ *
+ * df_timer_start(&blink, 500, 500);   // 500ms 后首次到期，之后每 500ms 一次
+ * df_timer_stop(&blink);
+ * @endcode
+ */
+
+#ifndef __DF_TIMER_H__
+#define __DF_TIMER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <dev_frame.h>
+#include "df_work.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ============ 配置 ============
+#ifndef DF_TIMER_WHEEL_BITS
+#define DF_TIMER_WHEEL_BITS 5 // 每层 32 个槽
+#endif
+
+#ifndef DF_TIMER_WHEEL_LEVELS
+#define DF_TIMER_WHEEL_LEVELS 4 // 4 层覆盖 2^20 ms（约17分钟），更长的定时器到顶层后重新级联
+#endif
+
+#ifndef DF_TIMER_WORK_PRIO
+#define DF_TIMER_WORK_PRIO DF_WORK_PRIO_HIGH // 延迟回调使用的工作队列优先级
+#endif
+
+#if DF_TIMER_WHEEL_BITS * DF_TIMER_WHEEL_LEVELS > 30
+#error "DF_TIMER_WHEEL_BITS * DF_TIMER_WHEEL_LEVELS must not exceed 30"
+#endif
+
+// ============ 回调执行方式 ============
+#define DF_TIMER_DEFERRED 0x00 // 提交到工作队列，在 df_work_run() 中执行
+#define DF_TIMER_ISR 0x01      // 在 df_timer_tick() 中直接执行（节拍中断上下文）
+
+// ============ 定时器 ============
+typedef struct df_timer df_timer_t;
+typedef void (*df_timer_fn_t)(df_timer_t *timer);
+
+struct df_timer
+{
+    df_timer_fn_t fn; // 到期回调
+    df_arg_t arg;     // 回调参数
+    uint8_t flags;    // DF_TIMER_DEFERRED / DF_TIMER_ISR
+
+    uint32_t period;      // 内部：周期（节拍），0 为单次
+    uint32_t expires;     // 内部：到期节拍
+    df_timer_t *next;     // 内部：槽链表
+    df_timer_t **pprev;   // 内部：指向前一节点 next 的指针，NULL 表示未启动
+    df_work_t work;       // 内部：延迟回调工作项
+};
+
+/** @brief 静态初始化定时器 */
+#define DF_TIMER_INIT(func, timer_flags) {.fn = (func), .flags = (timer_flags)}
+
+// ============ 接口 ============
+/**
+ * @brief 初始化定时器
+ * @param flags DF_TIMER_DEFERRED / DF_TIMER_ISR
+ */
+void df_timer_init(df_timer_t *timer, df_timer_fn_t fn, uint8_t flags);
+
+/**
+ * @brief 启动（或重新启动）定时器（中断安全）
+ * @param delay 首次到期的节拍数，0 按 1 处理
+ * @param period 周期节拍数，0 为单次定时器
+ * @return 0 成功，-1 参数错误
+ */
+int df_timer_start(df_timer_t *timer, uint32_t delay, uint32_t period);
+
+/**
+ * @brief 停止定时器（中断安全）
+ * @return 0 已停止，1 定时器未启动
+ * @note 已提交到工作队列、尚未执行的延迟回调仍会执行一次
+ */
+int df_timer_stop(df_timer_t *timer);
+
+/**
+ * @brief 定时器是否已启动
+ */
+bool df_timer_active(const df_timer_t *timer);
+
+/**
+ * @brief 推进一个节拍并处理到期定时器，在 SysTick 中断中调用
+ */
+void df_timer_tick(void);
+
+/**
+ * @brief 距离时间轮下一次需要处理（定时器到期或级联）的节拍数
+ * @return >= 1，没有启动的定时器时返回 UINT32_MAX
+ * @note 供无节拍空闲计算可以跳过的节拍数，返回值不晚于最早的到期时刻
+ */
+uint32_t df_timer_next_expiry(void);
+
+/**
+ * @brief 当前节拍计数
+ */
+uint32_t df_timer_now(void);
+
+/**
+ * @brief 已启动的定时器数量
+ */
+uint32_t df_timer_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DF_TIMER_H__ */
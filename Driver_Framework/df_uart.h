@@ -2,6 +2,7 @@
 #define __DF_UART_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <dev_frame.h>
 
@@ -18,6 +19,7 @@ typedef struct df_uart_struct
   int (*init)(df_arg_t);                  // 初始化UART，传参arg_null
   int (*deinit)(df_arg_t);                // 关闭UART，传参arg_null
   int (*send)(df_arg_t);                  // 发送数据，传参arg_ptr(data)
+  int (*write)(const void *data, size_t len); // 按长度发送（特殊接口，无需NUL结尾，可为空）
   int (*printf)(const char *format, ...); // 格式化输出函数（特殊接口）
   int (*receive)(df_arg_t);               // 接收数据，传参arg_ptr(buffer)
   int (*send_dma)(df_arg_t);              // DMA发送，传参arg_ptr(data)
@@ -0,0 +1,199 @@
+/**
+ * @file df_work.c
+ * @brief 延迟工作队列（中断下半部）实现
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ */
+
+#include "df_work.h"
+#include "df_log.h"
+#include "df_shell.h"
+#include <string.h>
+
+// ============ 队列 ============
+/*
+ * 每个优先级两条单链表：
+ *   df_work_head[p] 提交栈，任何上下文用 CAS 压栈（后进先出）
+ *   df_work_fifo[p] 执行队列，只由 df_work_run 访问
+ * 执行队列空时把提交栈整体摘下并反转接到执行队列，同优先级因此按提交顺序执行
+ * 工作项状态 IDLE -> QUEUED 只能由一个提交者通过 CAS 完成，保证同一工作项不会重复入链
+ */
+enum
+{
+    DF_WORK_IDLE = 0,
+    DF_WORK_QUEUED
+};
+
+#define WORK_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define WORK_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define WORK_XCHG(p, v) __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+#define WORK_CAS(p, e, v) \
+    __atomic_compare_exchange_n((p), (e), (v), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define WORK_INC(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+
+static df_work_t *df_work_head[DF_WORK_PRIO_NUM];
+static df_work_t *df_work_fifo[DF_WORK_PRIO_NUM];
+static df_work_stats_t df_work_stats[DF_WORK_PRIO_NUM];
+static uint64_t (*df_work_cycles)(void) = NULL;
+
+static inline uint64_t df_work_now(void)
+{
+    return (df_work_cycles != NULL) ? df_work_cycles() : 0;
+}
+
+// ============ 接口 ============
+void df_work_set_cycle_func(uint64_t (*fn)(void))
+{
+    df_work_cycles = fn;
+}
+
+void df_work_init(df_work_t *work, df_work_fn_t fn, uint8_t prio)
+{
+    if (work == NULL)
+    {
+        return;
+    }
+    memset(work, 0, sizeof(*work));
+    work->fn = fn;
+    work->prio = prio;
+}
+
+int df_work_submit(df_work_t *work)
+{
+    uint8_t idle = DF_WORK_IDLE;
+
+    if (work == NULL || work->fn == NULL || work->prio >= DF_WORK_PRIO_NUM)
+    {
+        return -1;
+    }
+    if (!WORK_CAS(&work->state, &idle, DF_WORK_QUEUED))
+    {
+        WORK_INC(&df_work_stats[work->prio].coalesced);
+        return 1;
+    }
+
+    work->submit_cycles = df_work_now();
+
+    df_work_t *head = WORK_LOAD(&df_work_head[work->prio]);
+    do
+    {
+        work->next = head;
+    } while (!WORK_CAS(&df_work_head[work->prio], &head, work));
+    return 0;
+}
+
+/**
+ * @brief 取出最高优先级的下一个工作项
+ */
+static df_work_t *df_work_pop(void)
+{
+    for (int p = 0; p < DF_WORK_PRIO_NUM; p++)
+    {
+        if (df_work_fifo[p] == NULL && WORK_LOAD(&df_work_head[p]) != NULL)
+        {
+            // 摘下提交栈并反转为先进先出
+            df_work_t *list = WORK_XCHG(&df_work_head[p], NULL);
+            df_work_t *fifo = NULL;
+            while (list != NULL)
+            {
+                df_work_t *next = list->next;
+                list->next = fifo;
+                fifo = list;
+                list = next;
+            }
+            df_work_fifo[p] = fifo;
+        }
+        if (df_work_fifo[p] != NULL)
+        {
+            df_work_t *work = df_work_fifo[p];
+            df_work_fifo[p] = work->next;
+            return work;
+        }
+    }
+    return NULL;
+}
+
+int df_work_run(void)
+{
+    int count = 0;
+    df_work_t *work;
+
+    while (count < DF_WORK_RUN_BUDGET && (work = df_work_pop()) != NULL)
+    {
+        df_work_stats_t *st = &df_work_stats[work->prio];
+        uint64_t delay = df_work_now() - work->submit_cycles;
+
+        st->executed++;
+        st->total_delay += delay;
+        if (delay > st->max_delay)
+        {
+            st->max_delay = (delay > UINT32_MAX) ? UINT32_MAX : (uint32_t)delay;
+        }
+
+        // 先回到空闲状态，工作函数执行期间的新提交会重新排队而不是被合并
+        WORK_STORE(&work->state, DF_WORK_IDLE);
+        work->fn(work);
+        count++;
+    }
+    return count;
+}
+
+bool df_work_pending(void)
+{
+    for (int p = 0; p < DF_WORK_PRIO_NUM; p++)
+    {
+        if (df_work_fifo[p] != NULL || WORK_LOAD(&df_work_head[p]) != NULL)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void df_work_get_stats(uint8_t prio, df_work_stats_t *stats)
+{
+    if (stats != NULL && prio < DF_WORK_PRIO_NUM)
+    {
+        *stats = df_work_stats[prio];
+    }
+}
+
+void df_work_reset_stats(void)
+{
+    memset(df_work_stats, 0, sizeof(df_work_stats));
+}
+
+void df_work_log_stats(void)
+{
+    for (int p = 0; p < DF_WORK_PRIO_NUM; p++)
+    {
+        const df_work_stats_t *st = &df_work_stats[p];
+        uint32_t avg = (st->executed > 0) ? (uint32_t)(st->total_delay / st->executed) : 0;
+        LOG_I("WORK", "prio %d: run %u, coalesced %u, delay avg %u max %u cycles", p,
+              (unsigned)st->executed, (unsigned)st->coalesced, (unsigned)avg,
+              (unsigned)st->max_delay);
+    }
+}
+
+// ============ Shell 命令 ============
+/**
+ * @brief work        查看各优先级统计
+ *        work reset  清零统计
+ */
+static void df_work_cmd(int argc, void *argv[])
+{
+    if (argc > 1 && strcmp((char *)argv[0], "reset") == 0)
+    {
+        df_work_reset_stats();
+        return;
+    }
+    shell_printf("prio      run  coalesced  avg(cyc)  max(cyc)\n");
+    for (int p = 0; p < DF_WORK_PRIO_NUM; p++)
+    {
+        const df_work_stats_t *st = &df_work_stats[p];
+        uint32_t avg = (st->executed > 0) ? (uint32_t)(st->total_delay / st->executed) : 0;
+        shell_printf("%4d %8u %10u %9u %9u\n", p, (unsigned)st->executed,
+                     (unsigned)st->coalesced, (unsigned)avg, (unsigned)st->max_delay);
+    }
+}
+DF_SHELL_CMD(work, df_work_cmd, "work queue stats, 'work reset' to clear");
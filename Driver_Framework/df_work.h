@@ -0,0 +1,123 @@
+/**
+ * @file df_work.h
+ * @brief 延迟工作队列（中断下半部）
+ * @author Driver Framework Team
+ * @date 2026-01-01
+ * @details 中断中只提交工作项，实际处理在主循环的 df_work_run() 中按优先级执行：
+ *          - 工作项静态分配，提交不申请内存，同一工作项未执行前重复提交只排队一次
+ *          - 每个优先级一个无锁提交栈（CAS），中断、主循环均可调用 df_work_submit()
+ *          - df_work_run() 每执行一项都重新从最高优先级查找，同优先级先提交先执行
+ *          - 统计每个优先级从提交到开始执行的延迟（周期数）
+ *
+ * 使用方法：
+ * @code
+ * static void rx_work_fn(df_work_t *work) { ... 处理 work->arg ... }
+ * static df_work_t rx_work = DF_WORK_INIT(rx_work_fn, DF_WORK_PRIO_HIGH);
+ *
+ * void USART1_IRQHandler(void)  // 中断中
+ * {
+ *     rx_work.arg = arg_u32(USART1->DR);
+ *     df_work_submit(&rx_work);
+ * }
+ *
+ * while (1)                     // 主循环中
+ * {
+ *     df_work_run();
+ * }
+ * @endcode
+ */
+
+#ifndef __DF_WORK_H__
+#define __DF_WORK_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <dev_frame.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ============ 配置 ============
+#ifndef DF_WORK_PRIO_NUM
+#define DF_WORK_PRIO_NUM 4 // 优先级数量，0 最高
+#endif
+
+#ifndef DF_WORK_RUN_BUDGET
+#define DF_WORK_RUN_BUDGET 32 // 单次 df_work_run() 最多执行的工作项数
+#endif
+
+#define DF_WORK_PRIO_HIGH 0
+#define DF_WORK_PRIO_LOW (DF_WORK_PRIO_NUM - 1)
+
+// ============ 工作项 ============
+typedef struct df_work df_work_t;
+typedef void (*df_work_fn_t)(df_work_t *work);
+
+struct df_work
+{
+    df_work_fn_t fn; // 工作函数
+    df_arg_t arg;    // 工作参数（提交前设置）
+    uint8_t prio;    // 优先级 0..DF_WORK_PRIO_NUM-1
+
+    uint8_t state;          // 内部：空闲/已排队
+    df_work_t *next;        // 内部：队列链接
+    uint64_t submit_cycles; // 内部：提交时刻
+};
+
+/** @brief 静态初始化工作项 */
+#define DF_WORK_INIT(func, priority) {.fn = (func), .prio = (priority)}
+
+// ============ 统计 ============
+typedef struct
+{
+    uint32_t executed;    // 执行次数
+    uint32_t coalesced;   // 已排队时重复提交被合并的次数
+    uint32_t max_delay;   // 提交到开始执行的最大延迟（周期）
+    uint64_t total_delay; // 延迟累计（周期），平均值 = total_delay / executed
+} df_work_stats_t;
+
+// ============ 接口 ============
+/**
+ * @brief 设置周期计数函数，用于延迟统计
+ * @param fn 返回64位周期计数（目标板 get_cycles64，主机仿真为虚拟周期），NULL 关闭统计
+ */
+void df_work_set_cycle_func(uint64_t (*fn)(void));
+
+/**
+ * @brief 初始化工作项
+ */
+void df_work_init(df_work_t *work, df_work_fn_t fn, uint8_t prio);
+
+/**
+ * @brief 提交工作项（中断安全）
+ * @return 0 已排队，1 已在队列中（合并），-1 参数错误
+ */
+int df_work_submit(df_work_t *work);
+
+/**
+ * @brief 执行待处理的工作项，直到队列为空或达到 DF_WORK_RUN_BUDGET
+ * @return 执行的工作项数
+ */
+int df_work_run(void);
+
+/**
+ * @brief 是否有待执行的工作项
+ */
+bool df_work_pending(void);
+
+void df_work_get_stats(uint8_t prio, df_work_stats_t *stats);
+void df_work_reset_stats(void);
+
+/**
+ * @brief 通过日志输出各优先级统计
+ */
+void df_work_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DF_WORK_H__ */
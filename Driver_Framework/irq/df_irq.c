@@ -2,82 +2,169 @@
  * @file    df_irq.c
  * @brief   驱动框架 - 中断处理模块
  *
- * @details 本模块实现了一个软件中断处理框架，用于将硬件中断与业务逻辑解耦�?
+ * @details 本模块实现了一个软件中断处理框架，用于将硬件中断与业务逻辑解耦。
  *
- *          设计思想�?
- *          1. 中断服务程序(ISR)中只做最少的工作：标记中断状态、保存数�?
+ *          设计思想：
+ *          1. 中断服务程序(ISR)中只做最少的工作：事件参数入队、置位挂起位
  *          2. 实际的业务处理在主循环中按优先级顺序执行
- *          3. 通过状态机机制避免中断处理冲突
+ *          3. 每个中断有独立的无锁事件队列，处理前连续到达的中断不会丢失
  *
- *          工作流程�?
- *          ┌─────────────�?   ┌──────────────────�?   ┌─────────────────�?
- *          �? 硬件中断   │───>�?irq_handle_loader │───>�?标记PENDING状�?�?
- *          �? (ISR调用)  �?   �?  (加载中断数据)  �?   �?  保存参数argv  �?
- *          └─────────────�?   └──────────────────�?   └─────────────────�?
- *                                                              �?
- *          ┌─────────────�?   ┌──────────────────�?            �?
- *          �? 执行回调   �?───�?irq_handle_runner �?────────────�?
- *          �? 清除状�?  �?   �?(主循环中调用)    �?
- *          └─────────────�?   └──────────────────�?
+ *          数据结构：
+ *          - df_irq_index[irq_num]  中断号直接索引到句柄槽位，加载为 O(1)
+ *          - df_irq_slot[slot]      槽位按优先级排序，槽位0优先级最高
+ *          - df_irq_pending         挂起位图，槽位 s 对应第 (31 - s) 位，
+ *                                   CLZ 即得到最高优先级的挂起槽位
  *
- *          状态转换：
- *          IRQ_STATE_DISABLE ──(loader)──> IRQ_STATE_PENDING ──(runner)──> IRQ_STATE_READY ──(执行�?──> IRQ_STATE_DISABLE
+ *          工作流程：
+ *          ISR: df_irq_load ──> 事件入队 ──> 置位挂起位
+ *          主循环: df_irq_run ──> CLZ 取最高优先级槽位 ──> 出队执行 ──> 队列空时清除挂起位
  *
- * @version 1.0
+ * @version 2.0
  * @date    2025-12-27
  *
- * @note    使用须知�?
- *          - 中断句柄数组必须�?irq_num = 0xFFFF 作为结束标记
- *          - 优先级数值越小，优先级越高（0为最高优先级�?
- *          - 在ISR中调用loader，在主循环中调用runner
+ * @note    使用须知：
+ *          - 中断句柄数组必须以 DF_IRQ_END（irq_num = 0xFFFF）作为结束标记
+ *          - 优先级数值越小，优先级越高（0为最高优先级）
+ *          - 在ISR中调用 df_irq_load，在主循环中调用 df_irq_run
  */
 
 #include "df_irq.h"
 #include "df_init.h"
 #include "df_log.h"
+#include "df_sched.h"
+#include "df_time.h"
+#include "df_work.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 // 外部函数声明
 extern uint32_t get_tick(void);
 
 /*============================================================================*/
-/*                              私有函数定义                                   */
+/*                              私有数据                                       */
+/*============================================================================*/
+
+// 原子操作封装（GCC 内建，目标板与主机通用）
+#define IRQ_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define IRQ_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define IRQ_OR(p, v) __atomic_fetch_or((p), (v), __ATOMIC_ACQ_REL)
+#define IRQ_AND(p, v) __atomic_fetch_and((p), (v), __ATOMIC_ACQ_REL)
+#define IRQ_INC(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+
+// 前导零计数：Cortex-M3/M4 编译为单条 CLZ 指令
+#if defined(__GNUC__) || defined(__clang__)
+#define DF_IRQ_CLZ(x) ((uint32_t)__builtin_clz(x))
+#elif defined(__CC_ARM)
+#define DF_IRQ_CLZ(x) ((uint32_t)__clz(x))
+#else
+static uint32_t DF_IRQ_CLZ(uint32_t x)
+{
+    uint32_t n = 0;
+    while ((x & 0x80000000u) == 0)
+    {
+        x <<= 1;
+        n++;
+    }
+    return n;
+}
+#endif
+
+#define DF_IRQ_SLOT_NONE 0xFF                    // 中断号未注册
+#define DF_IRQ_BIT(slot) (0x80000000u >> (slot)) // 槽位对应的挂起位
+#define DF_IRQ_QUEUE_MASK (DF_IRQ_QUEUE_DEPTH - 1)
+
+static df_irq_t *df_irq_table = NULL;         // 已注册的句柄数组
+static uint8_t df_irq_index[DF_IRQ_NUM_MAX];  // 中断号 -> 槽位
+static df_irq_t *df_irq_slot[DF_IRQ_MAX_NUM]; // 槽位 -> 句柄（按优先级排序）
+static uint32_t df_irq_pending = 0;           // 挂起位图
+static df_irq_stats_t df_irq_stats;           // 统计信息
+
+/*============================================================================*/
+/*                              公共函数定义                                   */
 /*============================================================================*/
 
 /**
- * @brief   在中断句柄数组中查找指定中断号的句柄索引
+ * @brief   注册中断句柄数组
+ *
+ * @details 按优先级（同优先级保持数组顺序）为每个句柄分配槽位，
+ *          并建立中断号到槽位的直接索引表，清空所有事件队列与挂起位。
+ *
+ * @param[in,out] ih  中断处理句柄数组，需以irq_num=0xFFFF结尾
  *
- * @details 遍历中断句柄数组，根据中断号查找对应的处理句柄�?
+ * @return  int 注册的句柄数量
+ * @retval  -1  句柄数量超过 DF_IRQ_MAX_NUM、中断号超出 DF_IRQ_NUM_MAX 或重复
  *
- *          注意事项�?
- *          - 当前实现�?sizeof(irq_handles) 无法正确获取数组大小
- *            因为数组作为参数传递时会退化为指针
- *          - 建议改用结束标记(0xFFFF)来判断数组边�?
+ * @note    应在初始化阶段（中断使能前）调用
+ */
+int df_irq_register(df_irq_t ih[])
+{
+    int count = 0;
+
+    IRQ_STORE(&df_irq_table, NULL);
+    IRQ_STORE(&df_irq_pending, 0);
+    memset(df_irq_index, DF_IRQ_SLOT_NONE, sizeof(df_irq_index));
+
+    for (int i = 0; ih[i].irq_num != 0xFFFF; i++)
+    {
+        if (count >= DF_IRQ_MAX_NUM || ih[i].irq_num >= DF_IRQ_NUM_MAX ||
+            df_irq_index[ih[i].irq_num] != DF_IRQ_SLOT_NONE)
+        {
+            LOG_E("IRQ", "Invalid irq table entry %d (irq %u)", i, ih[i].irq_num);
+            memset(df_irq_index, DF_IRQ_SLOT_NONE, sizeof(df_irq_index));
+            return -1;
+        }
+        df_irq_index[ih[i].irq_num] = 0; // 先占位，用于重复检测
+
+        // 插入排序：优先级数值小的在前，同优先级保持数组顺序
+        int pos = count;
+        while (pos > 0 && df_irq_slot[pos - 1]->priority > ih[i].priority)
+        {
+            df_irq_slot[pos] = df_irq_slot[pos - 1];
+            pos--;
+        }
+        df_irq_slot[pos] = &ih[i];
+        count++;
+
+        ih[i].state = DF_IRQ_STATE_DISABLE;
+        ih[i].head = 0;
+        ih[i].tail = 0;
+        ih[i].high_water = 0;
+        ih[i].dropped = 0;
+    }
+
+    for (int s = 0; s < count; s++)
+    {
+        df_irq_index[df_irq_slot[s]->irq_num] = (uint8_t)s;
+    }
+    IRQ_STORE(&df_irq_table, ih);
+    return count;
+}
+
+/**
+ * @brief   在中断句柄数组中查找指定中断号的句柄索引
  *
- * @param[in]  irq_handles  中断处理句柄数组，需以irq_num=0xFFFF结尾
- * @param[in]  irq_num      要查找的中断号（如：USART1_IRQn, TIM2_IRQn等）
+ * @param[in]  ih       中断处理句柄数组，需以irq_num=0xFFFF结尾
+ * @param[in]  irq_num  要查找的中断号（如：USART1_IRQn, TIM2_IRQn等）
  *
  * @return  int8_t 查找结果
  * @retval  >=0    成功找到，返回句柄在数组中的索引位置
- * @retval  -1     未找到匹配的中断�?
+ * @retval  -1     未找到匹配的中断号
  *
- * @par 示例代码�?
- * @code
- *     irq_handle_t handles[] = {
- *         {.irq_num = USART1_IRQn, ...},
- *         {.irq_num = TIM2_IRQn, ...},
- *         {.irq_num = 0xFFFF}  // 结束标记
- *     };
- *     int8_t idx = find_irq_handle(handles, USART1_IRQn);
- *     if (idx >= 0) {
- *         // 找到了，idx = 0
- *     }
- * @endcode
+ * @note    ih 为已注册的数组时直接查表，否则线性查找
  */
 int8_t df_irq_find(df_irq_t ih[], uint16_t irq_num)
 {
-    /* 遍历句柄数组，使�?xFFFF作为结束标记 */
+    if (ih == IRQ_LOAD(&df_irq_table))
+    {
+        if (irq_num >= DF_IRQ_NUM_MAX || df_irq_index[irq_num] == DF_IRQ_SLOT_NONE)
+        {
+            return -1;
+        }
+        return (int8_t)(df_irq_slot[df_irq_index[irq_num]] - ih);
+    }
+
+    /* 未注册的数组：遍历句柄数组，使用0xFFFF作为结束标记 */
     for (int i = 0; ih[i].irq_num != 0xFFFF; i++)
     {
         if (ih[i].irq_num == irq_num)
@@ -85,165 +172,171 @@ int8_t df_irq_find(df_irq_t ih[], uint16_t irq_num)
             return i; /* 找到匹配项，返回索引 */
         }
     }
-    return -1; /* 遍历完成，未找到匹配�?*/
+    return -1; /* 遍历完成，未找到匹配项 */
 }
 
-/*============================================================================*/
-/*                              公共函数定义                                   */
-/*============================================================================*/
-
 /**
- * @brief   中断处理加载�?- 在ISR中调用，用于加载中断数据
+ * @brief   中断处理加载器 - 在ISR中调用，用于加载中断数据
  *
- * @details 此函数应在硬件中断服务程�?ISR)中调用�?
- *          主要功能�?
- *          1. 根据中断号查找对应的处理句柄
- *          2. 检查上一次中断是否处理完成（防止数据覆盖�?
- *          3. 将中断状态标记为PENDING，等待runner处理
- *          4. 保存中断相关的参数数�?
+ * @details 此函数应在硬件中断服务程序(ISR)中调用：
+ *          1. 按中断号直接索引到处理句柄
+ *          2. 将参数放入该中断的事件队列
+ *          3. 置位挂起位图，等待 df_irq_run 处理
  *
- *          防重入机制：
- *          如果上一次中断数据尚未处理完（状态仍为PENDING），
- *          则丢弃本次数据，通过读取寄存器清除中断标志�?
+ *          队列满时丢弃本次事件并计入 dropped。
  *
- * @param[in,out] ih       中断处理句柄指针数组，需以irq_num=0xFFFF结尾
+ * @param[in,out] ih       中断处理句柄数组，需以irq_num=0xFFFF结尾
  * @param[in]     irq_num  触发的中断号
- * @param[in]     argv     中断参数数组，通常包含接收到的数据指针
- *                         - argv[0]: 通常为数据缓冲区指针
- *                         - argv[1]: 可选，数据长度等附加信�?
+ * @param[in]     argv     中断参数，在 df_irq_run 执行处理线程时传入
  *
  * @return  int 加载结果
  * @retval  0   成功加载，等待runner执行
- * @retval  -1  加载失败，上次中断未处理完，本次数据被丢�?
- * @retval  -2  未找到对应的中断处理句柄
+ * @retval  -1  加载失败，事件队列已满，本次数据被丢弃
+ * @retval  -2  未找到对应的中断处理句柄，或 ih 不是已注册的句柄数组
+ *
+ * @note    不在中断中注册句柄数组：注册会清空索引与挂起位，与主循环中的 df_irq_run 冲突
  *
- * @warning 此函数运行在中断上下文中，应尽量简�?
+ * @warning 此函数运行在中断上下文中，同一中断号只能由一个ISR加载
  * @warning argv指向的数据在runner处理前不应被修改
  *
- * @par 使用示例（在USART中断中）�?
+ * @par 使用示例（在USART中断中）：
  * @code
  *     void USART1_IRQHandler(void) {
  *         if (USART_GetITStatus(USART1, USART_IT_RXNE)) {
- *             static uint8_t rx_data;
- *             rx_data = USART_ReceiveData(USART1);
- *             void *args[] = {&rx_data, NULL};
- *             irq_handle_loader(irq_handles, USART1_IRQn, args);
+ *             df_irq_load(irq_handles, USART1_IRQn, arg_u32(USART_ReceiveData(USART1)));
  *         }
  *     }
  * @endcode
  */
 int df_irq_load(df_irq_t ih[], uint16_t irq_num, df_arg_t argv)
 {
-    /* 步骤1：根据中断号查找对应的处理句�?*/
-    int8_t irq_handle_index = df_irq_find(ih, irq_num);
-
-    if (irq_handle_index >= 0)
+    if (IRQ_LOAD(&df_irq_table) != ih)
     {
-        /* 步骤2：检查中断状态，防止数据覆盖 */
-        if (ih[irq_handle_index].state == DF_IRQ_STATE_PENDING)
-        {
-            return -1; /* 加载失败，数据被丢弃 */
-        }
-        else
-        {
-            /* 步骤3：标记中断状态为待处�?*/
-            ih[irq_handle_index].state = DF_IRQ_STATE_PENDING;
-
-            /* 步骤4：保存中断参数，供runner使用 */
-            ih[irq_handle_index].argv = argv;
-            return 0; /* 成功加载 */
-        }
+        IRQ_INC(&df_irq_stats.no_table);
+        return -2;
     }
-    else
+    if (irq_num >= DF_IRQ_NUM_MAX || df_irq_index[irq_num] == DF_IRQ_SLOT_NONE)
     {
-        /* 未注册的中断号，可能是配置错�?*/
+        /* 未注册的中断号，可能是配置错误 */
+        IRQ_INC(&df_irq_stats.unregistered);
         return -2;
     }
+
+    uint8_t slot = df_irq_index[irq_num];
+    df_irq_t *h = df_irq_slot[slot];
+    uint8_t head = h->head;
+    uint8_t used = (uint8_t)(head - IRQ_LOAD(&h->tail));
+
+    if (used >= DF_IRQ_QUEUE_DEPTH)
+    {
+        h->dropped++;
+        IRQ_INC(&df_irq_stats.dropped);
+        return -1; /* 加载失败，数据被丢弃 */
+    }
+
+    h->queue[head & DF_IRQ_QUEUE_MASK] = argv;
+    IRQ_STORE(&h->head, (uint8_t)(head + 1));
+    if (used + 1 > h->high_water)
+    {
+        h->high_water = used + 1;
+    }
+    h->state = DF_IRQ_STATE_PENDING;
+    IRQ_OR(&df_irq_pending, DF_IRQ_BIT(slot));
+    IRQ_INC(&df_irq_stats.loaded);
+    return 0;
 }
 
 /**
- * @brief   中断处理运行�?- 在主循环中调用，执行中断回调函数
+ * @brief   中断处理运行器 - 在主循环中调用，执行中断回调函数
  *
- * @details 此函数应在主循环(main loop)中周期性调用�?
- *          主要功能�?
- *          1. 扫描所有中断句柄，收集待处理的中断
- *          2. 按优先级排序（优先级数值小的先执行�?
- *          3. 执行最高优先级的中断回调函�?
- *          4. 清除中断状态，释放资源
+ * @details 此函数应在主循环(main loop)中周期性调用：
+ *          1. CLZ 取挂起位图中优先级最高的槽位
+ *          2. 从该槽位的事件队列取出一个事件并执行处理线程
+ *          3. 队列为空时清除挂起位
+ *          每执行一个事件都重新查找最高优先级，执行期间到达的高优先级事件会先被处理。
  *
- *          优先级机制：
- *          - 使用优先级作为临时数组的索引
- *          - 优先�?最高，数值越大优先级越低
- *          - 每次调用只执行一个最高优先级的中�?
+ * @param[in,out] ih  中断处理句柄数组，需以irq_num=0xFFFF结尾
  *
- * @param[in,out] ih            中断处理句柄指针数组，需以irq_num=0xFFFF结尾
- * @param[in]     max_priority  最大优先级数量（用于分配临时数组大小）
+ * @return  int 本次执行的事件数
  *
- * @return  int 执行结果
- * @retval  0   成功执行了一个中断回�?
- * @retval  -1  没有待处理的中断或内存分配失�?
+ * @note    单次调用最多执行 DF_IRQ_MAX_NUM * DF_IRQ_QUEUE_DEPTH 个事件，
+ *          中断持续到达时主循环其他任务仍能得到运行
  *
- * @note    此函数每次只处理一个中断，如需处理所有待处理中断�?
- *          应循环调用直到返�?1
- *
- * @par 使用示例�?
+ * @par 使用示例：
  * @code
  *     int main(void) {
- *         // 初始�?..
+ *         df_irq_register(irq_handles);
  *         while (1) {
- *             // 处理所有待处理的中�?
- *             while (irq_handle_runner(irq_handles) == 0) {
- *                 // 继续处理下一�?
- *             }
- *             // 其他主循环任�?..
+ *             df_irq_run(irq_handles);
+ *             // 其他主循环任务...
  *         }
  *     }
  * @endcode
  */
 int df_irq_run(df_irq_t ih[])
 {
-    /* 分配临时数组用于按优先级排序，大小为最大优先级�?*/
-    static df_irq_t ih_temp[DF_IRQ_MAX_NUM];
-    int i = 0, j = 0;
-    /*
-     * 第一阶段：扫描所有句柄，收集PENDING状态的中断
-     * 并按优先级放入临时数�?
-     */
-    for (; ih[i].irq_num != 0xFFFF; i++)
+    int count = 0;
+    uint32_t pending;
+
+    if (IRQ_LOAD(&df_irq_table) != ih && df_irq_register(ih) < 0)
     {
-        if (ih[i].state == DF_IRQ_STATE_PENDING) /* 只处理PENDING状�?*/
-        {
-            /* 以优先级为索引存入临时数组，存入结构体的地址 */
-            ih_temp[ih[i].priority] = ih[i];
-            /* 将状态从PENDING改为READY，表示即将执�?*/
-            ih_temp[ih[i].priority].state = DF_IRQ_STATE_READY;
-        }
-        ih[i].state = DF_IRQ_STATE_DISABLE; /* 清除原句柄状�?*/
+        return 0;
     }
-    /*
-     * 第二阶段：按优先级顺序（�?开始）查找并执�?
-     * 优先�?最高，先执�?
-     */
-    for (; j < DF_IRQ_MAX_NUM; j++)
+
+    while (count < DF_IRQ_MAX_NUM * DF_IRQ_QUEUE_DEPTH &&
+           (pending = IRQ_LOAD(&df_irq_pending)) != 0)
     {
-        /* 检查该优先级是否有待处理的中断 */
-        if (ih_temp[j].state == DF_IRQ_STATE_READY)
+        uint32_t slot = DF_IRQ_CLZ(pending);
+        df_irq_t *h = df_irq_slot[slot];
+        uint8_t tail = h->tail;
+
+        if (tail == IRQ_LOAD(&h->head))
         {
-            /* 执行中断回调函数，传入参�?*/
-            ih_temp[j].handler(ih_temp[j].argv);
-            /* 执行完毕，清除状�?*/
-            ih_temp[j].state = DF_IRQ_STATE_DISABLE;
+            /* 队列已空：先清除挂起位再复查，避免与ISR入队竞争丢失挂起位 */
+            h->state = DF_IRQ_STATE_DISABLE;
+            IRQ_AND(&df_irq_pending, ~DF_IRQ_BIT(slot));
+            if (tail != IRQ_LOAD(&h->head))
+            {
+                h->state = DF_IRQ_STATE_PENDING;
+                IRQ_OR(&df_irq_pending, DF_IRQ_BIT(slot));
+            }
+            continue;
         }
+
+        h->argv = h->queue[tail & DF_IRQ_QUEUE_MASK];
+        IRQ_STORE(&h->tail, (uint8_t)(tail + 1));
+        if (h->handler != NULL)
+        {
+            h->handler(h->argv);
+        }
+        count++;
+    }
+    df_irq_stats.executed += (uint32_t)count;
+    return count;
+}
+
+/**
+ * @brief 获取中断框架统计信息
+ * @param stats 输出
+ */
+void df_irq_get_stats(df_irq_stats_t *stats)
+{
+    if (stats != NULL)
+    {
+        stats->loaded = IRQ_LOAD(&df_irq_stats.loaded);
+        stats->executed = df_irq_stats.executed;
+        stats->dropped = IRQ_LOAD(&df_irq_stats.dropped);
+        stats->unregistered = IRQ_LOAD(&df_irq_stats.unregistered);
+        stats->no_table = IRQ_LOAD(&df_irq_stats.no_table);
     }
-    return -1; /* 没有待处理的中断 */
 }
 
 #include <driver.h>
 #include "misc.h"
-// ============ 自动初始�?============
+// ============ 自动初始化 ============
 /**
- * @brief 中断管理框架自动初始化函�?
- * @details 在框架初始化时自动调用，初始化中断管理框�?
+ * @brief 中断管理框架自动初始化函数
+ * @details 在框架初始化时自动调用，初始化中断管理框架
  * @return 0表示成功
  */
 static int df_irq_auto_init(void)
@@ -252,9 +345,15 @@ static int df_irq_auto_init(void)
     NVIC_SetPriorityGrouping(NVIC_PriorityGroup_4);
     NVIC_SetPriority(SysTick_IRQn, 0); // SysTick最高优先级
     NVIC_EnableIRQ(SysTick_IRQn);
+    df_work_set_cycle_func(get_cycles64); // 工作队列延迟统计（DWT 周期）
+    df_sched_set_cycle_func(get_cycles64); // 任务执行时间统计
+#ifdef LOG_TIMESTAMP_US
+    log_set_timestamp_us_func(df_time_now_us); // 微秒时间戳（与 get_tick() 同源）
+#else
     log_set_timestamp_func(get_tick);
+#endif
     log_enable_timestamp(ENABLE);
-    // 中断框架暂无需特殊初始化，此函数用于日志记�?
+    // 中断框架暂无需特殊初始化，此函数用于日志记录
     LOG_I("IRQ", "Interrupt framework initialized");
     return 0;
 }
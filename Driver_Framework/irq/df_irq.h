@@ -7,25 +7,81 @@
 #include <dev_frame.h>
 
 #define DF_IRQ_END {0xFFFF, 0, NULL, DF_IRQ_STATE_DISABLE, {0}} // 结束标志
-#define DF_IRQ_MAX_NUM 5                                        // 最大中断句柄数量
 #define DF_IRQ_STATE_READY 0x01
 #define DF_IRQ_STATE_PENDING 0x02
 #define DF_IRQ_STATE_DISABLE 0x00
 
+/** @brief 最大中断句柄数量（挂起位图为32位，不能超过32） */
+#ifndef DF_IRQ_MAX_NUM
+#define DF_IRQ_MAX_NUM 8
+#endif
+
+/** @brief 直接索引表覆盖的中断号范围 [0, DF_IRQ_NUM_MAX)，F407 最大中断号为 81 */
+#ifndef DF_IRQ_NUM_MAX
+#define DF_IRQ_NUM_MAX 96
+#endif
+
+/** @brief 每个中断的事件队列深度，必须为2的幂 */
+#ifndef DF_IRQ_QUEUE_DEPTH
+#define DF_IRQ_QUEUE_DEPTH 4
+#endif
+
+#if DF_IRQ_MAX_NUM > 32
+#error "DF_IRQ_MAX_NUM must not exceed 32"
+#endif
+
+#if (DF_IRQ_QUEUE_DEPTH & (DF_IRQ_QUEUE_DEPTH - 1)) != 0 || DF_IRQ_QUEUE_DEPTH > 128
+#error "DF_IRQ_QUEUE_DEPTH must be a power of two no larger than 128"
+#endif
+
 /**
  * @brief 中断句柄结构体
  * @note 中断处理线程统一使用 int (*)(df_arg_t) 类型
+ * @note queue 之后的字段由框架维护，定义句柄数组时不需要初始化
  */
 typedef struct df_irq_struct
 {
     uint16_t irq_num;         // 中断号
-    uint8_t priority;         // 中断优先级
+    uint8_t priority;         // 中断优先级（数值越小越先执行）
     int (*handler)(df_arg_t); // 中断处理线程（统一接口）
-    uint8_t state;            // 中断就绪标志
-    df_arg_t argv;            // 中断处理线程参数
+    uint8_t state;            // 中断状态：有待处理事件时为 PENDING
+    df_arg_t argv;            // 最近一次交给处理线程的参数
+
+    df_arg_t queue[DF_IRQ_QUEUE_DEPTH]; // 事件队列（ISR 写入，df_irq_run 读出）
+    uint8_t head;                       // 队列写位置（仅 ISR 修改）
+    uint8_t tail;                       // 队列读位置（仅 df_irq_run 修改）
+    uint8_t high_water;                 // 队列最大深度
+    uint32_t dropped;                   // 队列满丢弃的事件数
 } df_irq_t;
 
+/**
+ * @brief 中断框架统计信息
+ */
+typedef struct
+{
+    uint32_t loaded;       // 入队的事件数
+    uint32_t executed;     // 已执行的事件数
+    uint32_t dropped;      // 队列满丢弃的事件数（所有中断之和）
+    uint32_t unregistered; // 未注册中断号的加载次数
+    uint32_t no_table;     // 句柄数组未注册时的加载次数
+} df_irq_stats_t;
+
+/**
+ * @brief 注册中断句柄数组，建立按中断号直接索引的表
+ * @param ih 中断句柄数组，以 DF_IRQ_END 结尾
+ * @return 注册的句柄数量，<0 表示句柄过多或中断号超出 DF_IRQ_NUM_MAX
+ * @note 同优先级按数组顺序执行；须在中断使能前注册，未注册时 df_irq_load 丢弃事件，
+ *       首次 df_irq_run 会自动注册（之后到达的事件才会入队）
+ */
+int df_irq_register(df_irq_t ih[]);
+
 int8_t df_irq_find(df_irq_t ih[], uint16_t irq_num);
 int df_irq_load(df_irq_t ih[], uint16_t irq_num, df_arg_t argv);
 int df_irq_run(df_irq_t ih[]);
-#endif /* __DF_IRQ_H__ */
\ No newline at end of file
+
+/**
+ * @brief 获取统计信息
+ * @param stats 输出
+ */
+void df_irq_get_stats(df_irq_stats_t *stats);
+#endif /* __DF_IRQ_H__ */
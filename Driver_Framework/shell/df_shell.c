@@ -6,6 +6,7 @@
 
 #include "df_shell.h"
 #include "df_uart.h"
+#include <driver.h>
 
 #include <stdarg.h>
 #include <stdint.h>
@@ -19,6 +20,11 @@
 /** @brief Shell 使用的 UART 设备指针 */
 static df_uart_t *shell_uart = NULL;
 
+#if DF_SHELL_BATCH
+static void shell_batch_append(const char *data, size_t len);
+static bool shell_batch_capture = false; // 批处理执行中：输出写入结果帧
+#endif
+
 /**
  * @brief 设置 Shell 使用的 UART 设备
  * @param uart UART 设备指针
@@ -29,52 +35,88 @@ void shell_set_uart(df_uart_t *uart)
 }
 
 /**
- * @brief Shell 输出字符串
- * @param str 要输出的字符串
+ * @brief Shell 按长度输出
+ * @param data 数据指针，不要求NUL结尾
+ * @param len 数据长度
+ * @note UART 未提供 write 接口时回退到字符串接口
  */
-static void shell_puts(const char *str)
+static void shell_write(const char *data, size_t len)
 {
-    if (shell_uart != NULL && shell_uart->send != NULL)
+#if DF_SHELL_BATCH
+    if (shell_batch_capture)
     {
-        shell_uart->send(arg_ptr((void *)str));
+        shell_batch_append(data, len);
+        return;
+    }
+#endif
+    if (shell_uart != NULL && shell_uart->write != NULL)
+    {
+        shell_uart->write(data, len);
+    }
+    else if (shell_uart != NULL && shell_uart->send != NULL)
+    {
+        char buf[65];
+        while (len > 0)
+        {
+            size_t n = (len < sizeof(buf) - 1) ? len : sizeof(buf) - 1;
+            memcpy(buf, data, n);
+            buf[n] = '\0';
+            shell_uart->send(arg_ptr(buf));
+            data += n;
+            len -= n;
+        }
     }
     else
     {
         /* 回退到标准输出 */
-        printf("%s", str);
+        fwrite(data, 1, len, stdout);
         fflush(stdout);
     }
 }
 
+/**
+ * @brief Shell 输出字符串
+ * @param str 要输出的字符串
+ */
+static void shell_puts(const char *str)
+{
+    if (shell_uart != NULL && shell_uart->write == NULL && shell_uart->send != NULL)
+    {
+        /* 只有字符串接口时直接发送，避免分段拷贝 */
+        shell_uart->send(arg_ptr((void *)str));
+        return;
+    }
+    shell_write(str, strlen(str));
+}
+
 /**
  * @brief Shell 输出单个字符
  * @param ch 要输出的字符
  */
 static void shell_putchar(char ch)
 {
-    char buf[2] = {ch, '\0'};
-    shell_puts(buf);
+    shell_write(&ch, 1);
 }
 
-/**
- * @brief Shell 格式化输出
- * @param fmt 格式字符串
- * @param ... 可变参数
- */
-static void shell_printf(const char *fmt, ...)
+void shell_printf(const char *fmt, ...)
 {
     static char shell_print_buf[256];
     va_list args;
     va_start(args, fmt);
-    vsnprintf(shell_print_buf, sizeof(shell_print_buf), fmt, args);
+    int len = vsnprintf(shell_print_buf, sizeof(shell_print_buf), fmt, args);
     va_end(args);
-    shell_puts(shell_print_buf);
+    if (len > 0)
+    {
+        shell_write(shell_print_buf, ((size_t)len < sizeof(shell_print_buf)) ? (size_t)len : sizeof(shell_print_buf) - 1);
+    }
 }
 
 /*===========================================================================*/
 /*                         Shell 初始化                                       */
 /*===========================================================================*/
 
+static void shell_hash_build(EnvVar *env);
+
 void MCU_Shell_Init(shell *sh, DeviceFamily *log)
 {
     sh->Shell_Init = true;                 // 设置Shell初始化标志为true
@@ -83,6 +125,11 @@ void MCU_Shell_Init(shell *sh, DeviceFamily *log)
     sh->UART_NOTE = 0;                     // 初始化串口节点
     sh->RunStae = 0;                       // 初始化运行状态
     memset(sh->Data, 0, sizeof(sh->Data)); // 清空数据缓冲区
+    sh->Cursor = 0;                        // 光标回到行首
+    sh->Esc = 0;                           // 清除转义序列状态
+    sh->HistPos = 0;                       // 退出历史浏览
+    sh->BatchState = 0;                    // 批处理帧接收空闲
+    shell_hash_build(NULL);                // 建立命令哈希表，env_vars 在首次处理命令时加入
 
     shell_printf("SHELL_VERSION: %d.%d.%d\n", SHELL_VERSION_MAIN, SHELL_VERSION_RE,
                  SHELL_VERSION_UPDATE); // 显示版本信息
@@ -165,150 +212,644 @@ void MCU_Shell_Init(shell *sh, DeviceFamily *log)
     shell_printf(FG_GREEN "%s" RESET_ALL "@%s> ", log->User, log->Device);
 }
 
+/*===========================================================================*/
+/*                         接收队列与行编辑                                   */
+/*===========================================================================*/
+
+// 原子操作封装（GCC 内建，目标板与主机通用）
+#define SHELL_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define SHELL_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+// 转义序列解析状态
+#define SHELL_ESC_NONE 0 // 普通字符
+#define SHELL_ESC_START 1 // 收到 ESC
+#define SHELL_ESC_CSI 2   // 收到 ESC [
+#define SHELL_ESC_TILDE 3 // 收到 ESC [ 3，等待 ~（Delete）
+
+bool shell_rx_push(shell *sh, uint8_t c)
+{
+    uint16_t head = sh->RxHead;
+    uint16_t tail = SHELL_LOAD(&sh->RxTail);
+
+    if ((uint16_t)(head - tail) >= DF_SHELL_RX_SIZE)
+    {
+        sh->RxDropped++;
+        return false;
+    }
+    sh->Rx[head & (DF_SHELL_RX_SIZE - 1)] = c;
+    SHELL_STORE(&sh->RxHead, (uint16_t)(head + 1));
+    return true;
+}
+
+void shell_task(Sysfpoint *sfp, shell *sh, EnvVar *env, DeviceFamily *log)
+{
+    uint16_t tail = sh->RxTail;
+
+    while (tail != SHELL_LOAD(&sh->RxHead))
+    {
+        uint8_t c = sh->Rx[tail & (DF_SHELL_RX_SIZE - 1)];
+        tail++;
+        SHELL_STORE(&sh->RxTail, tail); // 先释放槽位，命令执行期间中断可继续接收
+        if (sh->Shell_Init)
+        {
+            BIE_UART(c, sfp, sh, env, log);
+        }
+        // 一行刚设置了延迟命令时立即执行：同一次轮询中的下一条命令会覆盖 sfp，
+        // 后续字节也会改写参数所指的 sh->Data
+        Task_Switch_Tick_Handler(sfp);
+    }
+}
+
+/**
+ * @brief 光标左移 n 列（退格不擦除字符）
+ */
+static void shell_cursor_left(uint16_t n)
+{
+    while (n-- > 0)
+    {
+        shell_putchar('\b');
+    }
+}
+
+/**
+ * @brief 用新内容替换整行（历史浏览）
+ * @param sh Shell 结构体
+ * @param line 新内容
+ */
+static void shell_line_replace(shell *sh, const char *line)
+{
+    uint16_t old_len = sh->Res_len;
+    uint16_t len = (uint16_t)strlen(line);
+
+    shell_cursor_left(sh->Cursor);
+    memcpy(sh->Data, line, len);
+    sh->Res_len = len;
+    sh->Cursor = len;
+    shell_write((const char *)sh->Data, len);
+    if (old_len > len)
+    {
+        // 擦除旧内容多出的部分
+        for (uint16_t i = len; i < old_len; i++)
+        {
+            shell_putchar(' ');
+        }
+        shell_cursor_left(old_len - len);
+    }
+}
+
+/**
+ * @brief 保存一条历史命令（与最近一条相同时不重复保存）
+ */
+static void shell_history_add(shell *sh)
+{
+    if (sh->Res_len == 0)
+    {
+        return;
+    }
+    if (sh->HistCount > 0)
+    {
+        uint8_t last = (sh->HistHead + DF_SHELL_HISTORY_NUM - 1) % DF_SHELL_HISTORY_NUM;
+        if (strcmp(sh->History[last], (const char *)sh->Data) == 0)
+        {
+            return;
+        }
+    }
+    memcpy(sh->History[sh->HistHead], sh->Data, sh->Res_len + 1u);
+    sh->HistHead = (sh->HistHead + 1) % DF_SHELL_HISTORY_NUM;
+    if (sh->HistCount < DF_SHELL_HISTORY_NUM)
+    {
+        sh->HistCount++;
+    }
+}
+
+/**
+ * @brief 浏览历史命令
+ * @param older true=上一条（更早），false=下一条
+ */
+static void shell_history_step(shell *sh, bool older)
+{
+    if (older && sh->HistPos < sh->HistCount)
+    {
+        sh->HistPos++;
+    }
+    else if (!older && sh->HistPos > 0)
+    {
+        sh->HistPos--;
+    }
+    else
+    {
+        return;
+    }
+
+    if (sh->HistPos == 0)
+    {
+        shell_line_replace(sh, "");
+        return;
+    }
+    uint8_t idx = (sh->HistHead + DF_SHELL_HISTORY_NUM - sh->HistPos) % DF_SHELL_HISTORY_NUM;
+    shell_line_replace(sh, sh->History[idx]);
+}
+
+/**
+ * @brief 删除光标处字符并重绘光标之后的内容
+ */
+static void shell_delete_at_cursor(shell *sh)
+{
+    uint16_t tail = sh->Res_len - sh->Cursor - 1;
+
+    memmove(&sh->Data[sh->Cursor], &sh->Data[sh->Cursor + 1], tail);
+    sh->Res_len--;
+    shell_write((const char *)&sh->Data[sh->Cursor], tail);
+    shell_putchar(' ');
+    shell_cursor_left(tail + 1);
+}
+
+/**
+ * @brief 处理 ESC [ 之后的控制字符
+ */
+static void shell_handle_csi(shell *sh, uint8_t c)
+{
+    sh->Esc = SHELL_ESC_NONE;
+    switch (c)
+    {
+    case 'A': // 上：更早的历史
+        shell_history_step(sh, true);
+        break;
+    case 'B': // 下：更新的历史
+        shell_history_step(sh, false);
+        break;
+    case 'C': // 右
+        if (sh->Cursor < sh->Res_len)
+        {
+            shell_putchar((char)sh->Data[sh->Cursor++]);
+        }
+        break;
+    case 'D': // 左
+        if (sh->Cursor > 0)
+        {
+            sh->Cursor--;
+            shell_putchar('\b');
+        }
+        break;
+    case 'H': // Home
+        shell_cursor_left(sh->Cursor);
+        sh->Cursor = 0;
+        break;
+    case 'F': // End
+        shell_write((const char *)&sh->Data[sh->Cursor], sh->Res_len - sh->Cursor);
+        sh->Cursor = sh->Res_len;
+        break;
+    case '3': // Delete: ESC [ 3 ~
+        sh->Esc = SHELL_ESC_TILDE;
+        break;
+    default:
+        break;
+    }
+}
+
+#if DF_SHELL_BATCH
+// 批处理帧接收状态
+#define SHELL_BATCH_IDLE 0
+#define SHELL_BATCH_LEN_L 1
+#define SHELL_BATCH_LEN_H 2
+#define SHELL_BATCH_DATA 3
+#define SHELL_BATCH_CRC_L 4
+#define SHELL_BATCH_CRC_H 5
+
+static void shell_batch_feed(Sysfpoint *sfp, shell *sh, EnvVar *env, uint8_t c);
+
+/**
+ * @brief 距上一个帧字节是否超时（计数模式下没有节拍，不超时）
+ */
+static bool shell_batch_expired(const shell *sh, uint32_t now)
+{
+    return DF_SHELL_BATCH_TIMEOUT > 0 && Systick_GetMode() == SYSTICK_MODE_INTERRUPT &&
+           (uint32_t)(now - sh->BatchTick) > DF_SHELL_BATCH_TIMEOUT;
+}
+#endif
+
 /**
- * @brief 串口中断处理函数：检测数据格式，接收数据
+ * @brief 输入字符处理：回显、行编辑、历史，回车时执行命令
  * @param Parameters 接收到的字符
  * @param sfp 系统函数指针
  * @param sh Shell结构体
  * @param env 环境变量
  * @param log 设备信息
+ * @note 支持 ←/→/Home/End/Delete/退格编辑，↑/↓ 浏览历史，Ctrl-A/Ctrl-E 行首/行尾
  */
 void BIE_UART(uint8_t Parameters, Sysfpoint *sfp, shell *sh, EnvVar *env,
               DeviceFamily *log)
 {
-    shell_puts(RESET_ALL);
     sh->c = Parameters;
 
+#if DF_SHELL_BATCH
+    // 批处理帧：字节间隔超时则丢弃未收完的帧，本字节按新输入处理
+    uint32_t now = get_tick();
+    if (sh->BatchState != SHELL_BATCH_IDLE && shell_batch_expired(sh, now))
+    {
+        sh->BatchState = SHELL_BATCH_IDLE;
+    }
+    if (sh->BatchState != SHELL_BATCH_IDLE)
+    {
+        sh->BatchTick = now;
+        shell_batch_feed(sfp, sh, env, sh->c);
+        return;
+    }
+    if (sh->c == DF_SHELL_BATCH_SOF)
+    {
+        sh->BatchState = SHELL_BATCH_LEN_L;
+        sh->BatchCrc = 0xFFFF;
+        sh->BatchTick = now;
+        return;
+    }
+#endif
+
+    // 转义序列
+    if (sh->Esc == SHELL_ESC_START)
+    {
+        sh->Esc = (sh->c == '[' || sh->c == 'O') ? SHELL_ESC_CSI : SHELL_ESC_NONE;
+        return;
+    }
+    if (sh->Esc == SHELL_ESC_CSI)
+    {
+        shell_handle_csi(sh, sh->c);
+        return;
+    }
+    if (sh->Esc == SHELL_ESC_TILDE)
+    {
+        sh->Esc = SHELL_ESC_NONE;
+        if (sh->c == '~' && sh->Cursor < sh->Res_len)
+        {
+            shell_delete_at_cursor(sh);
+        }
+        return;
+    }
+    if (sh->c == 0x1B)
+    {
+        sh->Esc = SHELL_ESC_START;
+        return;
+    }
+
+    shell_puts(RESET_ALL);
+
     // 如果是回车键
     if (sh->c == '\r' || sh->c == '\n')
     {
         sh->Data[sh->Res_len] = '\0'; // 添加字符串结束符
         shell_puts("\n");
+        shell_history_add(sh);    // 在分割参数前保存历史
         Shell_Deal(sfp, sh, env); // 解析并执行命令
         sh->Res_len = 0;          // 重置输入长度
+        sh->Cursor = 0;
+        sh->HistPos = 0;
         shell_printf(FG_GREEN "%s" RESET_ALL "@%s> ", log->User, log->Device);
     }
     // 如果是退格键
     else if (sh->c == '\b' || sh->c == 127)
     {
-        if (sh->Res_len > 0)
+        if (sh->Cursor > 0)
         {
-            sh->Res_len--;       // 删除最后一个字符
-            shell_puts("\b \b"); // 在终端上删除字符
+            sh->Cursor--;
+            shell_putchar('\b');
+            shell_delete_at_cursor(sh); // 光标在行尾时输出 "\b \b"
         }
     }
-    // 其他字符
-    else
+    else if (sh->c == 0x01) // Ctrl-A
     {
-        if (sh->Res_len < 19)
+        shell_handle_csi(sh, 'H');
+    }
+    else if (sh->c == 0x05) // Ctrl-E
+    {
+        shell_handle_csi(sh, 'F');
+    }
+    // 其他字符：在光标处插入
+    else if (sh->c >= 0x20)
+    {
+        if (sh->Res_len < DF_SHELL_LINE_MAX - 1)
         {
-            sh->Data[sh->Res_len++] = sh->c; // 保存字符
-            shell_putchar(sh->c);            // 实时显示字符
+            uint16_t tail = sh->Res_len - sh->Cursor;
+            memmove(&sh->Data[sh->Cursor + 1], &sh->Data[sh->Cursor], tail);
+            sh->Data[sh->Cursor] = sh->c;
+            sh->Res_len++;
+            shell_write((const char *)&sh->Data[sh->Cursor], tail + 1u); // 实时显示字符
+            sh->Cursor++;
+            shell_cursor_left(tail);
         }
     }
 }
 
-// 待添加的命令
-char *syscmd[20] = {
-    "hello", "reset", "poweroff", "help", "exit", "clear", "test", "ls",
-    NULL // 命令列表结束标志
-};
+/*===========================================================================*/
+/*                         命令段与哈希表                                     */
+/*===========================================================================*/
 
-Cmd_PointerTypeDef Cmd;
+// ============ 链接器段符号声明 ============
+#if defined(__ARMCC_VERSION) /* Keil MDK */
+extern const int DF_ShellCmdSection$$Base;
+extern const int DF_ShellCmdSection$$Limit;
+#define SHELL_CMD_BEGIN ((const df_shell_cmd_t *)&DF_ShellCmdSection$$Base)
+#define SHELL_CMD_END ((const df_shell_cmd_t *)&DF_ShellCmdSection$$Limit)
+#elif defined(__ICCARM__) /* IAR */
+#pragma section = ".df_shell_cmd"
+#define SHELL_CMD_BEGIN ((const df_shell_cmd_t *)__section_begin(".df_shell_cmd"))
+#define SHELL_CMD_END ((const df_shell_cmd_t *)__section_end(".df_shell_cmd"))
+#elif defined(__GNUC__) /* GCC */
+extern const df_shell_cmd_t __df_shell_cmd_start[];
+extern const df_shell_cmd_t __df_shell_cmd_end[];
+#define SHELL_CMD_BEGIN (__df_shell_cmd_start)
+#define SHELL_CMD_END (__df_shell_cmd_end)
+#endif
 
-extern void Sys_cmd_Init(); // 系统命令初始化函数声明
+#define SHELL_HASH_SIZE (1u << DF_SHELL_HASH_BITS)
+#define SHELL_HASH_MASK (SHELL_HASH_SIZE - 1u)
+#define SHELL_HASH_EMPTY 0xFFFFu // 空槽位
+#define SHELL_HASH_ENV 0x8000u   // 槽位值最高位：1=env_vars 下标，0=命令段下标
+
+/** @brief 哈希表：槽位保存命令段或 env_vars 的下标 */
+static uint16_t shell_hash_table[SHELL_HASH_SIZE];
+static uint32_t shell_hash_seed;      // 建表选中的种子
+static uint32_t shell_hash_probe_max; // 最大探测距离，0 表示完美哈希
+static bool shell_hash_ready = false; // 哈希表已建立
+static bool shell_hash_overflow;      // 条目多于槽位，未入表的条目需要线性查找
+static EnvVar *shell_hash_env = NULL; // 建表时使用的环境变量数组
+
+/** @brief 当前执行命令的 Shell，供 exit 等需要修改 Shell 状态的命令使用 */
+static shell *shell_active = NULL;
+
+/**
+ * @brief 带种子的 FNV-1a 字符串哈希
+ * @param name 命令名称
+ * @param seed 哈希种子
+ * @return 槽位下标
+ */
+static uint32_t shell_hash(const char *name, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    while (*name != '\0')
+    {
+        h ^= (uint8_t)*name++;
+        h *= 16777619u;
+    }
+    return (h ^ (h >> 16)) & SHELL_HASH_MASK;
+}
 
 /**
- * @brief 系统默认处理命令
- * @param cmd 待处理的命令
- * @return 0: 成功，-1: 失败
+ * @brief 取槽位值对应的名称
  */
-int8_t Cmd_match(shell *sh, char *cmd, int argc, void **argv)
+static const char *shell_hash_name(uint16_t value)
 {
-    // 处理命令
-    if (strcmp(cmd, "hello") == 0)
+    if (value & SHELL_HASH_ENV)
     {
-        shell_printf("Hello, World!\n");
+        return shell_hash_env[value & ~SHELL_HASH_ENV].name;
     }
-    else if (strcmp(cmd, "reset") == 0)
+    return SHELL_CMD_BEGIN[value].name;
+}
+
+/**
+ * @brief 插入一个条目（线性探测）
+ * @param value 槽位值
+ * @param name 条目名称
+ * @param seed 哈希种子
+ * @return 探测距离；同名条目已存在时返回0且不插入（先注册者优先）；表满返回-1
+ */
+static int shell_hash_insert(uint16_t value, const char *name, uint32_t seed)
+{
+    uint32_t idx = shell_hash(name, seed);
+
+    for (uint32_t probe = 0; probe < SHELL_HASH_SIZE; probe++)
     {
-        shell_printf("Rebooting...\n");
-        if (Cmd.reset != NULL)
+        uint16_t *slot = &shell_hash_table[(idx + probe) & SHELL_HASH_MASK];
+        if (*slot == SHELL_HASH_EMPTY)
         {
-            Cmd.reset(0, NULL);
+            *slot = value;
+            return (int)probe;
         }
-        else
+        if (strcmp(shell_hash_name(*slot), name) == 0)
         {
-            shell_printf(FG_RED "reset command not implemented. Cause is a NULL point\n" RESET_ALL);
+            return 0;
         }
     }
-    else if (strcmp(cmd, "poweroff") == 0)
+    return -1;
+}
+
+/**
+ * @brief 以指定种子填充哈希表
+ * @return 最大探测距离
+ */
+static uint32_t shell_hash_fill(uint32_t seed)
+{
+    uint32_t probe_max = 0;
+    uint16_t i = 0;
+    int probe;
+
+    memset(shell_hash_table, 0xFF, sizeof(shell_hash_table));
+    shell_hash_overflow = false;
+
+    // 命令段优先于环境变量，与原先的匹配顺序一致
+    for (const df_shell_cmd_t *cmd = SHELL_CMD_BEGIN; cmd < SHELL_CMD_END; cmd++, i++)
     {
-        shell_printf("Powering off...\n");
-        if (Cmd.poweroff != NULL)
+        probe = shell_hash_insert(i, cmd->name, seed);
+        if (probe < 0)
         {
-            Cmd.poweroff(0, NULL);
+            shell_hash_overflow = true;
         }
-        else
+        else if ((uint32_t)probe > probe_max)
         {
-            shell_printf(FG_RED "poweroff command not implemented. Cause is a NULL point\n" RESET_ALL);
+            probe_max = (uint32_t)probe;
         }
     }
-    else if (strcmp(cmd, "help") == 0)
+    for (i = 0; shell_hash_env != NULL && shell_hash_env[i].name != NULL; i++)
     {
-        shell_printf("Available commands:\n");
-        for (int i = 0; syscmd[i] != NULL; i++)
+        probe = shell_hash_insert(i | SHELL_HASH_ENV, shell_hash_env[i].name, seed);
+        if (probe < 0)
         {
-            shell_printf("- %s\n", syscmd[i]);
+            shell_hash_overflow = true;
         }
-    }
-    else if (strcmp(cmd, "ls") == 0)
-    {
-        if (Cmd.ls != NULL)
+        else if ((uint32_t)probe > probe_max)
         {
-            Cmd.ls(argc, argv);
+            probe_max = (uint32_t)probe;
         }
-        else
+    }
+    return probe_max;
+}
+
+/**
+ * @brief 建立命令哈希表
+ * @param env 环境变量数组，可为 NULL
+ * @details 依次尝试种子，找到无冲突的种子即得到完美哈希（每次查找只访问一个槽位）；
+ *          全部失败时使用种子0加线性探测，查找最多访问 probe_max+1 个槽位
+ */
+static void shell_hash_build(EnvVar *env)
+{
+    uint32_t seed;
+
+    shell_hash_env = env;
+    for (seed = 0; seed < DF_SHELL_HASH_SEED_TRIES; seed++)
+    {
+        shell_hash_probe_max = shell_hash_fill(seed);
+        if (shell_hash_probe_max == 0 && !shell_hash_overflow)
         {
-            shell_printf(FG_RED "ls command not implemented. Cause is a NULL point\n" RESET_ALL);
+            break;
         }
     }
-    else if (strcmp(cmd, "clear") == 0)
+    if (seed == DF_SHELL_HASH_SEED_TRIES)
+    {
+        seed = 0;
+        shell_hash_probe_max = shell_hash_fill(seed);
+    }
+    shell_hash_seed = seed;
+    shell_hash_ready = true;
+
+    if (shell_hash_overflow)
     {
-        shell_printf("Clearing screen...\n");
-        if (Cmd.clear != NULL)
+        LOGW("Shell hash table full, increase DF_SHELL_HASH_BITS\n");
+    }
+}
+
+/**
+ * @brief 查找命令或环境变量
+ * @param name 名称
+ * @return 槽位值，未找到返回 SHELL_HASH_EMPTY
+ */
+static uint16_t shell_hash_lookup(const char *name)
+{
+    uint32_t idx = shell_hash(name, shell_hash_seed);
+    uint16_t i;
+
+    for (uint32_t probe = 0; probe <= shell_hash_probe_max; probe++)
+    {
+        uint16_t value = shell_hash_table[(idx + probe) & SHELL_HASH_MASK];
+        if (value == SHELL_HASH_EMPTY)
         {
-            Cmd.clear(0, NULL);
+            break;
         }
-        else
+        if (strcmp(shell_hash_name(value), name) == 0)
         {
-            shell_printf(FG_RED "clear command not implemented. Cause is a NULL point\n" RESET_ALL);
+            return value;
         }
     }
-    else if (strcmp(cmd, "exit") == 0)
-    {
-        shell_printf("Exiting...\n");
-        sh->RunStae = 1;
-        shell_puts(CLEAR_SCREEN);
-    }
-    else if (strcmp(cmd, "test") == 0)
+
+    if (shell_hash_overflow)
     {
-        if (Cmd.test != NULL)
+        // 表已满：未入表的条目回退线性查找
+        i = 0;
+        for (const df_shell_cmd_t *cmd = SHELL_CMD_BEGIN; cmd < SHELL_CMD_END; cmd++, i++)
         {
-            Cmd.test(argc, argv);
+            if (strcmp(cmd->name, name) == 0)
+            {
+                return i;
+            }
         }
-        else
+        for (i = 0; shell_hash_env != NULL && shell_hash_env[i].name != NULL; i++)
         {
-            shell_printf(FG_RED "test command not implemented. Cause is a NULL point\n" RESET_ALL);
+            if (strcmp(shell_hash_env[i].name, name) == 0)
+            {
+                return i | SHELL_HASH_ENV;
+            }
         }
     }
+    return SHELL_HASH_EMPTY;
+}
+
+const df_shell_cmd_t *shell_cmd_find(const char *name)
+{
+    if (!shell_hash_ready)
+    {
+        shell_hash_build(shell_hash_env);
+    }
+    uint16_t value = shell_hash_lookup(name);
+    if (value == SHELL_HASH_EMPTY || (value & SHELL_HASH_ENV))
+    {
+        return NULL;
+    }
+    return &SHELL_CMD_BEGIN[value];
+}
+
+/*===========================================================================*/
+/*                         内置命令                                           */
+/*===========================================================================*/
+
+Cmd_PointerTypeDef Cmd;
+
+/**
+ * @brief 调用用户在 Cmd 中设置的回调，未设置时提示
+ */
+static void shell_cmd_call(void (*fn)(int, void *[]), const char *name, int argc, void *argv[])
+{
+    if (fn != NULL)
+    {
+        fn(argc, argv);
+    }
     else
     {
-        return -1; // 命令未找到
+        shell_printf(FG_RED "%s command not implemented. Cause is a NULL point\n" RESET_ALL, name);
+    }
+}
+
+static void shell_cmd_hello(int argc, void *argv[])
+{
+    shell_printf("Hello, World!\n");
+}
+
+static void shell_cmd_reset(int argc, void *argv[])
+{
+    shell_printf("Rebooting...\n");
+    shell_cmd_call(Cmd.reset, "reset", 0, NULL);
+}
+
+static void shell_cmd_poweroff(int argc, void *argv[])
+{
+    shell_printf("Powering off...\n");
+    shell_cmd_call(Cmd.poweroff, "poweroff", 0, NULL);
+}
+
+static void shell_cmd_help(int argc, void *argv[])
+{
+    shell_printf("Available commands:\n");
+    for (const df_shell_cmd_t *cmd = SHELL_CMD_BEGIN; cmd < SHELL_CMD_END; cmd++)
+    {
+        shell_printf("- %-10s %s\n", cmd->name, (cmd->help != NULL) ? cmd->help : "");
+    }
+    for (int i = 0; shell_hash_env != NULL && shell_hash_env[i].name != NULL; i++)
+    {
+        shell_printf("- %s\n", shell_hash_env[i].name);
+    }
+}
+
+static void shell_cmd_exit(int argc, void *argv[])
+{
+    shell_printf("Exiting...\n");
+    if (shell_active != NULL)
+    {
+        shell_active->RunStae = 1;
     }
-    return 0; // 命令处理成功
+    shell_puts(CLEAR_SCREEN);
 }
 
+static void shell_cmd_clear(int argc, void *argv[])
+{
+    shell_printf("Clearing screen...\n");
+    shell_cmd_call(Cmd.clear, "clear", 0, NULL);
+}
+
+static void shell_cmd_test(int argc, void *argv[])
+{
+    shell_cmd_call(Cmd.test, "test", argc, argv);
+}
+
+static void shell_cmd_ls(int argc, void *argv[])
+{
+    shell_cmd_call(Cmd.ls, "ls", argc, argv);
+}
+
+DF_SHELL_CMD(hello, shell_cmd_hello, "print greeting");
+DF_SHELL_CMD(reset, shell_cmd_reset, "reboot the MCU");
+DF_SHELL_CMD(poweroff, shell_cmd_poweroff, "power off");
+DF_SHELL_CMD(help, shell_cmd_help, "list commands");
+DF_SHELL_CMD(exit, shell_cmd_exit, "exit shell");
+DF_SHELL_CMD(clear, shell_cmd_clear, "clear screen");
+DF_SHELL_CMD(test, shell_cmd_test, "run test hook");
+DF_SHELL_CMD(ls, shell_cmd_ls, "list devices");
+
 #define MAX_ARGS 20    // 最大参数数量
 #define MAX_ARG_LEN 50 // 每个参数的最大长度
 
@@ -316,8 +857,7 @@ int8_t Cmd_match(shell *sh, char *cmd, int argc, void **argv)
 /// @param userEnv: 用户环境变量数组
 void Task_Switch(Sysfpoint *sfp, EnvVar *userEnv)
 {
-    // 假如环境变量过长可采取其他的查找算法:如二分查找等
-    // 这里采用线性查找
+    // 由 Shell_Deal 传入哈希命中的条目，第一项即待执行项
     int i;
     for (i = 0; userEnv[i].name != NULL; i++)
     {
@@ -348,19 +888,18 @@ void Task_Switch_Tick_Handler(Sysfpoint *sfp)
     }
 }
 
-/// @brief 处理串口发送的指令
-/// @param env_vars 环境变量列表
-/// @param sh Shell协议结构体
-/// @return 字符串指针
-void Shell_Deal(Sysfpoint *sfp, shell *sh, EnvVar *env_vars)
+/**
+ * @brief 分割参数并执行一行命令
+ * @param sfp 系统函数指针
+ * @param sh Shell协议结构体
+ * @param env_vars 环境变量列表
+ * @param input 命令行（会被 strtok 修改）
+ * @param batch true=批处理：不输出提示信息，环境变量命令立即执行
+ * @return DF_SHELL_CMD_OK 或 DF_SHELL_CMD_NOT_FOUND
+ */
+static uint8_t shell_exec(Sysfpoint *sfp, shell *sh, EnvVar *env_vars, char *input, bool batch)
 {
-    if (sh->Shell_Init == false)
-    {
-        error("Shell not initialized.\n");
-        return; // 如果Shell未初始化，直接返回
-    }
-    char *input = (char *)(sh->Data);
-    char *args[MAX_ARGS];
+    static char *args[MAX_ARGS]; // 静态保存：env_vars 命令在主循环中延迟执行时仍需访问参数
     int arg_count = 0;
 
     // 使用 strtok 分割输入字符串
@@ -374,45 +913,252 @@ void Shell_Deal(Sysfpoint *sfp, shell *sh, EnvVar *env_vars)
 
     if (arg_count == 0)
     {
-        return;
+        return DF_SHELL_CMD_OK;
     }
 
     char *cmd_part = args[0];                                   // 提取命令部分
     void *arg_part = (arg_count > 1) ? (void *)&args[1] : NULL; // 提取参数部分
 
-    // 遍历命令列表，匹配命令
-    for (int i = 0; i < 20; i++)
+    // 环境变量数组变化时重建哈希表
+    if (!shell_hash_ready || shell_hash_env != env_vars)
     {
-        if (syscmd[i] == NULL)
-            break;
-        if (strcmp(cmd_part, syscmd[i]) == 0)
+        shell_hash_build(env_vars);
+    }
+
+    uint16_t value = shell_hash_lookup(cmd_part);
+    if (value == SHELL_HASH_EMPTY)
+    {
+        // 未匹配到命令
+        if (!batch)
+        {
+            shell_printf(FG_RED "Command not found: %s\n" RESET_ALL, cmd_part);
+        }
+        return DF_SHELL_CMD_NOT_FOUND;
+    }
+
+    if ((value & SHELL_HASH_ENV) == 0)
+    {
+        // 段注册的命令：直接执行
+        const df_shell_cmd_t *cmd = &SHELL_CMD_BEGIN[value];
+        if (!batch)
+        {
+            shell_printf("Executing command: %s\n", cmd->name);
+        }
+        if (cmd->fn != NULL)
         {
-            shell_printf("Executing command: %s\n", syscmd[i]);
-            if (Cmd_match(sh, syscmd[i], arg_count, arg_part) < 0)
+            shell_active = sh;
+            cmd->fn(arg_count, arg_part);
+        }
+        return DF_SHELL_CMD_OK;
+    }
+
+    EnvVar *env = &env_vars[value & ~SHELL_HASH_ENV];
+    if (batch)
+    {
+        // 批处理需要收集输出，立即执行
+        if (env->callback != NULL)
+        {
+            env->callback(arg_count, arg_part);
+        }
+        return DF_SHELL_CMD_OK;
+    }
+
+    // 环境变量命令：交由主循环执行
+    shell_printf("Executing environment variable command: %s\n", env->name);
+    env->RunStae = 1;
+    env->arg = arg_part;
+    env->argc = arg_count;
+    Task_Switch(sfp, env);
+    return DF_SHELL_CMD_OK;
+}
+
+/// @brief 处理串口发送的指令
+/// @param env_vars 环境变量列表
+/// @param sh Shell协议结构体
+/// @return 字符串指针
+void Shell_Deal(Sysfpoint *sfp, shell *sh, EnvVar *env_vars)
+{
+    if (sh->Shell_Init == false)
+    {
+        error("Shell not initialized.\n");
+        return; // 如果Shell未初始化，直接返回
+    }
+    shell_exec(sfp, sh, env_vars, (char *)(sh->Data), false);
+}
+
+#if DF_SHELL_BATCH
+/*===========================================================================*/
+/*                         批处理模式                                         */
+/*===========================================================================*/
+
+static uint8_t shell_batch_in[DF_SHELL_BATCH_MAX + 1]; // 命令文本（+1 结束符）
+static uint8_t shell_batch_out[DF_SHELL_BATCH_OUT_MAX]; // 结果帧负载
+static uint16_t shell_batch_out_len;                    // 结果帧负载已用长度
+static uint16_t shell_batch_rec;                        // 当前命令记录的输出起始位置
+static bool shell_batch_trunc;                          // 当前命令输出被截断
+
+/**
+ * @brief CRC16-CCITT（多项式0x1021），半字节查表
+ * @param crc 初值或上一次的结果
+ * @param data 数据
+ * @param len 长度
+ * @return 新的 CRC
+ */
+static uint16_t shell_crc16(uint16_t crc, const uint8_t *data, size_t len)
+{
+    static const uint16_t table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+
+    while (len-- > 0)
+    {
+        crc = (uint16_t)((crc << 4) ^ table[((crc >> 12) ^ (*data >> 4)) & 0x0F]);
+        crc = (uint16_t)((crc << 4) ^ table[((crc >> 12) ^ *data) & 0x0F]);
+        data++;
+    }
+    return crc;
+}
+
+/**
+ * @brief 命令输出写入当前记录，单条最多255字节
+ */
+static void shell_batch_append(const char *data, size_t len)
+{
+    size_t room = sizeof(shell_batch_out) - shell_batch_out_len;
+    size_t rec_room = 255u - (size_t)(shell_batch_out_len - shell_batch_rec);
+
+    if (room > rec_room)
+    {
+        room = rec_room;
+    }
+    if (len > room)
+    {
+        len = room;
+        shell_batch_trunc = true;
+    }
+    memcpy(&shell_batch_out[shell_batch_out_len], data, len);
+    shell_batch_out_len += (uint16_t)len;
+}
+
+/**
+ * @brief 发送结果帧
+ */
+static void shell_batch_send(const uint8_t *payload, uint16_t len)
+{
+    uint8_t head[3] = {DF_SHELL_BATCH_SOF, (uint8_t)len, (uint8_t)(len >> 8)};
+    uint16_t crc = shell_crc16(shell_crc16(0xFFFF, &head[1], 2), payload, len);
+    uint8_t tail[2] = {(uint8_t)crc, (uint8_t)(crc >> 8)};
+
+    shell_write((const char *)head, sizeof(head));
+    shell_write((const char *)payload, len);
+    shell_write((const char *)tail, sizeof(tail));
+}
+
+/**
+ * @brief 执行请求帧中的全部命令并发送结果帧
+ */
+static void shell_batch_run(Sysfpoint *sfp, shell *sh, EnvVar *env)
+{
+    char *line = (char *)shell_batch_in;
+    uint8_t count = 0;
+
+    shell_batch_in[sh->BatchLen] = '\0';
+    shell_batch_out_len = 2; // 帧状态 + 命令数
+
+    while (line != NULL)
+    {
+        char *next = strpbrk(line, "\r\n");
+        if (next != NULL)
+        {
+            *next++ = '\0';
+        }
+        if (*line != '\0')
+        {
+            // 记录头放不下或命令数达到上限时停止执行，由命令数告知上位机
+            if (count == 255 || shell_batch_out_len + 2u > sizeof(shell_batch_out))
             {
-                shell_printf(FG_RED "Command not found: %s\n" RESET_ALL, syscmd[i]);
+                break;
             }
-            return;
+            uint16_t rec = shell_batch_out_len;
+            shell_batch_out_len += 2;
+            shell_batch_rec = shell_batch_out_len;
+            shell_batch_trunc = false;
+
+            shell_batch_capture = true;
+            uint8_t status = shell_exec(sfp, sh, env, line, true);
+            shell_batch_capture = false;
+
+            shell_batch_out[rec] = status | (shell_batch_trunc ? DF_SHELL_CMD_TRUNCATED : 0);
+            shell_batch_out[rec + 1] = (uint8_t)(shell_batch_out_len - shell_batch_rec);
+            count++;
         }
+        line = next;
     }
 
-    // 如果未匹配到默认命令，检查环境变量
-    for (int i = 0; env_vars[i].name != NULL; i++)
+    shell_batch_out[0] = DF_SHELL_BATCH_OK;
+    shell_batch_out[1] = count;
+    shell_batch_send(shell_batch_out, shell_batch_out_len);
+}
+
+/**
+ * @brief 批处理帧接收状态机
+ * @param c 接收到的字节（SOF 之后）
+ */
+static void shell_batch_feed(Sysfpoint *sfp, shell *sh, EnvVar *env, uint8_t c)
+{
+    uint8_t err = DF_SHELL_BATCH_OK;
+
+    switch (sh->BatchState)
     {
-        if (strcmp(cmd_part, env_vars[i].name) == 0)
+    case SHELL_BATCH_LEN_L:
+        sh->BatchLen = c;
+        sh->BatchCrc = shell_crc16(sh->BatchCrc, &c, 1);
+        sh->BatchState = SHELL_BATCH_LEN_H;
+        break;
+    case SHELL_BATCH_LEN_H:
+        sh->BatchLen |= (uint16_t)c << 8;
+        sh->BatchCrc = shell_crc16(sh->BatchCrc, &c, 1);
+        sh->BatchPos = 0;
+        // 超长 (多为交互输入中误入的 SOF) 立即回复并回到空闲，不吞掉后续输入
+        if (sh->BatchLen > DF_SHELL_BATCH_MAX)
         {
-            shell_printf("Executing environment variable command: %s\n", env_vars[i].name);
-            env_vars[i].RunStae = 1;
-            env_vars[i].arg = arg_part;
-            env_vars[i].argc = arg_count;
-            Task_Switch(sfp, env_vars);
-            return;
+            sh->BatchState = SHELL_BATCH_IDLE;
+            err = DF_SHELL_BATCH_ERR_LEN;
+            break;
         }
+        sh->BatchState = (sh->BatchLen > 0) ? SHELL_BATCH_DATA : SHELL_BATCH_CRC_L;
+        break;
+    case SHELL_BATCH_DATA:
+        shell_batch_in[sh->BatchPos] = c;
+        sh->BatchCrc = shell_crc16(sh->BatchCrc, &c, 1);
+        if (++sh->BatchPos == sh->BatchLen)
+        {
+            sh->BatchState = SHELL_BATCH_CRC_L;
+        }
+        break;
+    case SHELL_BATCH_CRC_L:
+        sh->BatchCrcLow = c;
+        sh->BatchState = SHELL_BATCH_CRC_H;
+        break;
+    default:
+    {
+        uint16_t crc = (uint16_t)(sh->BatchCrcLow | ((uint16_t)c << 8));
+
+        sh->BatchState = SHELL_BATCH_IDLE;
+        if (crc != sh->BatchCrc)
+        {
+            err = DF_SHELL_BATCH_ERR_CRC;
+            break;
+        }
+        shell_batch_run(sfp, sh, env);
+        break;
+    }
     }
 
-    // 未匹配到命令
-    if (cmd_part != NULL)
+    if (err != DF_SHELL_BATCH_OK)
     {
-        shell_printf(FG_RED "Command not found: %s\n" RESET_ALL, cmd_part);
+        uint8_t payload[2] = {err, 0};
+        shell_batch_send(payload, sizeof(payload));
     }
 }
+#endif
@@ -1,6 +1,7 @@
 #ifndef __SEHLL_H
 #define __SEHLL_H
 
+#include <df_init.h> // DF_SECTION/DF_USED 段属性
 #include <df_log.h>  // 终端样式和日志
 #include <df_uart.h> // UART 设备接口
 #include <stdint.h>
@@ -24,15 +25,106 @@ typedef struct
     char *Version;      // 版本信息
 } DeviceFamily;
 
+/** @brief 行缓冲长度（含结束符） */
+#ifndef DF_SHELL_LINE_MAX
+#define DF_SHELL_LINE_MAX 64
+#endif
+
+/** @brief 历史命令条数（至少1条） */
+#ifndef DF_SHELL_HISTORY_NUM
+#define DF_SHELL_HISTORY_NUM 4
+#endif
+
+/**
+ * @brief 批处理模式（1=启用）
+ * @details 请求帧：SOF | 长度(2字节，小端) | 命令文本（以换行分隔）| CRC16(2字节，小端)
+ *          结果帧：SOF | 长度 | 帧状态(1) 命令数(1) {命令状态(1) 输出长度(1) 输出}... | CRC16
+ *          CRC16-CCITT（多项式0x1021，初值0xFFFF），覆盖长度与负载；命令不回显、不输出提示符
+ */
+#ifndef DF_SHELL_BATCH
+#define DF_SHELL_BATCH 1
+#endif
+
+/** @brief 请求帧命令文本最大长度 */
+#ifndef DF_SHELL_BATCH_MAX
+#define DF_SHELL_BATCH_MAX 256
+#endif
+
+/** @brief 结果帧负载最大长度，写满后剩余命令不再执行 */
+#ifndef DF_SHELL_BATCH_OUT_MAX
+#define DF_SHELL_BATCH_OUT_MAX 256
+#endif
+
+/**
+ * @brief 请求帧字节间隔超时（SysTick 节拍数），超时丢弃未收完的帧，0=不超时
+ * @note 交互输入中误入的 SOF 最多使后续输入失效这么长时间
+ */
+#ifndef DF_SHELL_BATCH_TIMEOUT
+#define DF_SHELL_BATCH_TIMEOUT 100
+#endif
+
+#define DF_SHELL_BATCH_SOF 0x02 // 帧起始字节（STX，交互输入中不会出现）
+
+/**
+ * @brief 中断接收队列长度，必须为2的幂
+ * @note 上位机一次写入整帧，shell_task 轮询之间可能收到整帧，启用批处理时须能容纳
+ *       最长的请求帧（DF_SHELL_BATCH_MAX + 5），否则长帧溢出后以 CRC 错误回复
+ */
+#ifndef DF_SHELL_RX_SIZE
+#if DF_SHELL_BATCH
+#define DF_SHELL_RX_SIZE 512
+#else
+#define DF_SHELL_RX_SIZE 64
+#endif
+#endif
+
+// 结果帧状态
+#define DF_SHELL_BATCH_OK 0x00      // 已执行
+#define DF_SHELL_BATCH_ERR_CRC 0x01 // CRC 校验失败，未执行
+#define DF_SHELL_BATCH_ERR_LEN 0x02 // 长度字段超过 DF_SHELL_BATCH_MAX，收到长度后立即回复，不再接收该帧
+
+// 命令状态
+#define DF_SHELL_CMD_OK 0x00        // 执行成功
+#define DF_SHELL_CMD_NOT_FOUND 0x01 // 命令不存在
+#define DF_SHELL_CMD_TRUNCATED 0x80 // 标志位：输出被截断
+
+#if (DF_SHELL_RX_SIZE & (DF_SHELL_RX_SIZE - 1)) != 0
+#error "DF_SHELL_RX_SIZE must be a power of two"
+#endif
+
+#if DF_SHELL_BATCH && DF_SHELL_RX_SIZE < DF_SHELL_BATCH_MAX + 5
+#error "DF_SHELL_RX_SIZE must hold a whole batch frame (DF_SHELL_BATCH_MAX + 5)"
+#endif
+
 typedef struct ShellTypeDef
 {
     bool Shell_Init; // Shell初始化标志
     uint8_t c;
-    uint8_t Res_len;   // 接收数据的下标
-    uint8_t UART_NOTE; // 本次数据节点
-    uint8_t RunStae;   // 运行状态
-    uint8_t Data[20];  // 数据长度酌情调整
+    uint16_t Res_len;                // 行缓冲已输入长度
+    uint8_t UART_NOTE;               // 本次数据节点
+    uint8_t RunStae;                 // 运行状态
+    uint8_t Data[DF_SHELL_LINE_MAX]; // 行缓冲
     int (*Data_Receive)(df_arg_t);
+
+    uint16_t Cursor; // 光标在行缓冲中的位置
+    uint8_t Esc;     // 转义序列解析状态
+
+    uint16_t RxHead;              // 接收队列写位置（仅中断写）
+    uint16_t RxTail;              // 接收队列读位置（仅 shell_task 写）
+    uint32_t RxDropped;           // 队列满丢弃的字节数
+    uint8_t Rx[DF_SHELL_RX_SIZE]; // 接收队列
+
+    char History[DF_SHELL_HISTORY_NUM][DF_SHELL_LINE_MAX]; // 历史命令环
+    uint8_t HistHead;  // 下一条历史写入位置
+    uint8_t HistCount; // 已保存的历史条数
+    uint8_t HistPos;   // 浏览位置：0=当前输入，1=最近一条
+
+    uint8_t BatchState;  // 批处理帧接收状态
+    uint8_t BatchCrcLow; // 收到的 CRC 低字节
+    uint16_t BatchLen;   // 帧负载长度
+    uint16_t BatchPos;   // 已接收负载字节数
+    uint16_t BatchCrc;   // 累计计算的 CRC
+    uint32_t BatchTick;  // 上一个帧字节的接收节拍
 } shell; // Shell协议结构体
 
 /**
@@ -58,6 +150,61 @@ typedef struct
     void (*callback)(int, void *[]); // 命令回调函数
 } EnvVar;                            // 环境变量结构体
 
+/*===========================================================================*/
+/*                         Shell 命令注册                                     */
+/*===========================================================================*/
+
+/** @brief 命令哈希表槽位数 = 2^DF_SHELL_HASH_BITS，命令与环境变量总数超过槽位数时回退线性查找 */
+#ifndef DF_SHELL_HASH_BITS
+#define DF_SHELL_HASH_BITS 6
+#endif
+
+/** @brief 建表时尝试的哈希种子数，找到无冲突种子即为完美哈希 */
+#ifndef DF_SHELL_HASH_SEED_TRIES
+#define DF_SHELL_HASH_SEED_TRIES 64
+#endif
+
+/**
+ * @brief 命令回调函数类型
+ * @param argc 参数个数（含命令名本身）
+ * @param argv 命令名之后的参数数组，无参数时为 NULL
+ */
+typedef void (*df_shell_fn_t)(int argc, void *argv[]);
+
+/**
+ * @brief 段注册的 Shell 命令描述
+ */
+typedef struct
+{
+    const char *name; // 命令名称
+    df_shell_fn_t fn; // 命令回调函数
+    const char *help; // 帮助信息
+} df_shell_cmd_t;
+
+/** @brief 固定段内条目对齐：避免编译器按优化规则放大对齐，使段内不再是连续数组 */
+#if defined(__GNUC__)
+#define DF_SHELL_CMD_ALIGN __attribute__((aligned(sizeof(void *))))
+#else
+#define DF_SHELL_CMD_ALIGN
+#endif
+
+/**
+ * @brief 注册 Shell 命令（放入 .df_shell_cmd 段，与 DF_INIT_EXPORT 相同机制）
+ * @param name 命令名（标识符，不加引号）
+ * @param fn 回调函数 (df_shell_fn_t)
+ * @param help 帮助字符串
+ * @note 回调在 shell_task 中直接执行（主循环上下文），
+ *       需要推迟到本轮输入处理之后执行的命令请使用 env_vars
+ * @note 需要链接 Driver_Framework/linker/df_shell_cmd.ld（主机仿真为 df_shell_cmd_host.ld）
+ *
+ * @example
+ * static void cmd_led(int argc, void *argv[]) { ... }
+ * DF_SHELL_CMD(led, cmd_led, "toggle onboard led");
+ */
+#define DF_SHELL_CMD(name, fn, help)                                       \
+    DF_USED const df_shell_cmd_t __df_shell_cmd_##name DF_SHELL_CMD_ALIGN \
+        DF_SECTION(".df_shell_cmd") = {#name, fn, help}
+
 /*===========================================================================*/
 /*                         Shell API 函数声明                                 */
 /*===========================================================================*/
@@ -69,6 +216,14 @@ typedef struct
  */
 void shell_set_uart(df_uart_t *uart);
 
+/**
+ * @brief Shell 格式化输出（写到 Shell 串口，批处理模式下写入结果帧）
+ * @param fmt 格式字符串
+ * @param ... 可变参数
+ * @note 供 DF_SHELL_CMD 注册的命令回调输出结果
+ */
+void shell_printf(const char *fmt, ...);
+
 /**
  * @brief 初始化 Shell
  * @param ShellTypeStruct Shell 结构体指针
@@ -85,22 +240,51 @@ void MCU_Shell_Init(shell *ShellTypeStruct, DeviceFamily *log);
 void Shell_Deal(Sysfpoint *sfp, shell *sh, EnvVar *env_vars);
 
 /**
- * @brief UART 接收中断处理函数
+ * @brief 处理一个输入字符（回显、行编辑、历史、回车执行命令）
  * @param Parameters 接收到的字符
  * @param sfp 系统函数指针结构体
  * @param ShellTypeStruct Shell 结构体指针
  * @param env 环境变量数组
  * @param log 设备信息结构体指针
+ * @note 会阻塞输出并执行命令，不要在中断中调用；中断中使用 shell_rx_push
  */
 void BIE_UART(uint8_t Parameters, Sysfpoint *sfp, shell *ShellTypeStruct,
               EnvVar *env, DeviceFamily *log);
 
+/**
+ * @brief 串口接收中断中把字节放入 Shell 接收队列
+ * @param sh Shell 结构体指针
+ * @param c 接收到的字节
+ * @return true=成功，false=队列满已丢弃
+ * @note 单生产者（中断）单消费者（shell_task）无锁队列，中断内耗时固定
+ */
+bool shell_rx_push(shell *sh, uint8_t c);
+
+/**
+ * @brief Shell 任务，在主循环中调用
+ * @details 逐个取出接收队列中的字节交给 BIE_UART 处理，某行设置了 env_vars 延迟命令时
+ *          在处理下一个字节前执行，同一次轮询收到的多条命令都会执行
+ * @param sfp 系统函数指针结构体
+ * @param sh Shell 结构体指针
+ * @param env 环境变量数组
+ * @param log 设备信息结构体指针
+ */
+void shell_task(Sysfpoint *sfp, shell *sh, EnvVar *env, DeviceFamily *log);
+
 /**
  * @brief 主循环命令切换运行函数
  * @param sfp 系统函数指针结构体
  */
 void Task_Switch_Tick_Handler(Sysfpoint *sfp);
 
+/**
+ * @brief 按名称查找段注册的命令
+ * @param name 命令名称
+ * @return 命令描述指针，未找到返回 NULL
+ * @note 哈希表在 MCU_Shell_Init 时建立，找到无冲突种子时查找只访问一个槽位
+ */
+const df_shell_cmd_t *shell_cmd_find(const char *name);
+
 /**
  * @brief 系统默认配置命令指针结构体
  */
@@ -74,7 +74,7 @@ float mpu6050_sensor_data[3] = {0};
 
 df_dev_t Dev_info_poor[] = {
 
-    {.name = OLED_NAME,
+    [DEV_ID_OLED] = {.name = OLED_NAME,
      .init = sh1106_dev_init,
      .enable = NULL,
      .disable = NULL,
@@ -86,7 +86,7 @@ df_dev_t Dev_info_poor[] = {
     //     .disable = NULL,
     //     // .arg.ptr = ptr(&lcd_st7789)
     // },
-    {.name = MPU6050_NAME,
+    [DEV_ID_MPU6050] = {.name = MPU6050_NAME,
      .init = mpu6050_dev_init,
      .enable = mpu6050_dev_enable,
      .disable = mpu6050_dev_disable,
@@ -99,7 +99,7 @@ df_dev_t Dev_info_poor[] = {
     //     .disable = NULL,
     //     .arg.ptr = ptr(&lcd_ssd1306)},
 
-    DF_DEV_END
+    [DEV_ID_NUM] = DF_DEV_END
 
 };
 
@@ -120,5 +120,5 @@ static int df_device_auto_init(void)
     return 0;
 }
 
-// 将设备框架初始化注册到PREV级别（在BOARD之后）
-DF_INIT_EXPORT(df_device_auto_init, DF_INIT_EXPORT_DEVICE);
\ No newline at end of file
+// 屏幕上电与 MPU6050 DMP 固件加载耗时较长，延迟到主循环开始后执行（依赖 I2C 总线初始化）
+DF_INIT_EXPORT_DEFER(df_device_auto_init, DF_INIT_EXPORT_DEVICE, "df_interface_auto_init");
\ No newline at end of file
@@ -7,20 +7,54 @@
 #include <mpu6050/inv_mpu.h>
 #include <hmc588/hmc588.h>
 #include <config.h>
+#include <df_sched.h>
 
-int main()
+static df_dev_t *mpu6050 = &Dev_info_poor[DEV_ID_MPU6050]; // 编译期句柄，无需按名称查找
+
+/* 1kHz 控制：读取姿态 */
+static int control_task(df_task_t *task)
 {
-    led.on(arg_null);
-    df_dev_t mpu6050;
-    if (df_dev_find(Dev_info_poor, MPU6050_NAME, &mpu6050))
+    static bool dev_ready = false; // 完成后不再变化，缓存结果，避免每拍按名称查找初始化表
+
+    if (!dev_ready)
     {
-        error("main", "MPU6050 device not found!\n");
-        while (1);
+        dev_ready = df_init_done("df_device_auto_init");
+        if (!dev_ready)
+        {
+            return DF_TASK_ENDED; // 设备在主循环空闲时延迟初始化
+        }
     }
-    while (1)
-    {
-        mpu6050.read(arg_ptr(&mpu6050));
+    df_dev_read(mpu6050, arg_ptr(mpu6050)); // 经 df_dev_read 计入设备统计（Shell: devstat）
+    return DF_TASK_ENDED;
+}
 
-    }
+/* 100Hz Shell：处理串口接收队列 */
+static int shell_poll_task(df_task_t *task)
+{
+    shell_task(&Shell_Sysfpoint, &Shell, env_vars, &STM32F103C8T6_Device);
+    return DF_TASK_ENDED;
+}
+
+/* 10Hz 遥测 */
+static int telemetry_task(df_task_t *task)
+{
+#ifdef USE_DEVICE_MPU6050
+    LOG_I("MAIN", "pitch=%.2f roll=%.2f yaw=%.2f", mpu6050_sensor_data[0],
+          mpu6050_sensor_data[1], mpu6050_sensor_data[2]);
+#endif
+    return DF_TASK_ENDED;
+}
+
+static df_task_t control = DF_TASK_INIT("control", control_task, 1, 0);
+static df_task_t shell_poll = DF_TASK_INIT("shell", shell_poll_task, 10, 1);
+static df_task_t telemetry = DF_TASK_INIT("telemetry", telemetry_task, 100, 2);
+
+int main()
+{
+    led.on(arg_null);
+    df_sched_add(&control);
+    df_sched_add(&shell_poll);
+    df_sched_add(&telemetry);
+    df_sched_start();
     return 0;
 }
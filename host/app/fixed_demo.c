@@ -0,0 +1,275 @@
+/**
+ * @file fixed_demo.c
+ * @brief 定点滤波器/PID 与浮点版本的一致性演示程序
+ * @details 同一输入序列分别送入浮点版本与 Q15、Q31 版本，比较每一步输出的最大误差：
+ *          - 滤波器：正弦 + 噪声 + 阶跃，幅度在 [-0.8, 0.8] 内
+ *          - PID：浮点控制器与一阶对象闭环运行，反馈序列同时送入定点控制器 (开环比较，误差不经对象放大)，
+ *            覆盖死区、微分先行、微分低通、输出饱和与抗积分饱和、很小的 Ki·dt
+ *          Q15 版本的参考输入先量化到 Q15，误差只来自运算；超过容差时返回非零
+ *
+ *          ./df_fixed_demo
+ */
+
+#include "control.h"
+#include "filter_fixed.h"
+#include "pid_fixed.h"
+#include <math.h>
+#include <stdio.h>
+
+#define DEMO_STEPS 20000
+#define DEMO_Q15_TOL (1.0f / 32768.0f) // Q15 容差：1 LSB (输出舍入)
+#define DEMO_Q31_TOL 1e-5f             // Q31 容差：由浮点版本的舍入误差决定
+
+static uint32_t demo_seed = 1;
+
+static float demo_noise(void)
+{
+    demo_seed = demo_seed * 1664525u + 1013904223u;
+    return ((float)(demo_seed >> 8) / 16777216.0f - 0.5f) * 0.1f;
+}
+
+/* 滤波器输入：正弦 + 噪声 + 每 4000 步切换的阶跃 */
+static float demo_signal(int step)
+{
+    float level = ((step / 4000) % 3 - 1) * 0.3f;
+    return level + 0.4f * sinf(6.2831853f * step / 500.0f) + demo_noise();
+}
+
+static float demo_q15(float x)
+{
+    return Q15_ToFloat(Q15_FromFloat(x));
+}
+
+typedef struct
+{
+    const char *name;
+    float err_q15; // Q15 版本与浮点版本的最大误差
+    float err_q31; // Q31 版本与浮点版本的最大误差
+} demo_result_t;
+
+static void demo_track(float *err, float ref, float val)
+{
+    float e = fabsf(ref - val);
+    if (e > *err)
+    {
+        *err = e;
+    }
+}
+
+/*============================================================================
+ *                              滤波器
+ *============================================================================*/
+
+static void demo_lowpass(demo_result_t *res)
+{
+    LowPassFilter_t f15, f31;
+    LowPass_Fixed_t q15, q31;
+
+    LowPass_Init(&f15, 0.05f);
+    LowPass_Init(&f31, 0.05f);
+    LowPass_Fixed_Init(&q15, 0.05f);
+    LowPass_Fixed_Init(&q31, 0.05f);
+
+    for (int step = 0; step < DEMO_STEPS; step++)
+    {
+        float x = demo_signal(step);
+        float x15 = demo_q15(x);
+        demo_track(&res->err_q15, LowPass_Update(&f15, x15), Q15_ToFloat(LowPass_Q15_Update(&q15, Q15_FromFloat(x15))));
+        demo_track(&res->err_q31, LowPass_Update(&f31, x), Q31_ToFloat(LowPass_Q31_Update(&q31, Q31_FromFloat(x))));
+    }
+}
+
+static void demo_butterworth(demo_result_t *res)
+{
+    Butterworth2Filter_t f15, f31;
+    Butterworth2_Fixed_t q15, q31;
+
+    Butterworth2_Init(&f15, 20.0f, 1000.0f);
+    Butterworth2_Init(&f31, 20.0f, 1000.0f);
+    Butterworth2_Fixed_Init(&q15, 20.0f, 1000.0f);
+    Butterworth2_Fixed_Init(&q31, 20.0f, 1000.0f);
+
+    for (int step = 0; step < DEMO_STEPS; step++)
+    {
+        float x = demo_signal(step);
+        float x15 = demo_q15(x);
+        demo_track(&res->err_q15, Butterworth2_Update(&f15, x15),
+                   Q15_ToFloat(Butterworth2_Q15_Update(&q15, Q15_FromFloat(x15))));
+        demo_track(&res->err_q31, Butterworth2_Update(&f31, x),
+                   Q31_ToFloat(Butterworth2_Q31_Update(&q31, Q31_FromFloat(x))));
+    }
+}
+
+static void demo_kalman(demo_result_t *res)
+{
+    KalmanFilter_t f15, f31;
+    Kalman_Fixed_t q15, q31;
+
+    Kalman_Init(&f15, 0.001f, 0.05f, 0.0f);
+    Kalman_Init(&f31, 0.001f, 0.05f, 0.0f);
+    Kalman_Fixed_Init(&q15, 0.001f, 0.05f, 0.0f);
+    Kalman_Fixed_Init(&q31, 0.001f, 0.05f, 0.0f);
+
+    for (int step = 0; step < DEMO_STEPS; step++)
+    {
+        float x = demo_signal(step);
+        float x15 = demo_q15(x);
+        demo_track(&res->err_q15, Kalman_Update(&f15, x15), Q15_ToFloat(Kalman_Q15_Update(&q15, Q15_FromFloat(x15))));
+        demo_track(&res->err_q31, Kalman_Update(&f31, x), Q31_ToFloat(Kalman_Q31_Update(&q31, Q31_FromFloat(x))));
+    }
+    if (!q31.converged)
+    {
+        printf("[demo] kalman gain did not converge\n");
+        res->err_q31 = 1.0f;
+    }
+}
+
+/*============================================================================
+ *                              PID
+ *============================================================================*/
+
+static void demo_pid(demo_result_t *res, PID_Config_t *cfg, float d_alpha)
+{
+    PID_Controller_t f15, f31;
+    LowPassFilter_t lpf15, lpf31;
+    PID_Fixed_t q15, q31;
+    float y = 0.0f;
+
+    PID_Init(&f15, cfg);
+    PID_Init(&f31, cfg);
+    PID_Fixed_Init(&q15, cfg);
+    PID_Fixed_Init(&q31, cfg);
+    if (d_alpha > 0.0f)
+    {
+        LowPass_Init(&lpf15, d_alpha);
+        LowPass_Init(&lpf31, d_alpha);
+        PID_SetDerivativeFilter(&f15, &lpf15, LowPass_Update);
+        PID_SetDerivativeFilter(&f31, &lpf31, LowPass_Update);
+        PID_EnableDerivativeFilter(&f15, 1);
+        PID_EnableDerivativeFilter(&f31, 1);
+        PID_Fixed_SetDerivativeLowPass(&q15, d_alpha);
+        PID_Fixed_SetDerivativeLowPass(&q31, d_alpha);
+    }
+
+    for (int step = 0; step < DEMO_STEPS; step++)
+    {
+        if (step % 2500 == 0)
+        {
+            // 设定值取 Q15 可精确表示的值
+            float sp = (float)((step / 2500) % 5 - 2) * 0.25f;
+            PID_SetSetpoint(&f15, sp);
+            PID_SetSetpoint(&f31, sp);
+            PID_Q15_SetSetpoint(&q15, Q15_FromFloat(sp));
+            PID_Q31_SetSetpoint(&q31, Q31_FromFloat(sp));
+        }
+
+        float fb = y + demo_noise() * 0.1f;
+        float fb15 = demo_q15(fb);
+        float u = PID_Update(&f31, fb);
+        demo_track(&res->err_q31, u, Q31_ToFloat(PID_Q31_Update(&q31, Q31_FromFloat(fb))));
+        demo_track(&res->err_q15, PID_Update(&f15, fb15), Q15_ToFloat(PID_Q15_Update(&q15, Q15_FromFloat(fb15))));
+
+        /* 一阶对象 tau = 20ms */
+        y += (u - y) * cfg->dt / 0.02f;
+    }
+}
+
+static void demo_pid_inc(demo_result_t *res, PID_Config_t *cfg)
+{
+    PID_Incremental_t f15, f31;
+    PID_Inc_Fixed_t q15, q31;
+    float y = 0.0f;
+
+    PID_Inc_Init(&f15, cfg);
+    PID_Inc_Init(&f31, cfg);
+    PID_Inc_Fixed_Init(&q15, cfg);
+    PID_Inc_Fixed_Init(&q31, cfg);
+
+    for (int step = 0; step < DEMO_STEPS; step++)
+    {
+        if (step % 2500 == 0)
+        {
+            float sp = (float)((step / 2500) % 5 - 2) * 0.25f;
+            PID_Inc_SetSetpoint(&f15, sp);
+            PID_Inc_SetSetpoint(&f31, sp);
+            PID_Inc_Q15_SetSetpoint(&q15, Q15_FromFloat(sp));
+            PID_Inc_Q31_SetSetpoint(&q31, Q31_FromFloat(sp));
+        }
+
+        float fb = y + demo_noise() * 0.1f;
+        float fb15 = demo_q15(fb);
+        float u = PID_Inc_Update(&f31, fb);
+        demo_track(&res->err_q31, u, Q31_ToFloat(PID_Inc_Q31_Update(&q31, Q31_FromFloat(fb))));
+        demo_track(&res->err_q15, PID_Inc_Update(&f15, fb15),
+                   Q15_ToFloat(PID_Inc_Q15_Update(&q15, Q15_FromFloat(fb15))));
+
+        y += (u - y) * cfg->dt / 0.02f;
+    }
+}
+
+int main(void)
+{
+    PID_Config_t pid_cfg = {
+        .Kp = 0.8f,
+        .Ki = 5.0f,
+        .Kd = 0.01f,
+        .dt = 0.001f,
+        .output_max = 0.9f,
+        .output_min = -0.9f,
+        .integral_max = 0.15f,
+        .integral_min = -0.15f,
+        .deadband = 0.0f,
+        .anti_windup = 1,
+        .derivative_on_measurement = 0};
+    PID_Config_t dom_cfg = pid_cfg;
+    dom_cfg.Kd = 0.02f;
+    dom_cfg.deadband = 0.004f;
+    dom_cfg.derivative_on_measurement = 1;
+    PID_Config_t sat_cfg = pid_cfg;
+    sat_cfg.Kp = 4.0f;
+    sat_cfg.Ki = 40.0f;
+    sat_cfg.output_max = 0.5f;
+    sat_cfg.output_min = -0.5f;
+    PID_Config_t slow_cfg = pid_cfg;
+    slow_cfg.Ki = 0.05f; // Ki*dt = 5e-5
+    slow_cfg.integral_max = 10.0f;
+    slow_cfg.integral_min = -10.0f;
+    slow_cfg.anti_windup = 0;
+    PID_Config_t inc_cfg = pid_cfg;
+    inc_cfg.Kp = 0.5f;
+    inc_cfg.Ki = 10.0f;
+    inc_cfg.Kd = 0.005f;
+
+    demo_result_t res[] = {
+        {"LowPass"},          {"Butterworth2"},          {"Kalman"},        {"PID"},
+        {"PID dom+deadband"}, {"PID saturated"},         {"PID small Ki"},  {"PID_Inc"},
+    };
+
+    demo_lowpass(&res[0]);
+    demo_butterworth(&res[1]);
+    demo_kalman(&res[2]);
+    demo_pid(&res[3], &pid_cfg, 0.0f);
+    demo_pid(&res[4], &dom_cfg, 0.2f);
+    demo_pid(&res[5], &sat_cfg, 0.0f);
+    demo_pid(&res[6], &slow_cfg, 0.0f);
+    demo_pid_inc(&res[7], &inc_cfg);
+
+    int fail = 0;
+    printf("[demo] %d steps, max |fixed - float|\n", DEMO_STEPS);
+    printf("[demo] %-18s %14s %14s\n", "case", "Q15 (LSB)", "Q31");
+    for (unsigned i = 0; i < sizeof(res) / sizeof(res[0]); i++)
+    {
+        int ok = res[i].err_q15 <= DEMO_Q15_TOL && res[i].err_q31 <= DEMO_Q31_TOL;
+        printf("[demo] %-18s %14.3f %14.3g %s\n", res[i].name, res[i].err_q15 * 32768.0f, res[i].err_q31,
+               ok ? "" : "FAIL");
+        fail |= !ok;
+    }
+
+    /* 编译时选择：默认 CTRL_NUMERIC_FLOAT，CTRL_ 前缀直接映射到浮点版本 */
+    CTRL_LowPass_t sel;
+    CTRL_LowPass_Init(&sel, 0.5f);
+    ctrl_t sel_out = CTRL_LowPass_Update(&sel, CTRL_FROM_FLOAT(0.25f));
+    fail |= CTRL_TO_FLOAT(sel_out) != 0.25f;
+
+    return fail ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file init.c
+ * @brief 主机仿真应用层设备表
+ * @note 与 app/init.c 结构一致，仅保留主机仿真可用的设备（SH1106 OLED）
+ */
+
+#include "main.h"
+#include "config.h"
+#include "device_init.h"
+
+shell Shell = {
+    .Shell_Init = false, // Shell未初始化
+    .c = 0,              // 初始化接收字符
+    .Res_len = 0,        // 初始化接收长度
+    .UART_NOTE = 0,      // 初始化串口节点
+    .RunStae = 0,        // 初始化运行状态
+    .Data_Receive = NULL // 数据接收函数指针（需要适配新接口）
+};
+
+Sysfpoint Shell_Sysfpoint;
+
+DeviceFamily STM32F103C8T6_Device = {
+    .Architecture = "x86-64 (sim cortex-m3)",
+    .DeviceName = "STM32F103C8T6",
+    .OS = "BareMetal",
+    .Device = "HostSim",
+    .User = "Admin",
+    .Password = "133990",
+    .Version = "1.0.0"};
+
+#ifdef USE_DEVICE_SH1106
+LCD_Handler_t lcd_sh1106 = {
+    .Width = SH1106_WIDTH,
+    .Height = SH1106_HEIGHT,
+    .SetPixel = SH1106_SetPixel,
+    .GetPixel = SH1106_GetPoint,
+    .FillRect = SH1106_FillRect, // SH1106没有硬件块填充，由框架模拟
+    .Update = SH1106_Update,
+    .ScrollHard = NULL, // 可选实现
+    .CursorX = 0,
+    .CursorY = 0,
+    .CurrentFont = &Consolas_Font_8x16, // 可选设置
+    .TextColor = 0xFFFFFFFF,
+    .BackColor = 0x00000000,
+    .TerminalMode = true};
+#endif
+
+df_dev_t Dev_info_poor[] = {
+
+    [DEV_ID_OLED] = {.name = OLED_NAME,
+     .init = sh1106_dev_init,
+     .enable = NULL,
+     .disable = NULL,
+     .arg.ptr = ptr(&lcd_sh1106)},
+
+    [DEV_ID_NUM] = DF_DEV_END
+
+};
+
+EnvVar env_vars[] = {
+    {NULL} // 环境变量列表结束标志
+};
+
+/**
+ * @brief 设备框架自动初始化函数
+ * @details 在框架初始化时自动调用，初始化设备管理框架
+ * @return 0表示成功
+ */
+static int df_device_auto_init(void)
+{
+    df_dev_register(Dev_info_poor); // 初始化设备模型
+    return 0;
+}
+
+// 将设备框架初始化注册到DEVICE级别
+DF_INIT_EXPORT(df_device_auto_init, DF_INIT_EXPORT_DEVICE);
@@ -0,0 +1,123 @@
+/**
+ * @file lazy_dev_demo.c
+ * @brief 设备延迟初始化演示程序
+ * @details 注册一张设备表，init() 以推进虚拟时间模拟耗时：
+ *          - led     立即初始化，50us
+ *          - imu     立即初始化，5ms
+ *          - gps     延迟初始化，120ms（冷启动），启动后才打开
+ *          - sdcard  延迟初始化，80ms，从未打开
+ *          - camera  延迟初始化，init 失败
+ *          检查注册耗时只包含立即初始化的设备；gps 经 df_dev_find() 得到的两个副本
+ *          打开时只初始化一次；sdcard 的 init 从未执行；camera 打开返回错误
+ *
+ *          ./df_lazy_dev_demo
+ */
+
+#include "main.h"
+
+#define DEMO_US (SystemCoreClock / 1000000)
+
+enum
+{
+    DEMO_LED = 0,
+    DEMO_IMU,
+    DEMO_GPS,
+    DEMO_SDCARD,
+    DEMO_CAMERA,
+    DEMO_NUM
+};
+
+static uint32_t demo_init_runs[DEMO_NUM];
+
+static int demo_led_init(df_arg_t arg)
+{
+    demo_init_runs[DEMO_LED]++;
+    sim_core_advance(50 * DEMO_US);
+    return DF_OK;
+}
+
+static int demo_imu_init(df_arg_t arg)
+{
+    demo_init_runs[DEMO_IMU]++;
+    sim_core_advance(5000 * DEMO_US);
+    return DF_OK;
+}
+
+static int demo_gps_init(df_arg_t arg)
+{
+    demo_init_runs[DEMO_GPS]++;
+    sim_core_advance(120000 * DEMO_US); /* 冷启动 */
+    return DF_OK;
+}
+
+static int demo_sdcard_init(df_arg_t arg)
+{
+    demo_init_runs[DEMO_SDCARD]++;
+    sim_core_advance(80000 * DEMO_US);
+    return DF_OK;
+}
+
+static int demo_camera_init(df_arg_t arg)
+{
+    demo_init_runs[DEMO_CAMERA]++;
+    return DF_ERR_TIMEOUT;
+}
+
+static int demo_enable(df_arg_t arg)
+{
+    return DF_OK;
+}
+
+static int demo_read(df_arg_t arg)
+{
+    return DF_OK;
+}
+
+static df_dev_t demo_devs[] = {
+    {.name = "led", .init = demo_led_init, .enable = demo_enable},
+    {.name = "imu", .init = demo_imu_init, .enable = demo_enable, .read = demo_read},
+    {.name = "gps", .init = demo_gps_init, .read = demo_read, .flags = DF_DEV_FLAG_LAZY},
+    {.name = "sdcard", .init = demo_sdcard_init, .flags = DF_DEV_FLAG_LAZY},
+    {.name = "camera", .init = demo_camera_init, .flags = DF_DEV_FLAG_LAZY},
+    DF_DEV_END};
+
+int main(void)
+{
+    log_flush();
+
+    uint64_t t0 = sim_core_cycles();
+    df_dev_register(demo_devs);
+    uint32_t boot_us = (uint32_t)((sim_core_cycles() - t0) / DEMO_US);
+    log_flush();
+
+    /* 两个模块各自查找 gps，得到的副本共享注册表中的初始化状态 */
+    df_dev_t gps_nav, gps_log, camera;
+    df_dev_find(demo_devs, "gps", &gps_nav);
+    df_dev_find(demo_devs, "gps", &gps_log);
+    df_dev_find(demo_devs, "camera", &camera);
+
+    bool ok = df_dev_read(&gps_nav, arg_null) == DF_OK;
+    ok = ok && df_dev_open(&gps_log) == DF_OK;
+    ok = ok && df_dev_open(&gps_nav) == DF_OK;
+    ok = ok && df_dev_open(&camera) == DF_ERR_NOT_INIT;
+    ok = ok && df_dev_open(&camera) == DF_ERR_NOT_INIT;
+    log_flush();
+
+    df_dev_report(demo_devs);
+    log_flush();
+    fflush(stdout);
+
+    printf("\n[demo] df_dev_register() took %u us\n", (unsigned)boot_us);
+    printf("[demo] init runs: led %u, imu %u, gps %u, sdcard %u, camera %u\n",
+           (unsigned)demo_init_runs[DEMO_LED], (unsigned)demo_init_runs[DEMO_IMU],
+           (unsigned)demo_init_runs[DEMO_GPS], (unsigned)demo_init_runs[DEMO_SDCARD],
+           (unsigned)demo_init_runs[DEMO_CAMERA]);
+
+    /* 注册只包含 led + imu；每个 init 至多执行一次；从未打开的 sdcard 不执行 */
+    ok = ok && boot_us < 5200 && demo_init_runs[DEMO_LED] == 1 && demo_init_runs[DEMO_IMU] == 1 &&
+         demo_init_runs[DEMO_GPS] == 1 && demo_init_runs[DEMO_SDCARD] == 0 &&
+         demo_init_runs[DEMO_CAMERA] == 1 && demo_devs[DEMO_GPS].status == DF_STATE_INITIALIZED &&
+         demo_devs[DEMO_SDCARD].status == DF_STATE_UNINITIALIZED &&
+         demo_devs[DEMO_CAMERA].status == DF_STATE_ERROR;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file pid_autotune_demo.c
+ * @brief 继电反馈PID自整定演示程序
+ * @details 一阶加纯滞后对象 y' = (K·u(t-θ) + 扰动 - y) / τ，反馈叠加均匀噪声，依次检查：
+ *          1. 继电辨识的 Ku、Tu 与解析值 (ωu·θ + atan(ωu·τ) = π) 的误差
+ *          2. 每种规则整定后切换到闭环 (无扰)，再做设定值阶跃与负载扰动，闭环须稳定并消除静差
+ *          3. 滞环大于振荡幅值时超时失败，控制器参数不变
+ *          任一项不满足时返回非零
+ *
+ *          ./df_pid_autotune_demo
+ */
+
+#include "pid_autotune.h"
+#include <math.h>
+#include <stdio.h>
+
+#define DEMO_DT 0.01f      // 控制周期
+#define DEMO_DELAY_MAX 256 // 纯滞后缓冲 (周期数)
+#define DEMO_PI 3.14159265f
+
+typedef struct
+{
+    const char *name;
+    float K;     // 对象增益
+    float tau;   // 时间常数 (秒)
+    float theta; // 纯滞后 (秒)
+} demo_model_t;
+
+typedef struct
+{
+    const demo_model_t *m;
+    float y;
+    float disturbance; // 折算到输入的负载扰动
+    float buf[DEMO_DELAY_MAX];
+    uint32_t head;
+    uint32_t delay;
+} demo_plant_t;
+
+static uint32_t demo_seed = 1;
+
+static float demo_noise(void)
+{
+    demo_seed = demo_seed * 1664525u + 1013904223u;
+    return ((float)(demo_seed >> 8) / 16777216.0f - 0.5f) * 0.01f; // ±0.005
+}
+
+static void demo_plant_init(demo_plant_t *p, const demo_model_t *m, float u0)
+{
+    p->m = m;
+    p->y = m->K * u0;
+    p->disturbance = 0.0f;
+    p->head = 0;
+    p->delay = (uint32_t)(m->theta / DEMO_DT + 0.5f);
+    for (uint32_t i = 0; i < DEMO_DELAY_MAX; i++)
+    {
+        p->buf[i] = u0;
+    }
+}
+
+/* 返回带噪声的测量值 */
+static float demo_plant_step(demo_plant_t *p, float u)
+{
+    p->buf[p->head] = u;
+    float u_delayed = p->buf[(p->head + DEMO_DELAY_MAX - p->delay) % DEMO_DELAY_MAX];
+    p->head = (p->head + 1) % DEMO_DELAY_MAX;
+
+    p->y += (p->m->K * (u_delayed + p->disturbance) - p->y) * DEMO_DT / p->m->tau;
+    return p->y + demo_noise();
+}
+
+/* 解析临界点：二分求 ωu·θ + atan(ωu·τ) = π */
+static void demo_ultimate(const demo_model_t *m, float *Ku, float *Tu)
+{
+    float lo = 0.0f, hi = DEMO_PI / m->theta;
+    for (int i = 0; i < 60; i++)
+    {
+        float w = 0.5f * (lo + hi);
+        if (w * m->theta + atanf(w * m->tau) < DEMO_PI)
+            lo = w;
+        else
+            hi = w;
+    }
+    *Ku = sqrtf(1.0f + lo * m->tau * lo * m->tau) / m->K;
+    *Tu = 2.0f * DEMO_PI / lo;
+}
+
+static const PID_Config_t demo_pid_cfg = {
+    .Kp = 0.0f,
+    .Ki = 0.0f,
+    .Kd = 0.0f,
+    .dt = DEMO_DT,
+    .output_max = 1.0f,
+    .output_min = 0.0f,
+    .integral_max = 100.0f,
+    .integral_min = -100.0f,
+    .deadband = 0.0f,
+    .anti_windup = 1,
+    .derivative_on_measurement = 1};
+
+static PID_AutoTune_Config_t demo_tune_cfg(float setpoint, PID_TuneRule_t rule)
+{
+    PID_AutoTune_Config_t cfg = {.setpoint = setpoint,
+                                 .output_bias = 0.5f,
+                                 .relay_amplitude = 0.3f,
+                                 .hysteresis = 0.01f,
+                                 .cycles = 4,
+                                 .timeout = 300.0f,
+                                 .rule = rule,
+                                 .simc_tau_c = 0.0f};
+    return cfg;
+}
+
+/**
+ * @brief 整定后闭环：保持，设定值阶跃 (对应输入变化 0.1)，负载扰动 -0.1
+ * @return 0 失败
+ */
+static int demo_rule(const demo_model_t *m, PID_TuneRule_t rule, const char *rule_name, float Ku_ref, float Tu_ref)
+{
+    PID_Controller_t pid;
+    PID_AutoTune_t tune;
+    demo_plant_t p;
+    PID_Config_t pid_cfg = demo_pid_cfg;
+    PID_AutoTune_Config_t cfg = demo_tune_cfg(0.5f * m->K, rule);
+
+    PID_Init(&pid, &pid_cfg);
+    demo_plant_init(&p, m, 0.5f);
+    PID_AutoTune_Start(&tune, &pid, &cfg);
+
+    float y = p.y, u = 0.5f, bump = 0.0f;
+    uint32_t tune_ticks = 0;
+    while (PID_AutoTune_Running(&tune))
+    {
+        u = PID_AutoTune_Update(&tune, y);
+        y = demo_plant_step(&p, u);
+        tune_ticks++;
+    }
+    if (tune.state != PID_TUNE_DONE)
+    {
+        printf("[demo] %-8s %-9s tuning failed\n", m->name, rule_name);
+        return 0;
+    }
+    bump = u - cfg.output_bias; // 切换到闭环的第一拍与继电输出中心的差
+
+    // 按模型时间尺度分三段：整定后保持 (继电振荡衰减)、设定值阶跃、负载扰动，每段结束时检查静差
+    uint32_t T = (uint32_t)(30.0f * (m->tau + m->theta) / DEMO_DT); // Tyreus–Luyben 在纯滞后较大时很慢
+    float sp = cfg.setpoint + 0.1f * m->K;
+    float peak = 0.0f, iae = 0.0f, err_settle = 0.0f, err_step = 0.0f, err_end = 0.0f;
+    for (uint32_t i = 0; i < 3 * T; i++)
+    {
+        if (i == T)
+        {
+            err_settle = cfg.setpoint - p.y;
+            PID_SetSetpoint(&pid, sp);
+            peak = p.y;
+        }
+        else if (i == 2 * T)
+        {
+            err_step = sp - p.y;
+            p.disturbance = -0.1f;
+        }
+        u = PID_Update(&pid, y);
+        y = demo_plant_step(&p, u);
+        if (i >= T)
+        {
+            peak = (i < 2 * T && p.y > peak) ? p.y : peak;
+            iae += fabsf(sp - p.y) * DEMO_DT;
+        }
+        err_end = sp - p.y;
+    }
+    float overshoot = (peak - sp) / (0.1f * m->K) * 100.0f;
+
+    float ku_err = (tune.Ku - Ku_ref) / Ku_ref * 100.0f;
+    float tu_err = (tune.Tu - Tu_ref) / Tu_ref * 100.0f;
+    printf("[demo] %-8s %-9s %5.1fs Ku %6.3f (%+5.1f%%) Tu %5.2fs (%+5.1f%%) theta %4.2fs | Kp %6.3f Ki %6.3f Kd "
+           "%6.3f | overshoot %5.1f%% IAE %6.3f\n",
+           m->name, rule_name, tune_ticks * DEMO_DT, tune.Ku, ku_err, tune.Tu, tu_err, tune.dead_time, tune.Kp,
+           tune.Ki, tune.Kd, overshoot, iae);
+
+    // 继电下对象输出近似三角波而非正弦，描述函数近似使 Ku 偏小，时间常数为主的对象约 20%~30%；
+    // 闭环须稳定，并在每段结束时消除静差，切换时无大的跳变
+    float tol = 0.01f * m->K;
+    return ku_err > -30.0f && ku_err < 5.0f && fabsf(tu_err) < 10.0f && fabsf(err_settle) < tol &&
+           fabsf(err_step) < tol && fabsf(err_end) < tol && fabsf(bump) < 0.1f;
+}
+
+/**
+ * @brief 3. 滞环过大，继电不切换，超时失败
+ */
+static int demo_timeout(const demo_model_t *m)
+{
+    PID_Controller_t pid;
+    PID_AutoTune_t tune;
+    demo_plant_t p;
+    PID_Config_t pid_cfg = demo_pid_cfg;
+    PID_AutoTune_Config_t cfg = demo_tune_cfg(0.5f * m->K, PID_TUNE_ZN_PID);
+
+    pid_cfg.Kp = 0.1f;
+    cfg.hysteresis = 2.0f * m->K;
+    cfg.timeout = 30.0f;
+    PID_Init(&pid, &pid_cfg);
+    demo_plant_init(&p, m, 0.5f);
+    PID_AutoTune_Start(&tune, &pid, &cfg);
+
+    float y = p.y;
+    uint32_t ticks = 0;
+    while (PID_AutoTune_Running(&tune))
+    {
+        y = demo_plant_step(&p, PID_AutoTune_Update(&tune, y));
+        ticks++;
+    }
+    printf("[demo] %-8s hysteresis too large: %s after %.1fs, Kp kept %.2f\n", m->name,
+           tune.state == PID_TUNE_FAILED ? "failed" : "finished", ticks * DEMO_DT, pid.Kp);
+    return tune.state == PID_TUNE_FAILED && pid.Kp == 0.1f && PID_AutoTune_Update(&tune, y) == cfg.output_bias;
+}
+
+int main(void)
+{
+    static const demo_model_t models[] = {
+        {"lag", 2.0f, 1.0f, 0.2f},   // 时间常数为主 (电机、小型加热器)
+        {"delay", 1.5f, 0.5f, 0.5f}, // 纯滞后较大 (管道、热惯性大的对象)
+    };
+    static const struct
+    {
+        PID_TuneRule_t rule;
+        const char *name;
+    } rules[] = {
+        {PID_TUNE_ZN_PI, "ZN-PI"},   {PID_TUNE_ZN_PID, "ZN-PID"},   {PID_TUNE_TL_PI, "TL-PI"},
+        {PID_TUNE_TL_PID, "TL-PID"}, {PID_TUNE_SIMC_PI, "SIMC-PI"},
+    };
+
+    int ok = 1;
+    for (unsigned i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+    {
+        float Ku_ref, Tu_ref;
+        demo_ultimate(&models[i], &Ku_ref, &Tu_ref);
+        printf("[demo] %-8s K %.1f tau %.1fs theta %.1fs: Ku %.3f Tu %.2fs (analytic)\n", models[i].name,
+               models[i].K, models[i].tau, models[i].theta, Ku_ref, Tu_ref);
+        for (unsigned j = 0; j < sizeof(rules) / sizeof(rules[0]); j++)
+        {
+            ok &= demo_rule(&models[i], rules[j].rule, rules[j].name, Ku_ref, Tu_ref);
+        }
+    }
+    ok &= demo_timeout(&models[0]);
+
+    return ok ? 0 : 1;
+}
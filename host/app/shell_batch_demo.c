@@ -0,0 +1,256 @@
+/**
+ * @file shell_batch_demo.c
+ * @brief Shell 批处理模式演示程序
+ * @details 在 115200 波特率下把同一组 "set <idx> <value>" 命令分别以
+ *          1. 交互方式逐条输入（回显 + 提示信息 + 提示符）
+ *          2. 一个批处理请求帧（与 tool/shell_batch.py 相同，整帧一次写入，两次轮询之间全部到达）
+ *          发送给 Shell，统计串口发送字节数与虚拟耗时，并校验结果帧与命令执行结果；
+ *          另检查交互输入中误入 SOF 后 Shell 能恢复：长度超限立即回复，未收完的帧超时丢弃
+ *
+ *          ./df_shell_batch_demo
+ */
+
+#include "main.h"
+#include <stdlib.h>
+
+#define DEMO_BAUD 115200
+#define DEMO_CMDS 20
+#define DEMO_CHUNK 32 /* 交互输入每次注入的字节数 */
+
+extern df_uart_t Debug;
+
+static int demo_values[DEMO_CMDS];
+
+/**
+ * @brief 演示命令：set <idx> <value>
+ */
+static void demo_set(int argc, void *argv[])
+{
+    if (argc == 3)
+    {
+        int idx = atoi((char *)argv[0]);
+        if (idx >= 0 && idx < DEMO_CMDS)
+        {
+            demo_values[idx] = atoi((char *)argv[1]);
+        }
+    }
+}
+DF_SHELL_CMD(set, demo_set, "set <idx> <value>");
+
+typedef struct
+{
+    uint64_t cycles;   /* 虚拟耗时 */
+    uint64_t tx_bytes; /* 串口发送字节数 */
+    bool ok;           /* 命令全部执行且结果正确 */
+} demo_result_t;
+
+static uint16_t demo_crc16(uint16_t crc, const uint8_t *data, size_t len)
+{
+    while (len-- > 0)
+    {
+        crc ^= (uint16_t)(*data++ << 8);
+        for (int i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief 分段注入数据，每段之后运行一次 shell_task（模拟主循环轮询）
+ */
+static void demo_feed(const char *data, size_t len)
+{
+    while (len > 0)
+    {
+        size_t n = (len < DEMO_CHUNK) ? len : DEMO_CHUNK;
+        sim_usart_inject(data, n);
+        shell_task(&Shell_Sysfpoint, &Shell, env_vars, &STM32F103C8T6_Device);
+        data += n;
+        len -= n;
+    }
+}
+
+static bool demo_check_values(void)
+{
+    for (int i = 0; i < DEMO_CMDS; i++)
+    {
+        if (demo_values[i] != i * 7)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static demo_result_t demo_interactive(void)
+{
+    demo_result_t r = {0};
+    uint64_t t0 = sim_core_cycles();
+    uint64_t b0 = sim_usart_tx_bytes();
+    char line[32];
+
+    memset(demo_values, 0, sizeof(demo_values));
+    for (int i = 0; i < DEMO_CMDS; i++)
+    {
+        int len = snprintf(line, sizeof(line), "set %d %d\r", i, i * 7);
+        demo_feed(line, (size_t)len);
+    }
+    r.cycles = sim_core_cycles() - t0;
+    r.tx_bytes = sim_usart_tx_bytes() - b0;
+    r.ok = demo_check_values();
+    return r;
+}
+
+/**
+ * @brief 校验结果帧：CRC、帧状态、命令数与每条命令状态
+ */
+static bool demo_check_frame(FILE *fp, long offset)
+{
+    uint8_t buf[512];
+    size_t n;
+
+    fflush(fp);
+    fseek(fp, offset, SEEK_SET);
+    n = fread(buf, 1, sizeof(buf), fp);
+    if (n < 7 || buf[0] != DF_SHELL_BATCH_SOF)
+    {
+        printf("[demo] no response frame\n");
+        return false;
+    }
+
+    uint16_t len = (uint16_t)(buf[1] | (buf[2] << 8));
+    if ((size_t)len + 5 > n)
+    {
+        printf("[demo] short response frame\n");
+        return false;
+    }
+    uint16_t crc = (uint16_t)(buf[3 + len] | (buf[4 + len] << 8));
+    if (crc != demo_crc16(0xFFFF, &buf[1], (size_t)len + 2))
+    {
+        printf("[demo] response crc error\n");
+        return false;
+    }
+
+    const uint8_t *p = &buf[3];
+    if (p[0] != DF_SHELL_BATCH_OK || p[1] != DEMO_CMDS)
+    {
+        printf("[demo] frame status %u, %u commands\n", p[0], p[1]);
+        return false;
+    }
+    p += 2;
+    for (int i = 0; i < DEMO_CMDS; i++)
+    {
+        if (p[0] != DF_SHELL_CMD_OK)
+        {
+            printf("[demo] command %d status 0x%02x\n", i, p[0]);
+            return false;
+        }
+        p += 2 + p[1];
+    }
+    return true;
+}
+
+static demo_result_t demo_batch(FILE *fp)
+{
+    demo_result_t r = {0};
+    uint8_t frame[DF_SHELL_BATCH_MAX + 5];
+    uint16_t len = 0;
+
+    for (int i = 0; i < DEMO_CMDS; i++)
+    {
+        len += (uint16_t)snprintf((char *)&frame[3 + len], sizeof(frame) - 3 - len, "set %d %d\n", i, i * 7);
+    }
+    frame[0] = DF_SHELL_BATCH_SOF;
+    frame[1] = (uint8_t)len;
+    frame[2] = (uint8_t)(len >> 8);
+    uint16_t crc = demo_crc16(0xFFFF, &frame[1], (size_t)len + 2);
+    frame[3 + len] = (uint8_t)crc;
+    frame[4 + len] = (uint8_t)(crc >> 8);
+
+    memset(demo_values, 0, sizeof(demo_values));
+    fflush(fp);
+    long offset = ftell(fp);
+    uint64_t t0 = sim_core_cycles();
+    uint64_t b0 = sim_usart_tx_bytes();
+    uint32_t dropped = Shell.RxDropped;
+
+    sim_usart_inject((const char *)frame, (size_t)len + 5);
+    shell_task(&Shell_Sysfpoint, &Shell, env_vars, &STM32F103C8T6_Device);
+
+    r.cycles = sim_core_cycles() - t0;
+    r.tx_bytes = sim_usart_tx_bytes() - b0;
+    r.ok = Shell.RxDropped == dropped && demo_check_values() && demo_check_frame(fp, offset);
+    return r;
+}
+
+/**
+ * @brief 误入的 SOF 不应使交互输入失效
+ *        1. SOF + 长度 0xFFFF：立即回复 "too long"，随后的命令按交互输入执行
+ *        2. SOF + 合法长度后中断：字节间隔超时后丢弃该帧，随后的命令按交互输入执行
+ */
+static bool demo_recover(FILE *fp)
+{
+    static const char too_long[] = {DF_SHELL_BATCH_SOF, (char)0xFF, (char)0xFF};
+    static const char partial[] = {DF_SHELL_BATCH_SOF, 'x', 0};
+    uint8_t buf[8];
+
+    memset(demo_values, 0, sizeof(demo_values));
+    fflush(fp);
+    long offset = ftell(fp);
+    demo_feed(too_long, sizeof(too_long));
+    demo_feed("set 0 99\r", 9);
+
+    fflush(fp);
+    fseek(fp, offset, SEEK_SET);
+    bool len_ok = fread(buf, 1, sizeof(buf), fp) == sizeof(buf) && buf[0] == DF_SHELL_BATCH_SOF && buf[1] == 2 &&
+                  buf[3] == DF_SHELL_BATCH_ERR_LEN && demo_values[0] == 99;
+    fseek(fp, 0, SEEK_END);
+
+    demo_feed(partial, sizeof(partial));
+    Systick_Delay_ms(2 * DF_SHELL_BATCH_TIMEOUT);
+    demo_feed("set 1 55\r", 9);
+    bool timeout_ok = demo_values[1] == 55;
+
+    printf("[demo] stray SOF: length check %s, timeout %s\n", len_ok ? "ok" : "FAIL", timeout_ok ? "ok" : "FAIL");
+    return len_ok && timeout_ok;
+}
+
+static void demo_print(const char *name, const demo_result_t *r)
+{
+    double ms = (double)r->cycles * 1000.0 / SystemCoreClock;
+    printf("[demo] %-11s tx %5u bytes, %8.2f ms, %7.0f cmd/s %s\n", name,
+           (unsigned)r->tx_bytes, ms, (ms > 0.0) ? DEMO_CMDS * 1000.0 / ms : 0.0,
+           r->ok ? "ok" : "FAIL");
+}
+
+int main(void)
+{
+    FILE *fp = tmpfile();
+
+    if (fp == NULL)
+    {
+        return 1;
+    }
+
+    log_flush();
+    sim_usart_set_sink(fileno(fp));
+    shell_set_uart(&Debug);
+    MCU_Shell_Init(&Shell, &STM32F103C8T6_Device);
+    sim_usart_set_baud(DEMO_BAUD);
+
+    demo_result_t interactive = demo_interactive();
+    demo_result_t batch = demo_batch(fp);
+    bool recover = demo_recover(fp);
+
+    sim_usart_set_baud(0);
+    sim_usart_set_sink(fileno(stdout));
+    fclose(fp);
+
+    printf("[demo] %u baud, %u commands\n", (unsigned)DEMO_BAUD, (unsigned)DEMO_CMDS);
+    demo_print("interactive", &interactive);
+    demo_print("batch", &batch);
+
+    return (interactive.ok && batch.ok && recover) ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file tickless_demo.c
+ * @brief 无节拍空闲演示程序
+ * @details 相同负载分别以固定 1ms 节拍和无节拍空闲运行 10s 虚拟时间：
+ *          - sensor    50Hz 任务，200us
+ *          - telemetry 2Hz 任务
+ *          - blink     250ms 周期定时器（中断回调）
+ *          - EXTI0     每 777.7ms 一次，唤醒按键协程（提前唤醒无节拍休眠）
+ *          比较中断次数、休眠占比，并检查 get_tick() 与虚拟时间的偏差、任务与定时器的执行次数
+ *
+ *          ./df_tickless_demo
+ */
+
+#include "main.h"
+#include "df_sched.h"
+#include "df_timer.h"
+
+#define DEMO_US (SystemCoreClock / 1000000)
+#define DEMO_DURATION_MS 10000
+#define DEMO_EXTI_PERIOD (777700 * (uint64_t)DEMO_US)
+
+typedef struct
+{
+    uint32_t irqs;      /* 中断次数 */
+    double idle;        /* WFI 休眠占比 */
+    int32_t drift;      /* get_tick() 与虚拟时间换算节拍之差 */
+    uint32_t sensor;    /* sensor 作业数 */
+    uint32_t telemetry; /* telemetry 作业数 */
+    uint32_t blink;     /* 定时器回调次数 */
+    uint32_t button;    /* 按键处理次数 */
+    uint32_t misses;    /* 超时作业数 */
+} demo_result_t;
+
+static demo_result_t demo_result;
+static volatile bool demo_button_irq;
+static bool demo_running;
+
+static int demo_sensor_fn(df_task_t *task)
+{
+    sim_core_advance(200 * DEMO_US);
+    return DF_TASK_ENDED;
+}
+
+static int demo_telemetry_fn(df_task_t *task)
+{
+    log_flush();
+    return DF_TASK_ENDED;
+}
+
+static int demo_button_fn(df_task_t *task)
+{
+    DF_TASK_BEGIN(task);
+    for (;;)
+    {
+        DF_TASK_WAIT_UNTIL(task, demo_button_irq);
+        demo_button_irq = false;
+        demo_result.button++;
+    }
+    DF_TASK_END(task);
+}
+
+static df_task_t demo_sensor = DF_TASK_INIT("sensor", demo_sensor_fn, 20, 0);
+static df_task_t demo_telemetry = DF_TASK_INIT("telemetry", demo_telemetry_fn, 500, 2);
+static df_task_t demo_button = DF_TASK_INIT("button", demo_button_fn, 0, 1);
+
+static void demo_blink_fn(df_timer_t *timer)
+{
+    demo_result.blink++;
+}
+
+static df_timer_t demo_blink = DF_TIMER_INIT(demo_blink_fn, DF_TIMER_ISR);
+
+static void demo_exti0_isr(void)
+{
+    demo_button_irq = true;
+    df_task_wake(&demo_button);
+}
+
+static void demo_exti0_event(void *arg)
+{
+    sim_core_irq(EXTI0_IRQn, demo_exti0_isr);
+    if (demo_running)
+    {
+        sim_core_schedule(DEMO_EXTI_PERIOD, demo_exti0_event, NULL);
+    }
+}
+
+static demo_result_t demo_run(bool tickless)
+{
+    uint32_t cpt = SysTick->LOAD + 1;
+
+    memset(&demo_result, 0, sizeof(demo_result));
+    df_sched_set_tickless(tickless);
+    df_sched_add(&demo_sensor);
+    df_sched_add(&demo_telemetry);
+    df_sched_add(&demo_button);
+    df_timer_start(&demo_blink, 250, 250);
+    demo_running = true;
+    sim_core_schedule(DEMO_EXTI_PERIOD, demo_exti0_event, NULL);
+
+    /* 起点：当前节拍与距上一个节拍边界的周期 */
+    uint32_t t0 = get_tick();
+    uint64_t c0 = sim_core_cycles() - (cpt - (SysTick->VAL + 1));
+    uint32_t i0 = sim_core_irq_count();
+    uint64_t idle0 = sim_core_idle_cycles();
+
+    while ((int32_t)(get_tick() - (t0 + DEMO_DURATION_MS)) < 0)
+    {
+        df_sched_step();
+    }
+
+    uint64_t elapsed = sim_core_cycles() - c0;
+    demo_result.irqs = sim_core_irq_count() - i0;
+    demo_result.idle = (double)(sim_core_idle_cycles() - idle0) * 100.0 / (double)elapsed;
+    demo_result.drift = (int32_t)(get_tick() - t0) - (int32_t)(elapsed / cpt);
+    demo_result.sensor = demo_sensor.stats.runs;
+    demo_result.telemetry = demo_telemetry.stats.runs;
+    demo_result.misses = demo_sensor.stats.misses + demo_telemetry.stats.misses;
+
+    /* 停止负载，等待最后一个 EXTI0 事件结束 */
+    demo_running = false;
+    df_timer_stop(&demo_blink);
+    df_sched_remove(&demo_sensor);
+    df_sched_remove(&demo_telemetry);
+    df_sched_remove(&demo_button);
+    sim_core_advance(DEMO_EXTI_PERIOD);
+    demo_button_irq = false;
+    return demo_result;
+}
+
+static void demo_print(const char *name, const demo_result_t *r)
+{
+    printf("[demo] %-8s irqs %5u, idle %5.1f%%, drift %d, sensor %u, telemetry %u, blink %u, "
+           "button %u, misses %u\n",
+           name, (unsigned)r->irqs, r->idle, (int)r->drift, (unsigned)r->sensor,
+           (unsigned)r->telemetry, (unsigned)r->blink, (unsigned)r->button, (unsigned)r->misses);
+}
+
+int main(void)
+{
+    log_flush();
+    NVIC_EnableIRQ(EXTI0_IRQn);
+
+    demo_result_t ticking = demo_run(false);
+    demo_result_t tickless = demo_run(true);
+    fflush(stdout);
+
+    printf("\n[demo] %u ms, sensor 50Hz, telemetry 2Hz, timer 4Hz, EXTI0 every 777.7ms\n",
+           (unsigned)DEMO_DURATION_MS);
+    demo_print("ticking", &ticking);
+    demo_print("tickless", &tickless);
+
+    bool ok = ticking.drift == 0 && tickless.drift == 0 && tickless.irqs < ticking.irqs &&
+              tickless.sensor == ticking.sensor && tickless.telemetry == ticking.telemetry &&
+              tickless.blink == ticking.blink && tickless.button == ticking.button &&
+              tickless.misses == 0;
+    return ok ? 0 : 1;
+}
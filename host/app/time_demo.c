@@ -0,0 +1,168 @@
+/**
+ * @file time_demo.c
+ * @brief 64位时间基准演示程序
+ * @details 以虚拟周期为真值，检查 df_time_now_ns() 在以下情况下单调且误差不超过 1 个周期：
+ *          1. 主循环中以随机步长推进虚拟时间读取
+ *          2. 关中断跨过节拍边界（节拍中断挂起、尚未计入 get_tick()）时读取
+ *          3. EXTI0 中断中读取，中断执行期间推进时间跨过节拍边界
+ *          4. 无节拍空闲运行调度器，任务中读取
+ *          同时统计 get_tick() 与 SysTick->VAL 直接拼接的写法在情况 2、3 中的回退次数
+ *
+ *          ./df_time_demo
+ */
+
+#include "main.h"
+#include "df_sched.h"
+#include "df_time.h"
+
+#define DEMO_US (SystemCoreClock / 1000000)
+#define DEMO_STEPS 200000
+#define DEMO_MASKED 2000
+#define DEMO_ISR_EVENTS 2000
+
+typedef struct
+{
+    uint32_t reads;
+    uint32_t backwards;  /* 比上一次读取小 */
+    int64_t max_err;     /* 与真值之差的最大绝对值（ns） */
+    uint32_t naive_back; /* 直接拼接写法的回退次数 */
+} demo_stat_t;
+
+static demo_stat_t demo_stat[4];
+static uint64_t demo_offset; /* df_time 与虚拟周期换算值的固定偏差 */
+static uint64_t demo_last;
+static uint64_t demo_naive_last;
+static uint32_t demo_seed = 1;
+
+static uint32_t demo_rand(void)
+{
+    demo_seed = demo_seed * 1103515245u + 12345u;
+    return demo_seed >> 8;
+}
+
+static uint64_t demo_truth_ns(void)
+{
+    return sim_core_cycles() * 1000000000ULL / SystemCoreClock;
+}
+
+/**
+ * @brief 节拍数 + 当前 VAL 直接拼接，未处理挂起的节拍中断
+ */
+static uint64_t demo_naive_ns(void)
+{
+    uint32_t cpt = SysTick->LOAD + 1;
+    uint64_t cycles = (uint64_t)get_tick() * cpt + (SysTick->LOAD - SysTick->VAL);
+    return cycles * 1000000000ULL / SystemCoreClock;
+}
+
+static void demo_sample(demo_stat_t *st)
+{
+    uint64_t now = df_time_now_ns();
+    uint64_t naive = demo_naive_ns();
+    int64_t err = (int64_t)(now - demo_truth_ns() - demo_offset);
+
+    st->reads++;
+    if (now < demo_last)
+    {
+        st->backwards++;
+    }
+    if (naive < demo_naive_last)
+    {
+        st->naive_back++;
+    }
+    if (err < 0)
+    {
+        err = -err;
+    }
+    if (err > st->max_err)
+    {
+        st->max_err = err;
+    }
+    demo_last = now;
+    demo_naive_last = naive;
+}
+
+static void demo_exti0_isr(void)
+{
+    demo_sample(&demo_stat[2]);
+    sim_core_advance(demo_rand() % (1000 * DEMO_US)); /* 中断内跨节拍，SysTick 挂起 */
+    demo_sample(&demo_stat[2]);
+}
+
+static void demo_exti0_event(void *arg)
+{
+    sim_core_irq(EXTI0_IRQn, demo_exti0_isr);
+}
+
+static int demo_task_fn(df_task_t *task)
+{
+    demo_sample(&demo_stat[3]);
+    sim_core_advance(demo_rand() % (300 * DEMO_US));
+    demo_sample(&demo_stat[3]);
+    return DF_TASK_ENDED;
+}
+
+static df_task_t demo_task = DF_TASK_INIT("sample", demo_task_fn, 7, 0);
+
+static void demo_print(const char *name, const demo_stat_t *st)
+{
+    printf("[demo] %-10s reads %7u, backwards %u, max err %3lld ns, naive backwards %u\n", name,
+           (unsigned)st->reads, (unsigned)st->backwards, (long long)st->max_err,
+           (unsigned)st->naive_back);
+}
+
+int main(void)
+{
+    log_flush();
+    NVIC_EnableIRQ(EXTI0_IRQn);
+
+    /* SysTick 启动时刻与虚拟时间零点不同，取首次读取的差值为固定偏差 */
+    demo_offset = df_time_now_ns() - demo_truth_ns();
+    demo_last = df_time_now_ns();
+    demo_naive_last = demo_naive_ns();
+
+    for (int i = 0; i < DEMO_STEPS; i++)
+    {
+        sim_core_advance(1 + demo_rand() % (3 * DEMO_US));
+        demo_sample(&demo_stat[0]);
+    }
+
+    for (int i = 0; i < DEMO_MASKED; i++)
+    {
+        __disable_irq();
+        sim_core_advance(demo_rand() % (1000 * DEMO_US)); /* 不超过1个节拍，否则节拍中断合并丢失 */
+        demo_sample(&demo_stat[1]);
+        __enable_irq();
+        demo_sample(&demo_stat[1]);
+    }
+
+    for (int i = 0; i < DEMO_ISR_EVENTS; i++)
+    {
+        sim_core_schedule(demo_rand() % (2000 * DEMO_US), demo_exti0_event, NULL);
+        sim_core_advance(2000 * DEMO_US);
+    }
+
+    df_sched_set_tickless(true);
+    df_sched_add(&demo_task);
+    uint32_t end = get_tick() + 10000;
+    while ((int32_t)(get_tick() - end) < 0)
+    {
+        df_sched_step();
+    }
+    df_sched_remove(&demo_task);
+    fflush(stdout);
+
+    printf("\n[demo] df_time_now_ns() vs virtual cycles (1 cycle = %u ns)\n",
+           (unsigned)(1000000000u / SystemCoreClock));
+    demo_print("main loop", &demo_stat[0]);
+    demo_print("irq masked", &demo_stat[1]);
+    demo_print("in ISR", &demo_stat[2]);
+    demo_print("tickless", &demo_stat[3]);
+
+    bool ok = true;
+    for (int i = 0; i < 4; i++)
+    {
+        ok = ok && demo_stat[i].backwards == 0 && demo_stat[i].max_err <= 14;
+    }
+    return ok ? 0 : 1;
+}
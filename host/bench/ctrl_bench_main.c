@@ -0,0 +1,55 @@
+/**
+ * @file ctrl_bench_main.c
+ * @brief 主机端滤波器/PID基准测试入口
+ * @details 用法: ctrl_bench_O2 [-n 样本数] [-r 轮数] [-o 输出文件]
+ *          结果以 JSON 输出到标准输出或指定文件，可用 tool/bench_compare.py 对比
+ */
+
+#include "ctrl_bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n samples] [-r repeats] [-o file.json]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t samples = 100000;
+    uint32_t repeats = 10;
+    const char *out = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            samples = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+            repeats = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (out != NULL && freopen(out, "w", stdout) == NULL)
+    {
+        perror(out);
+        return 1;
+    }
+
+    ctrl_bench_result_t results[CTRL_BENCH_CASE_NUM];
+    int count = ctrl_bench_run(results, samples, repeats);
+    if (count <= 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    ctrl_bench_print_json(results, count, printf);
+    return 0;
+}
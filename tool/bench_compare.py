@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+基准测试结果对比工具
+对比两份 ctrl_bench JSON 输出（基线 / 当前），超过阈值的退化视为失败
+
+用法:
+    python3 tool/bench_compare.py baseline.json current.json [--threshold 5] [--metric cycles]
+"""
+
+import argparse
+import json
+import sys
+
+
+METRICS = {
+    "cycles": "cycles_per_sample",
+    "ns": "ns_per_sample",
+}
+
+
+def load_results(path):
+    """读取 JSON 文件，返回 (元信息, {用例名: 结果})"""
+    with open(path, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    results = {r["name"]: r for r in data.get("results", [])}
+    return data, results
+
+
+def compare(baseline_path, current_path, threshold, metric):
+    """逐项对比，返回退化的用例数"""
+    key = METRICS[metric]
+    base_meta, base = load_results(baseline_path)
+    cur_meta, cur = load_results(current_path)
+
+    if base_meta.get("platform") != cur_meta.get("platform"):
+        print(f"警告: 平台不同 ({base_meta.get('platform')} vs {cur_meta.get('platform')})")
+    if base_meta.get("opt") != cur_meta.get("opt"):
+        print(f"警告: 优化等级不同 ({base_meta.get('opt')} vs {cur_meta.get('opt')})")
+
+    print(f"{'用例':<24}{'基线':>12}{'当前':>12}{'变化':>10}")
+    print("-" * 58)
+
+    regressions = 0
+    for name, b in base.items():
+        c = cur.get(name)
+        if c is None:
+            print(f"{name:<24}{b[key]:>12.2f}{'缺失':>12}")
+            continue
+        old, new = b[key], c[key]
+        delta = (new - old) / old * 100.0 if old > 0 else 0.0
+        mark = ""
+        if delta > threshold:
+            mark = "  <-- 退化"
+            regressions += 1
+        print(f"{name:<24}{old:>12.2f}{new:>12.2f}{delta:>+9.1f}%{mark}")
+
+    for name in cur.keys() - base.keys():
+        print(f"{name:<24}{'新增':>12}{cur[name][key]:>12.2f}")
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="对比 ctrl_bench 基准测试结果")
+    parser.add_argument("baseline", help="基线结果 JSON")
+    parser.add_argument("current", help="当前结果 JSON")
+    parser.add_argument("--threshold", type=float, default=5.0, help="允许的退化百分比 (默认 5)")
+    parser.add_argument("--metric", choices=sorted(METRICS), default="cycles", help="对比指标 (默认 cycles)")
+    args = parser.parse_args()
+
+    regressions = compare(args.baseline, args.current, args.threshold, args.metric)
+    if regressions:
+        print(f"\n{regressions} 个用例退化超过 {args.threshold}%")
+        return 1
+    print("\n无退化")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+延迟日志解码工具
+根据 ELF 文件中的 .df_log_fmt 段还原 LOG_DEFERRED 模式输出的二进制日志，
+非记录数据（普通文本日志、Shell 输出）原样透传
+
+用法:
+    python3 tool/log_decode.py firmware.elf log.bin
+    python3 tool/log_decode.py firmware.elf -          # 从标准输入读取
+    python3 tool/log_decode.py firmware.elf --serial /dev/ttyUSB0 --baud 115200
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+
+LOG_SYNC = 0xDF          # 记录起始字节（与 df_log.h 中 LOG_DEFERRED_SYNC 一致）
+LOG_FLAG_TS = 0x80       # 带时间戳标志
+LOG_FLAG_US = 0x40       # 时间戳为微秒（低32位）
+LOG_NARGS_MASK = 0x0F    # 参数个数掩码
+LOG_TIMESTAMP_WIDTH = 8  # 时间戳宽度（与 df_log.c 一致）
+LOG_TIMESTAMP_SEC_WIDTH = 5  # 微秒时间戳秒部分宽度
+FMT_SECTION = ".df_log_fmt"
+
+SHF_ALLOC = 0x2
+
+# printf 转换说明: %[flags][width][.precision][length]conversion
+FMT_SPEC = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diouxXcsfFeEgGp%])")
+
+
+class ElfImage:
+    """最小 ELF 解析：读取节头，提供格式字符串与常量字符串查询"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} 不是 ELF 文件")
+
+        is64 = self.data[4] == 2
+        self.endian = "<" if self.data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(self.endian + "Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", self.data, 0x3A)
+            entry = self.endian + "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(self.endian + "I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", self.data, 0x2E)
+            entry = self.endian + "IIIIIIIIII"
+
+        raw = [struct.unpack_from(entry, self.data, shoff + i * shentsize) for i in range(shnum)]
+        names = raw[shstrndx]
+        self.sections = []
+        for name, _type, flags, addr, offset, size, *_ in raw:
+            end = self.data.index(b"\0", names[4] + name)
+            sec_name = self.data[names[4] + name:end].decode("ascii", "replace")
+            self.sections.append((sec_name, flags, addr, offset, size))
+
+        fmt = [s for s in self.sections if s[0] == FMT_SECTION]
+        if not fmt:
+            raise ValueError(f"ELF 中没有 {FMT_SECTION} 段（未启用 LOG_DEFERRED 或未使用 df_log_fmt.ld）")
+        _, _, _, self.fmt_offset, self.fmt_size = fmt[0]
+
+    @staticmethod
+    def _cstring(data, start, limit):
+        end = data.find(b"\0", start, limit)
+        if end < 0:
+            return None
+        return data[start:end].decode("utf-8", "replace")
+
+    def format_string(self, fmt_id):
+        """格式ID为字符串在 .df_log_fmt 段内的偏移"""
+        if fmt_id >= self.fmt_size:
+            return None
+        start = self.fmt_offset + fmt_id
+        return self._cstring(self.data, start, self.fmt_offset + self.fmt_size)
+
+    def string_at(self, addr):
+        """按运行地址查找已加载段中的常量字符串"""
+        for name, flags, sec_addr, offset, size in self.sections:
+            if flags & SHF_ALLOC and sec_addr <= addr < sec_addr + size and name != ".bss":
+                start = offset + addr - sec_addr
+                return self._cstring(self.data, start, offset + size)
+        return None
+
+
+def signed32(v):
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def render(elf, fmt, args):
+    """按格式字符串消费参数字，还原文本"""
+    out = []
+    pos = 0
+    words = iter(args)
+
+    def next_word():
+        return next(words, 0)
+
+    for m in FMT_SPEC.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, prec, _length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        if width == "*":
+            width = str(signed32(next_word()))
+        if prec == "*":
+            prec = str(signed32(next_word()))
+        spec = "%" + flags + (width or "") + ("." + prec if prec is not None else "")
+        word = next_word()
+
+        if conv in "di":
+            out.append((spec + "d") % signed32(word))
+        elif conv == "u":
+            out.append((spec + "d") % word)
+        elif conv in "oxX":
+            out.append((spec + conv) % word)
+        elif conv == "c":
+            out.append((spec + "c") % chr(word & 0xFF))
+        elif conv in "fFeEgG":
+            value, = struct.unpack("<f", struct.pack("<I", word))
+            out.append((spec + conv) % value)
+        elif conv == "s":
+            text = elf.string_at(word)
+            out.append((spec + "s") % (text if text is not None else f"<str@0x{word:08X}>"))
+        elif conv == "p":
+            out.append(f"0x{word:08x}")
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+class Decoder:
+    """流式解码器：识别记录，其余字节作为文本透传"""
+
+    def __init__(self, elf, output):
+        self.elf = elf
+        self.output = output
+        self.pending = bytearray()
+        self.records = 0
+
+    def _try_record(self, buf):
+        """返回 (消耗字节数, 文本)；数据不足返回 (0, None)；不是记录返回 (-1, None)"""
+        if len(buf) < 6:
+            return 0, None
+        flags = buf[1]
+        if flags & 0x30:
+            return -1, None
+        nargs = flags & LOG_NARGS_MASK
+        has_ts = bool(flags & LOG_FLAG_TS)
+        size = 6 + (4 if has_ts else 0) + 4 * nargs
+        fmt_id, = struct.unpack_from("<I", buf, 2)
+        fmt = self.elf.format_string(fmt_id)
+        if fmt is None:
+            return -1, None
+        if len(buf) < size:
+            return 0, None
+
+        pos = 6
+        prefix = ""
+        if has_ts:
+            ts, = struct.unpack_from("<I", buf, pos)
+            if flags & LOG_FLAG_US:
+                prefix = f"[{ts // 1000000:>{LOG_TIMESTAMP_SEC_WIDTH}}.{ts % 1000000:06d}] "
+            else:
+                prefix = f"[{ts:>{LOG_TIMESTAMP_WIDTH}}] "
+            pos += 4
+        args = struct.unpack_from(f"<{nargs}I", buf, pos)
+        return size, prefix + render(self.elf, fmt, args) + "\n"
+
+    def feed(self, data, final=False):
+        self.pending += data
+        buf = self.pending
+        i = 0
+        text_start = 0
+        while i < len(buf):
+            if buf[i] != LOG_SYNC:
+                i += 1
+                continue
+            used, text = self._try_record(buf[i:])
+            if used == 0 and not final:
+                break
+            if used <= 0:
+                i += 1
+                continue
+            self._emit_raw(buf[text_start:i])
+            self.output.write(text)
+            self.records += 1
+            i += used
+            text_start = i
+        self._emit_raw(buf[text_start:i])
+        del buf[:i]
+        self.output.flush()
+
+    def _emit_raw(self, chunk):
+        if chunk:
+            self.output.write(bytes(chunk).decode("utf-8", "replace"))
+
+
+def read_serial(port, baud, decoder):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("需要 pyserial: pip install pyserial")
+    with serial.Serial(port, baud, timeout=0.1) as ser:
+        try:
+            while True:
+                data = ser.read(4096)
+                if data:
+                    decoder.feed(data)
+        except KeyboardInterrupt:
+            decoder.feed(b"", final=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="解码 df_log 延迟（二进制）日志")
+    parser.add_argument("elf", help="与设备固件对应的 ELF 文件")
+    parser.add_argument("input", nargs="?", default="-", help="二进制日志文件，'-' 表示标准输入")
+    parser.add_argument("--serial", help="直接从串口读取")
+    parser.add_argument("--baud", type=int, default=115200, help="串口波特率")
+    args = parser.parse_args()
+
+    try:
+        elf = ElfImage(args.elf)
+    except (OSError, ValueError) as e:
+        sys.exit(f"错误: {e}")
+
+    decoder = Decoder(elf, sys.stdout)
+    if args.serial:
+        read_serial(args.serial, args.baud, decoder)
+        return 0
+
+    stream = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    with stream:
+        while True:
+            data = stream.read(4096)
+            if not data:
+                break
+            decoder.feed(data)
+    decoder.feed(b"", final=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
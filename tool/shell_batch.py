@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Shell 批处理工具
+把命令列表打包成 df_shell 批处理请求帧，通过串口发送并解析结果帧
+
+帧格式（与 df_shell.h 中 DF_SHELL_BATCH 说明一致）:
+    请求: SOF | 长度(2,小端) | 命令文本(换行分隔) | CRC16(2,小端)
+    结果: SOF | 长度 | 帧状态(1) 命令数(1) {命令状态(1) 输出长度(1) 输出}... | CRC16
+    CRC16-CCITT: 多项式 0x1021，初值 0xFFFF，覆盖长度与负载
+
+用法:
+    python3 tool/shell_batch.py --serial /dev/ttyUSB0 --baud 115200 cmds.txt
+    python3 tool/shell_batch.py --serial /dev/ttyUSB0 -c "set 1 10" -c "set 2 20"
+    python3 tool/shell_batch.py --dump -c "hello" > frame.bin     # 只输出请求帧
+"""
+
+import argparse
+import struct
+import sys
+
+
+BATCH_SOF = 0x02           # 帧起始字节（DF_SHELL_BATCH_SOF）
+BATCH_MAX = 256            # 请求帧命令文本最大长度（DF_SHELL_BATCH_MAX），整帧一次写入，目标板接收队列须能容纳
+CMD_TRUNCATED = 0x80       # 命令状态：输出被截断
+
+FRAME_STATUS = {0x00: "ok", 0x01: "crc error", 0x02: "too long"}
+CMD_STATUS = {0x00: "ok", 0x01: "not found"}
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def build_frame(payload):
+    head = struct.pack("<H", len(payload))
+    return bytes([BATCH_SOF]) + head + payload + struct.pack("<H", crc16(head + payload))
+
+
+def split_commands(commands, limit):
+    """按命令文本上限把命令分成多帧，每条命令以换行结尾"""
+    frames, cur = [], b""
+    for cmd in commands:
+        line = cmd.encode() + b"\n"
+        if len(line) > limit:
+            raise ValueError(f"命令过长: {cmd}")
+        if len(cur) + len(line) > limit:
+            frames.append(cur)
+            cur = b""
+        cur += line
+    if cur:
+        frames.append(cur)
+    return frames
+
+
+def parse_frame(payload):
+    """解析结果帧负载，返回 (帧状态, [(命令状态, 输出)])"""
+    status, count = payload[0], payload[1]
+    results, pos = [], 2
+    for _ in range(count):
+        st, n = payload[pos], payload[pos + 1]
+        results.append((st, payload[pos + 2:pos + 2 + n]))
+        pos += 2 + n
+    return status, results
+
+
+def read_frame(ser, timeout_reads=50):
+    """跳过 SOF 之前的数据（日志、提示符），读取一个完整结果帧并校验 CRC"""
+    buf = b""
+    for _ in range(timeout_reads):
+        buf += ser.read(4096)
+        start = buf.find(bytes([BATCH_SOF]))
+        if start < 0 or len(buf) - start < 3:
+            continue
+        length = struct.unpack_from("<H", buf, start + 1)[0]
+        end = start + 3 + length + 2
+        if len(buf) < end:
+            continue
+        body = buf[start + 1:start + 3 + length]
+        crc = struct.unpack_from("<H", buf, end - 2)[0]
+        if crc != crc16(body):
+            raise ValueError("结果帧 CRC 错误")
+        return body[2:]
+    raise TimeoutError("等待结果帧超时")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="df_shell 批处理命令发送")
+    parser.add_argument("file", nargs="?", help="命令文件，每行一条命令")
+    parser.add_argument("-c", "--command", action="append", default=[], help="追加一条命令")
+    parser.add_argument("--serial", help="串口设备")
+    parser.add_argument("--baud", type=int, default=115200, help="串口波特率")
+    parser.add_argument("--max", type=int, default=BATCH_MAX, help="每帧命令文本上限 (默认 256)")
+    parser.add_argument("--dump", action="store_true", help="只把请求帧写到标准输出")
+    args = parser.parse_args()
+
+    commands = list(args.command)
+    if args.file:
+        with open(args.file, encoding="utf-8") as f:
+            commands += [line.strip() for line in f if line.strip()]
+    if not commands:
+        parser.error("没有命令")
+
+    try:
+        frames = split_commands(commands, args.max)
+    except ValueError as e:
+        sys.exit(f"错误: {e}")
+
+    if args.dump:
+        for payload in frames:
+            sys.stdout.buffer.write(build_frame(payload))
+        return 0
+    if not args.serial:
+        parser.error("需要 --serial 或 --dump")
+
+    try:
+        import serial
+    except ImportError:
+        sys.exit("需要 pyserial: pip install pyserial")
+
+    failed = 0
+    index = 0
+    with serial.Serial(args.serial, args.baud, timeout=0.1) as ser:
+        for payload in frames:
+            ser.write(build_frame(payload))
+            status, results = parse_frame(read_frame(ser))
+            if status != 0:
+                sys.exit(f"错误: 帧状态 {FRAME_STATUS.get(status, hex(status))}")
+            sent = payload.count(b"\n")
+            for st, out in results:
+                name = CMD_STATUS.get(st & ~CMD_TRUNCATED, hex(st))
+                mark = " (truncated)" if st & CMD_TRUNCATED else ""
+                print(f"[{index:4d}] {commands[index]:<24} {name}{mark}")
+                if out:
+                    print("       " + out.decode("utf-8", "replace").rstrip().replace("\n", "\n       "))
+                failed += st != 0
+                index += 1
+            if len(results) < sent:
+                print(f"结果帧已满，{sent - len(results)} 条命令未执行")
+                failed += sent - len(results)
+                index += sent - len(results)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())